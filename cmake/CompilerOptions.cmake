@@ -90,6 +90,18 @@ if(ENABLE_WARNINGS)
     endif()
 endif()
 
+# ==============================================================================
+# 目標指令集
+# ==============================================================================
+# 預設 x86-64-v3 (AVX2, FMA)；可攜建置降為 x86-64-v2 (SSE4.2, POPCNT)，
+# 熱點 kernel 仍由 tx::simd 在執行期選用 AVX2 / AVX-512 版本
+if(ENABLE_PORTABLE_BUILD)
+    set(TX_MARCH x86-64-v2)
+    message(STATUS "Portable build: -march=${TX_MARCH} (runtime SIMD dispatch)")
+else()
+    set(TX_MARCH x86-64-v3)
+endif()
+
 # ==============================================================================
 # 通用編譯選項（不受 ENABLE_WARNINGS 影響）
 # ==============================================================================
@@ -109,14 +121,14 @@ target_compile_options(
         # 適合效能分析（profiling）與除錯的混合模式
         $<$<CONFIG:RelWithDebInfo>:
         -O3 # 最高優化等級
-        -march=x86-64-v3 # AVX2, FMA (RHEL 8 相容性)
+        -march=${TX_MARCH} # AVX2, FMA (RHEL 8 相容性)
         -g # 包含調試資訊
         -fno-omit-frame-pointer # 保留 frame pointer（便於 perf 分析）
         >
         # === Release 配置 ===
         $<$<CONFIG:Release>:
         -O2 # 最高優化等級
-        -march=x86-64-v3 # AVX2, FMA
+        -march=${TX_MARCH} # AVX2, FMA (可攜建置為 SSE4.2)
         -DNDEBUG # 禁用 assert
         # -fopt-info-vec-optimized # 迴圈向量化提示
         >
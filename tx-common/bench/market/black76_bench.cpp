@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "tx/market/black76.hpp"
+#include "tx/simd/cpu_features.hpp"
+
+namespace tx::market::bench {
+
+// ----------------------------------------------------------------------------
+// MARK: Fixture
+// ----------------------------------------------------------------------------
+
+/// 單一到期月份：15000 ~ 30000 點、每 50 點一檔
+struct Strikes {
+  static constexpr double kForward = 2'215'000;  // tick
+
+  std::vector<int32_t> strikes;
+  std::vector<double> vols;
+  std::vector<double> prices;
+
+  Strikes() {
+    for (int32_t k = 15000; k <= 30000; k += 50) {
+      strikes.push_back(k * 100);
+      const double m = std::log(static_cast<double>(k * 100) / kForward);
+      vols.push_back(0.18 + 0.6 * m * m);
+    }
+    prices.resize(strikes.size());
+    kernels::black76_greeks.variant(simd::Isa::Scalar)(
+        {.forward = kForward, .expiry = 0.05}, strikes.data(), vols.data(),
+        {.price = prices.data()}, strikes.size());
+  }
+};
+
+const Strikes& strikes() {
+  static const Strikes s;
+  return s;
+}
+
+// ----------------------------------------------------------------------------
+// MARK: Greeks
+// ----------------------------------------------------------------------------
+
+template <simd::Isa kIsa>
+static void BM_Black76Greeks(benchmark::State& state) {
+  const auto fn = kernels::black76_greeks.variant(kIsa);
+  if (fn == nullptr) {
+    state.SkipWithError("ISA not supported");
+    return;
+  }
+  const Strikes& s = strikes();
+  const size_t n = s.strikes.size();
+  std::vector<double> price(n), delta(n), gamma(n), vega(n);
+
+  for (auto _ : state) {
+    fn({.forward = Strikes::kForward, .expiry = 0.05}, s.strikes.data(),
+       s.vols.data(),
+       {.price = price.data(),
+        .delta = delta.data(),
+        .gamma = gamma.data(),
+        .vega = vega.data()},
+       n);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+BENCHMARK_TEMPLATE(BM_Black76Greeks, simd::Isa::Scalar);
+BENCHMARK_TEMPLATE(BM_Black76Greeks, simd::Isa::Avx2);
+BENCHMARK_TEMPLATE(BM_Black76Greeks, simd::Isa::Avx512);
+
+// ----------------------------------------------------------------------------
+// MARK: Implied Vol
+// ----------------------------------------------------------------------------
+
+/// Warm = 以上一次的結果為起點 (標的每次移動 5 點)
+template <simd::Isa kIsa, bool kWarm>
+static void BM_Black76ImpliedVol(benchmark::State& state) {
+  const auto fn = kernels::black76_implied_vol.variant(kIsa);
+  if (fn == nullptr) {
+    state.SkipWithError("ISA not supported");
+    return;
+  }
+  const Strikes& s = strikes();
+  const size_t n = s.strikes.size();
+  std::vector<double> vol(n, 0.0);
+  double shift = 500;
+
+  for (auto _ : state) {
+    if (!kWarm) std::fill(vol.begin(), vol.end(), 0.0);
+    shift = -shift;
+    fn({.forward = Strikes::kForward + shift, .expiry = 0.05},
+       s.strikes.data(), s.prices.data(), vol.data(), n);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+BENCHMARK_TEMPLATE(BM_Black76ImpliedVol, simd::Isa::Scalar, false);
+BENCHMARK_TEMPLATE(BM_Black76ImpliedVol, simd::Isa::Avx2, false);
+BENCHMARK_TEMPLATE(BM_Black76ImpliedVol, simd::Isa::Avx512, false);
+BENCHMARK_TEMPLATE(BM_Black76ImpliedVol, simd::Isa::Scalar, true);
+BENCHMARK_TEMPLATE(BM_Black76ImpliedVol, simd::Isa::Avx2, true);
+BENCHMARK_TEMPLATE(BM_Black76ImpliedVol, simd::Isa::Avx512, true);
+
+}  // namespace tx::market::bench
@@ -0,0 +1,131 @@
+#include <arpa/inet.h>
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "tx/market/instrument_registry.hpp"
+#include "tx/market/order_book.hpp"
+#include "tx/market/prefetch.hpp"
+#include "tx/net/taifex/packet_iterator.hpp"
+#include "tx/net/taifex/parser.hpp"
+
+namespace tx::market::bench {
+
+using namespace net::taifex;
+
+// ----------------------------------------------------------------------------
+// MARK: Fixture
+// ----------------------------------------------------------------------------
+
+/// 商品數夠多，使 books (數十 MB) 遠大於 LLC，每則訊息的 book 都是冷的
+constexpr size_t kInstruments = 65536;
+/// 1500 MTU 內可放 8 則 R06
+constexpr size_t kMessagesPerPacket = 8;
+constexpr size_t kPackets = 4096;
+
+struct Universe {
+  std::unique_ptr<InstrumentRegistry<kInstruments>> registry =
+      std::make_unique<InstrumentRegistry<kInstruments>>();
+  std::vector<OrderBook> books = std::vector<OrderBook>(kInstruments);
+  std::vector<std::vector<std::byte>> packets;
+  std::vector<std::string> symbols;
+
+  Universe() {
+    for (size_t i = 0; i < kInstruments; ++i) {
+      symbols.push_back("I" + std::to_string(i));
+      (void)registry->add(symbols.back());
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> pick(0, kInstruments - 1);
+    for (uint32_t p = 0; p < kPackets; ++p) {
+      std::vector<std::byte> packet(sizeof(PacketHeader));
+      for (size_t m = 0; m < kMessagesPerPacket; ++m) {
+        R06SnapshotWire w = make_r06(symbols[pick(rng)], p);
+        const auto* b = reinterpret_cast<const std::byte*>(&w);
+        for (size_t i = 0; i < sizeof(w); ++i) {
+          packet.push_back(b[i]);
+        }
+      }
+      PacketHeader hdr{};
+      hdr.esc_code = 0x1B;
+      hdr.packet_version = 0x01;
+      hdr.packet_length = htons(static_cast<uint16_t>(packet.size()));
+      hdr.msg_count = htons(static_cast<uint16_t>(kMessagesPerPacket));
+      hdr.pkt_seq_num = htonl(p + 1);
+      hdr.channel_id = htons(1);
+      std::memcpy(packet.data(), &hdr, sizeof(hdr));
+      packets.push_back(std::move(packet));
+    }
+  }
+
+  static R06SnapshotWire make_r06(const std::string& symbol, uint32_t seed) {
+    R06SnapshotWire w{};
+    w.header.msg_length = htons(sizeof(R06SnapshotWire));
+    w.header.msg_kind = 'R';
+    w.header.msg_type = '6';
+    std::memset(w.prod_id, ' ', sizeof(w.prod_id));
+    std::memcpy(w.prod_id, symbol.data(), symbol.size());
+    w.bid_level_cnt = 5;
+    w.ask_level_cnt = 5;
+    for (uint32_t i = 0; i < 5; ++i) {
+      w.bid_levels[i] = R06LevelWire{.price = static_cast<int32_t>(
+                                      htonl(20000 + seed % 100 - i)),
+                                  .quantity = htonl(i + 1),
+                                  .order_count = htonl(1)};
+      w.ask_levels[i] = R06LevelWire{.price = static_cast<int32_t>(
+                                      htonl(20001 + seed % 100 + i)),
+                                  .quantity = htonl(i + 1),
+                                  .order_count = htonl(1)};
+    }
+    return w;
+  }
+};
+
+Universe& universe() {
+  static Universe u;
+  return u;
+}
+
+// ----------------------------------------------------------------------------
+// MARK: Decode Loop
+// ----------------------------------------------------------------------------
+
+/// Distance = 0 為依序處理的基準
+template <size_t Distance>
+static void BM_DecodeLoop_Prefetch(benchmark::State& state) {
+  Universe& u = universe();
+  size_t next = 0;
+  uint64_t changed = 0;
+
+  for (auto _ : state) {
+    auto it = PacketIterator::from(u.packets[next]);
+    next = (next + 1) % kPackets;
+
+    for_each_prefetched<Distance>(
+        *it,
+        [&](const MessageView& msg) {
+          return resolve_instrument(*u.registry, msg);
+        },
+        [&](InstrumentId id) { prefetch_for_write(u.books[id]); },
+        [&](const MessageView& msg, InstrumentId id) {
+          auto snap = parse_r06_snapshot(msg.bytes);
+          changed += u.books[id].apply(*snap);
+        });
+  }
+
+  benchmark::DoNotOptimize(changed);
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(kMessagesPerPacket));
+}
+
+BENCHMARK_TEMPLATE(BM_DecodeLoop_Prefetch, 0);
+BENCHMARK_TEMPLATE(BM_DecodeLoop_Prefetch, 2);
+BENCHMARK_TEMPLATE(BM_DecodeLoop_Prefetch, 4);
+BENCHMARK_TEMPLATE(BM_DecodeLoop_Prefetch, 8);
+
+}  // namespace tx::market::bench
@@ -0,0 +1,202 @@
+#ifndef TX_TRADING_ENGINE_BACKTEST_BACKTEST_RUNNER_HPP
+#define TX_TRADING_ENGINE_BACKTEST_BACKTEST_RUNNER_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tx/core/type.hpp"
+#include "tx/error.hpp"
+#include "tx/io/file.hpp"
+#include "tx/io/mapped_file.hpp"
+#include "tx/sync/thread_pool.hpp"
+#include "tx/sys/clock.hpp"
+
+namespace tx::backtest {
+
+// ----------------------------------------------------------------------------
+// 統計
+// ----------------------------------------------------------------------------
+
+/// @brief 單一回測工作 (或彙總) 的損益與成交統計
+///
+/// 金額以 tick 為單位 (價格 ticks × 口數)，不含手續費
+struct BacktestStats {
+  uint64_t packets{0};    ///< 回放封包數
+  uint64_t fills{0};      ///< 成交筆數
+  int64_t volume{0};      ///< 成交口數
+  int64_t position{0};    ///< 淨部位 (口)
+  int64_t cash_ticks{0};  ///< 累計現金流
+  int64_t pnl_ticks{0};   ///< 結算損益 (mark_to_market() 後有效)
+
+  /// @brief 記錄一筆成交
+  void on_fill(core::Side side, core::Price price,
+               core::Quantity qty) noexcept {
+    const int64_t q = qty.value();
+    const int64_t notional = price.to_ticks() * q;
+    ++fills;
+    volume += q;
+    if (side == core::Side::Buy) {
+      position += q;
+      cash_ticks -= notional;
+    } else {
+      position -= q;
+      cash_ticks += notional;
+    }
+  }
+
+  /// @brief 以結算價計算損益
+  void mark_to_market(core::Price mark) noexcept {
+    pnl_ticks = cash_ticks + position * mark.to_ticks();
+  }
+
+  /// @brief 累加另一份統計 (彙總用)
+  void merge(const BacktestStats& other) noexcept {
+    packets += other.packets;
+    fills += other.fills;
+    volume += other.volume;
+    position += other.position;
+    cash_ticks += other.cash_ticks;
+    pnl_ticks += other.pnl_ticks;
+  }
+};
+
+// ----------------------------------------------------------------------------
+// 工作定義
+// ----------------------------------------------------------------------------
+
+/// @brief 單一回測工作: 一份擷取檔 (e.g. 一天) × 一組參數
+template <typename Params>
+struct BacktestJob {
+  size_t index;                        ///< 在 BacktestReport::jobs 中的位置
+  size_t capture_index;                ///< 第幾份擷取檔
+  std::span<const std::byte> capture;  ///< 唯讀共用的擷取檔內容
+  const Params* params;                ///< 本工作的參數
+};
+
+/// @brief 回測結果
+struct BacktestReport {
+  std::vector<BacktestStats> jobs;  ///< 依 job index 排列
+  BacktestStats total;              ///< 所有工作的彙總
+};
+
+// ----------------------------------------------------------------------------
+// BacktestRunner
+// ----------------------------------------------------------------------------
+
+/// @brief 平行回測 (參數掃描)
+///
+/// 將「擷取檔 × 參數組合」展開成獨立工作，交給 work-stealing
+/// sync::ThreadPool 執行，結束後彙總損益與成交統計。
+/// - 擷取檔以 MAP_SHARED 唯讀映射一次，所有 worker 共用同一份 page cache
+/// - 每個工作開始前將 thread_local 的 sys::SimulatedClock 歸零，
+///   工作之間時間軸互不干擾
+/// - 結果寫入預先配置的 slot，執行期間不需鎖
+/// - 依商品分片時，將商品放入 Params 即可
+/// - 每個 worker 在掃描期間持續滿載：pool 必須以非隔離的 CPU
+///   (sys::CPUAffinity::get_housekeeping_cpus()，ThreadPool::create() 的
+///   預設值) 建立，不可包含 isolcpus 上的交易核心
+///
+/// @tparam Params 策略參數型別
+///
+/// @example
+///   // 只用非隔離的核心，盤中與交易執行緒並存時不搶核心
+///   auto pool = TRY(sync::ThreadPool::create(
+///       sys::CPUAffinity::get_housekeeping_cpus()));
+///   BacktestRunner<MyParams> runner(*pool);
+///   TRY(runner.add_capture("/data/20260105.cap"));
+///   runner.add_params({.threshold = 10});
+///   auto report = runner.run([](const BacktestJob<MyParams>& job) {
+///     auto feed = ...CaptureFeed::from(job.capture)...;
+///     ...
+///     return stats;
+///   });
+///
+template <typename Params>
+class BacktestRunner {
+ private:
+  sync::ThreadPool& pool_;
+  std::vector<io::MappedFile> captures_;
+  std::vector<Params> params_;
+
+ public:
+  /// @param pool 以非隔離 CPU 建立的 thread pool (見類別說明)
+  explicit BacktestRunner(sync::ThreadPool& pool) noexcept : pool_(pool) {}
+
+  // ----------------------------------------------------------------------------
+  // 設定
+  // ----------------------------------------------------------------------------
+
+  /// @brief 加入擷取檔 (唯讀 mmap)
+  /// @return 擷取檔 index 或錯誤
+  [[nodiscard]] Result<size_t> add_capture(std::string path) noexcept {
+    auto file = TRY(io::File::open(std::move(path), O_RDONLY));
+    auto mapped = TRY(io::MappedFile::from_file(std::move(file), PROT_READ,
+                                                MAP_SHARED));
+    // 回放為順序讀取，提示 kernel 預讀
+    auto _ = mapped.advise(io::MappedFile::Advise::Sequential);
+
+    captures_.push_back(std::move(mapped));
+    return captures_.size() - 1;
+  }
+
+  /// @brief 加入一組參數
+  void add_params(Params params) { params_.push_back(std::move(params)); }
+
+  [[nodiscard]] size_t capture_count() const noexcept {
+    return captures_.size();
+  }
+  [[nodiscard]] size_t params_count() const noexcept { return params_.size(); }
+  [[nodiscard]] size_t job_count() const noexcept {
+    return captures_.size() * params_.size();
+  }
+
+  // ----------------------------------------------------------------------------
+  // 執行
+  // ----------------------------------------------------------------------------
+
+  /// @brief 平行執行所有工作並等待完成
+  /// @param fn `BacktestStats fn(const BacktestJob<Params>&)`，會在多個
+  ///           worker 上同時被呼叫，需為 thread-safe
+  /// @return 各工作與彙總統計
+  template <typename Fn>
+    requires std::invocable<const Fn&, const BacktestJob<Params>&>
+  [[nodiscard]] BacktestReport run(const Fn& fn) {
+    BacktestReport report;
+    report.jobs.resize(job_count());
+
+    size_t index = 0;
+    for (size_t c = 0; c < captures_.size(); ++c) {
+      for (const auto& params : params_) {
+        BacktestJob<Params> job{.index = index,
+                                .capture_index = c,
+                                .capture = captures_[c].data(),
+                                .params = &params};
+        BacktestStats* slot = &report.jobs[index];
+        pool_.submit([job, slot, &fn] {
+          sys::SimulatedClock::set(0);
+          *slot = fn(job);
+        });
+        ++index;
+      }
+    }
+
+    pool_.wait_idle();
+
+    for (const auto& stats : report.jobs) {
+      report.total.merge(stats);
+    }
+    return report;
+  }
+};
+
+}  // namespace tx::backtest
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef TX_TRADING_ENGINE_CORO_FRAME_POOL_HPP
+#define TX_TRADING_ENGINE_CORO_FRAME_POOL_HPP
+
+#include <cstddef>
+
+namespace tx::coro {
+
+/// @brief Coroutine frame 配置器
+///
+/// 依大小分級 (128B ~ 4KiB) 的 thread_local free-list，frame 釋放後回到
+/// 所屬級距重複使用，穩定狀態下建立/銷毀 coroutine 不會呼叫 malloc。
+/// 超過最大級距者直接使用 ::operator new。
+///
+/// @note Thread Safety: 每個執行緒各自一個池；frame 必須在配置它的執行緒
+///       上銷毀 (reactor 模型下自然成立)
+///
+class FramePool {
+ public:
+  static constexpr size_t kMinClass = 128;
+  static constexpr size_t kMaxClass = 4096;
+  static constexpr size_t kSlabSize = 64 * 1024;
+
+  FramePool() = delete;  // static class
+
+  [[nodiscard]] static void* allocate(size_t size) noexcept;
+  static void deallocate(void* ptr, size_t size) noexcept;
+
+  /// @brief 目前執行緒尚未釋放的 frame 數
+  [[nodiscard]] static size_t outstanding() noexcept;
+
+  /// @brief 目前執行緒向系統配置的 slab 總大小
+  [[nodiscard]] static size_t reserved_bytes() noexcept;
+};
+
+}  // namespace tx::coro
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef TX_TRADING_ENGINE_CORO_IO_HPP
+#define TX_TRADING_ENGINE_CORO_IO_HPP
+
+#include <sys/socket.h>
+
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+
+#include "tx/coro/task.hpp"
+#include "tx/error.hpp"
+#include "tx/io/reactor.hpp"
+#include "tx/io/socket.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/sys/timer_wheel.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::coro {
+
+// ----------------------------------------------------------------------------
+// Awaiters
+// ----------------------------------------------------------------------------
+//
+// 所有 awaiter 都先直接嘗試 syscall，只有 EAGAIN 時才向 io::Reactor 登記
+// 並暫停；awaiter 本身位於 coroutine frame 中，登記不需任何配置。
+// fd 需為非阻塞，首次暫停時自動加入 reactor。
+//
+
+/// @brief co_await 讀取 (recv)
+class ReadAwaiter : private io::IoWaiter {
+ private:
+  io::Reactor& reactor_;
+  int fd_;
+  std::span<std::byte> buffer_;
+  Result<size_t> result_{0};
+  std::coroutine_handle<> handle_{};
+
+ public:
+  ReadAwaiter(io::Reactor& reactor, int fd, std::span<std::byte> buffer)
+      : reactor_(reactor), fd_(fd), buffer_(buffer) {}
+
+  [[nodiscard]] bool await_ready() noexcept { return try_once(); }
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    if (auto r = reactor_.add(fd_); !r) {
+      result_ = std::unexpected(r.error());
+      return false;
+    }
+    handle_ = h;
+    on_ready = &ReadAwaiter::ready;
+    reactor_.wait_readable(fd_, this);
+    return true;
+  }
+
+  /// @return 讀取的 bytes 數 (0 = 對端關閉) 或錯誤
+  Result<size_t> await_resume() noexcept { return result_; }
+
+ private:
+  /// @return true = 已有結果 (資料、EOF 或錯誤)
+  bool try_once() noexcept {
+    ssize_t n;
+    do {
+      n = ::recv(fd_, buffer_.data(), buffer_.size(), 0);
+    } while (n < 0 && errno == EINTR);
+
+    if (n >= 0) {
+      result_ = static_cast<size_t>(n);
+      return true;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return false;
+    }
+    result_ = tx::fail(errno, "recv() failed");
+    return true;
+  }
+
+  static void ready(io::IoWaiter* w, uint32_t /*events*/) noexcept {
+    auto* self = static_cast<ReadAwaiter*>(w);
+    if (!self->try_once()) {
+      self->reactor_.wait_readable(self->fd_, self);  // 假喚醒，繼續等
+      return;
+    }
+    self->handle_.resume();
+  }
+};
+
+/// @brief co_await 寫入 (send，可能只寫入部分)
+class WriteAwaiter : private io::IoWaiter {
+ private:
+  io::Reactor& reactor_;
+  int fd_;
+  std::span<const std::byte> data_;
+  Result<size_t> result_{0};
+  std::coroutine_handle<> handle_{};
+
+ public:
+  WriteAwaiter(io::Reactor& reactor, int fd, std::span<const std::byte> data)
+      : reactor_(reactor), fd_(fd), data_(data) {}
+
+  [[nodiscard]] bool await_ready() noexcept { return try_once(); }
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    if (auto r = reactor_.add(fd_); !r) {
+      result_ = std::unexpected(r.error());
+      return false;
+    }
+    handle_ = h;
+    on_ready = &WriteAwaiter::ready;
+    reactor_.wait_writable(fd_, this);
+    return true;
+  }
+
+  /// @return 寫入的 bytes 數或錯誤
+  Result<size_t> await_resume() noexcept { return result_; }
+
+ private:
+  bool try_once() noexcept {
+    ssize_t n;
+    do {
+      n = ::send(fd_, data_.data(), data_.size(), MSG_NOSIGNAL);
+    } while (n < 0 && errno == EINTR);
+
+    if (n >= 0) {
+      result_ = static_cast<size_t>(n);
+      return true;
+    }
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return false;
+    }
+    result_ = tx::fail(errno, "send() failed");
+    return true;
+  }
+
+  static void ready(io::IoWaiter* w, uint32_t /*events*/) noexcept {
+    auto* self = static_cast<WriteAwaiter*>(w);
+    if (!self->try_once()) {
+      self->reactor_.wait_writable(self->fd_, self);
+      return;
+    }
+    self->handle_.resume();
+  }
+};
+
+/// @brief co_await 非阻塞 TCP 連線 (可設定期限)
+class ConnectAwaiter : private io::IoWaiter {
+ private:
+  /// @brief 逾時用的第二個等待節點
+  struct TimeoutWaiter : io::IoWaiter {
+    ConnectAwaiter* owner{nullptr};
+  };
+
+  io::Reactor& reactor_;
+  io::Socket& socket_;
+  const io::SocketAddress& addr_;
+  uint64_t deadline_tsc_;
+  TimeoutWaiter timeout_{};
+  sys::TimerHandle timer_{};
+  Result<> result_{};
+  std::coroutine_handle<> handle_{};
+
+ public:
+  /// @param deadline_tsc 連線期限 (TSC cycle)，0 = 不設期限
+  ConnectAwaiter(io::Reactor& reactor, io::Socket& socket,
+                 const io::SocketAddress& addr, uint64_t deadline_tsc)
+      : reactor_(reactor),
+        socket_(socket),
+        addr_(addr),
+        deadline_tsc_(deadline_tsc) {}
+
+  [[nodiscard]] bool await_ready() noexcept {
+    auto started = socket_.connect_nonblocking(addr_);
+    if (!started) {
+      result_ = std::unexpected(started.error());
+      return true;
+    }
+    return *started;  // 立即完成 (e.g. loopback)
+  }
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    if (auto r = reactor_.add(socket_.fd()); !r) {
+      result_ = std::unexpected(r.error());
+      return false;
+    }
+
+    if (deadline_tsc_ != 0) {
+      timeout_.owner = this;
+      timeout_.on_ready = &ConnectAwaiter::timed_out;
+      auto timer = reactor_.schedule(deadline_tsc_, &timeout_);
+      if (!timer) {
+        result_ = std::unexpected(timer.error());
+        return false;
+      }
+      timer_ = *timer;
+    }
+
+    handle_ = h;
+    on_ready = &ConnectAwaiter::writable;
+    reactor_.wait_writable(socket_.fd(), this);
+    return true;
+  }
+
+  /// @return 成功，或錯誤 (逾時為 std::errc::timed_out)
+  Result<> await_resume() noexcept { return result_; }
+
+ private:
+  static void writable(io::IoWaiter* w, uint32_t /*events*/) noexcept {
+    auto* self = static_cast<ConnectAwaiter*>(w);
+    if (self->timer_.is_valid()) {
+      self->reactor_.cancel_timer(self->timer_);
+    }
+    self->result_ = self->socket_.connect_result();
+    self->handle_.resume();
+  }
+
+  static void timed_out(io::IoWaiter* w, uint32_t /*events*/) noexcept {
+    auto* self = static_cast<TimeoutWaiter*>(w)->owner;
+    self->reactor_.cancel_wait(self->socket_.fd(), self);
+    self->result_ = tx::fail(std::errc::timed_out, "connect() timed out");
+    self->handle_.resume();
+  }
+};
+
+/// @brief co_await 睡眠直到指定 TSC 時間
+class SleepAwaiter : private io::IoWaiter {
+ private:
+  io::Reactor& reactor_;
+  uint64_t deadline_tsc_;
+  Result<> result_{};
+  std::coroutine_handle<> handle_{};
+
+ public:
+  SleepAwaiter(io::Reactor& reactor, uint64_t deadline_tsc)
+      : reactor_(reactor), deadline_tsc_(deadline_tsc) {}
+
+  [[nodiscard]] bool await_ready() const noexcept {
+    return sys::TSCTimer::now() >= deadline_tsc_;
+  }
+
+  bool await_suspend(std::coroutine_handle<> h) noexcept {
+    handle_ = h;
+    on_ready = &SleepAwaiter::fired;
+    if (auto timer = reactor_.schedule(deadline_tsc_, this); !timer) {
+      result_ = std::unexpected(timer.error());
+      return false;
+    }
+    return true;
+  }
+
+  /// @return 成功，或錯誤 (timer 已滿)
+  Result<> await_resume() noexcept { return result_; }
+
+ private:
+  static void fired(io::IoWaiter* w, uint32_t /*events*/) noexcept {
+    static_cast<SleepAwaiter*>(w)->handle_.resume();
+  }
+};
+
+// ----------------------------------------------------------------------------
+// 便利函數
+// ----------------------------------------------------------------------------
+
+[[nodiscard]] inline ReadAwaiter async_read(io::Reactor& reactor, int fd,
+                                            std::span<std::byte> buffer) {
+  return {reactor, fd, buffer};
+}
+
+[[nodiscard]] inline WriteAwaiter async_write(
+    io::Reactor& reactor, int fd, std::span<const std::byte> data) {
+  return {reactor, fd, data};
+}
+
+/// @param deadline_tsc 期限 (TSC cycle)，0 = 不設期限
+[[nodiscard]] inline ConnectAwaiter async_connect(
+    io::Reactor& reactor, io::Socket& socket, const io::SocketAddress& addr,
+    uint64_t deadline_tsc = 0) {
+  return {reactor, socket, addr, deadline_tsc};
+}
+
+[[nodiscard]] inline SleepAwaiter sleep_until(io::Reactor& reactor,
+                                              uint64_t deadline_tsc) {
+  return {reactor, deadline_tsc};
+}
+
+/// @brief 寫入全部資料 (處理部分寫入)
+/// @return 寫入的 bytes 數 (= data.size()) 或錯誤
+inline Task<Result<size_t>> async_write_all(io::Reactor& reactor, int fd,
+                                            std::span<const std::byte> data) {
+  size_t total = 0;
+  while (total < data.size()) {
+    auto n = co_await async_write(reactor, fd, data.subspan(total));
+    if (!n) {
+      co_return std::unexpected(n.error());
+    }
+    total += *n;
+  }
+  co_return total;
+}
+
+}  // namespace tx::coro
+
+#endif
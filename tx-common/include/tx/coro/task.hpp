@@ -0,0 +1,210 @@
+#ifndef TX_TRADING_ENGINE_CORO_TASK_HPP
+#define TX_TRADING_ENGINE_CORO_TASK_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "tx/coro/frame_pool.hpp"
+
+namespace tx::coro {
+
+template <typename T>
+class Task;
+
+namespace detail {
+
+/// @brief 所有 Task promise 共用的部分
+///
+/// - frame 由 FramePool 配置
+/// - final_suspend 以 symmetric transfer 恢復等待者，不會堆疊遞迴
+/// - detached (spawn) 的 task 結束時自行銷毀 frame
+class PromiseBase {
+ private:
+  std::coroutine_handle<> continuation_{};
+  bool detached_{false};
+
+  struct FinalAwaiter {
+    [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<Promise> h) noexcept {
+      PromiseBase& p = h.promise();
+      if (p.continuation_) {
+        return p.continuation_;
+      }
+      if (p.detached_) {
+        h.destroy();
+      }
+      return std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+ public:
+  static void* operator new(size_t size) { return FramePool::allocate(size); }
+  static void operator delete(void* ptr, size_t size) noexcept {
+    FramePool::deallocate(ptr, size);
+  }
+
+  [[nodiscard]] std::suspend_always initial_suspend() const noexcept {
+    return {};
+  }
+  [[nodiscard]] FinalAwaiter final_suspend() const noexcept { return {}; }
+
+  /// @note 專案以 -fno-exceptions 編譯，不會走到這裡
+  void unhandled_exception() const noexcept { std::terminate(); }
+
+  void set_continuation(std::coroutine_handle<> h) noexcept {
+    continuation_ = h;
+  }
+  void set_detached() noexcept { detached_ = true; }
+};
+
+template <typename T>
+class Promise : public PromiseBase {
+ private:
+  std::optional<T> value_;
+
+ public:
+  Task<T> get_return_object() noexcept;
+
+  template <typename U>
+  void return_value(U&& value) noexcept {
+    value_.emplace(std::forward<U>(value));
+  }
+
+  [[nodiscard]] T take() noexcept { return std::move(*value_); }
+};
+
+template <>
+class Promise<void> : public PromiseBase {
+ public:
+  Task<void> get_return_object() noexcept;
+  void return_void() const noexcept {}
+  void take() const noexcept {}
+};
+
+}  // namespace detail
+
+/// @brief 惰性啟動的 coroutine task
+///
+/// 建立時不執行，被 co_await (或 spawn()) 時才開始；完成後恢復等待者。
+/// 錯誤以回傳值 (e.g. Task<Result<size_t>>) 傳遞，與專案其他部分一致。
+/// - Move-Only，解構時銷毀尚未 detach 的 frame
+/// - 不支援跨執行緒恢復 (frame 來自 thread_local 的 FramePool)
+///
+/// @example
+///   Task<Result<>> logon(Reactor& r, Socket& s) {
+///     auto sent = co_await async_write_all(r, s.fd(), logon_msg);
+///     if (!sent) co_return std::unexpected(sent.error());
+///     auto n = co_await async_read(r, s.fd(), buf);
+///     ...
+///   }
+///
+template <typename T = void>
+class [[nodiscard]] Task {
+ public:
+  using promise_type = detail::Promise<T>;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+ private:
+  handle_type handle_{};
+
+ public:
+  // ----------------------------------------------------------------------------
+  // 建構函數
+  // ----------------------------------------------------------------------------
+
+  Task() noexcept = default;
+  explicit Task(handle_type h) noexcept : handle_(h) {}
+
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+  ~Task() noexcept {
+    if (handle_) handle_.destroy();
+  }
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+  Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+  Task& operator=(Task&& other) noexcept {
+    if (this != &other) {
+      if (handle_) handle_.destroy();
+      handle_ = std::exchange(other.handle_, {});
+    }
+    return *this;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] bool valid() const noexcept {
+    return static_cast<bool>(handle_);
+  }
+  [[nodiscard]] bool done() const noexcept { return handle_ && handle_.done(); }
+
+  /// @brief 同步取得結果 (需已完成，用於測試或最上層)
+  [[nodiscard]] T result() noexcept { return handle_.promise().take(); }
+
+  /// @brief 手動啟動 (不等待)
+  void start() noexcept { handle_.resume(); }
+
+  /// @brief 交出 frame 所有權，結束時自行銷毀
+  handle_type detach() noexcept {
+    handle_.promise().set_detached();
+    return std::exchange(handle_, {});
+  }
+
+  // ----------------------------------------------------------------------------
+  // co_await
+  // ----------------------------------------------------------------------------
+
+  auto operator co_await() && noexcept {
+    struct Awaiter {
+      handle_type handle;
+
+      [[nodiscard]] bool await_ready() const noexcept { return false; }
+
+      std::coroutine_handle<> await_suspend(
+          std::coroutine_handle<> awaiting) noexcept {
+        handle.promise().set_continuation(awaiting);
+        return handle;
+      }
+
+      T await_resume() noexcept { return handle.promise().take(); }
+    };
+    return Awaiter{handle_};
+  }
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object() noexcept {
+  return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() noexcept {
+  return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+}  // namespace detail
+
+/// @brief 啟動 task 並放手 (fire-and-forget)
+///
+/// task 會執行到第一個暫停點後返回，之後由 reactor 事件繼續推進，
+/// 結束時自行釋放 frame。
+template <typename T>
+void spawn(Task<T>&& task) noexcept {
+  task.detach().resume();
+}
+
+}  // namespace tx::coro
+
+#endif
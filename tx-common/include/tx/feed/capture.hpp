@@ -0,0 +1,173 @@
+#ifndef TX_TRADING_ENGINE_FEED_CAPTURE_HPP
+#define TX_TRADING_ENGINE_FEED_CAPTURE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/io/file.hpp"
+
+namespace tx::feed {
+
+// ----------------------------------------------------------------------------
+// 檔案格式
+// ----------------------------------------------------------------------------
+//
+// [CaptureFileHeader][CaptureRecordHeader][payload][CaptureRecordHeader]...
+//
+// - 所有欄位為 host order (擷取與回放在同一架構上進行)
+// - payload 為原始 UDP payload，不補齊
+//
+
+inline constexpr std::array<char, 8> kCaptureMagic = {'T', 'X', 'C', 'A',
+                                                      'P', '0', '0', '1'};
+
+/// @brief 擷取檔檔頭 (16 bytes)
+struct CaptureFileHeader {
+  std::array<char, 8> magic;  ///< kCaptureMagic
+  uint32_t version;           ///< 格式版本
+  uint32_t reserved;
+};
+
+static_assert(sizeof(CaptureFileHeader) == 16);
+
+/// @brief 每筆封包紀錄的表頭 (16 bytes)
+struct CaptureRecordHeader {
+  uint64_t timestamp_ns;  ///< 擷取時間 (epoch ns)
+  uint32_t length;        ///< payload 長度
+  uint32_t channel;       ///< 來源頻道 (保留給多頻道擷取)
+};
+
+static_assert(sizeof(CaptureRecordHeader) == 16);
+
+// ----------------------------------------------------------------------------
+// CaptureWriter
+// ----------------------------------------------------------------------------
+
+/// @brief 擷取檔寫入器 (離線工具/錄製用，非 hot path)
+///
+/// 內部以 buffer 累積後批次寫入，解構時自動 flush
+///
+class CaptureWriter {
+ public:
+  static constexpr size_t kBufferSize = 64 * 1024;
+
+ private:
+  io::File file_;
+  std::vector<std::byte> buffer_;
+
+  explicit CaptureWriter(io::File file) noexcept;
+
+ public:
+  // ----------------------------------------------------------------------------
+  // Factory Methods
+  // ----------------------------------------------------------------------------
+
+  /// @brief 建立 (覆寫) 擷取檔並寫入檔頭
+  [[nodiscard]] static Result<CaptureWriter> create(std::string path) noexcept;
+
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+  ~CaptureWriter() noexcept;
+  CaptureWriter(const CaptureWriter&) = delete;
+  CaptureWriter& operator=(const CaptureWriter&) = delete;
+  CaptureWriter(CaptureWriter&&) noexcept = default;
+  CaptureWriter& operator=(CaptureWriter&&) noexcept = default;
+
+  // ----------------------------------------------------------------------------
+  // 操作
+  // ----------------------------------------------------------------------------
+
+  /// @brief 附加一筆封包
+  [[nodiscard]] Result<> append(uint64_t timestamp_ns,
+                                std::span<const std::byte> packet,
+                                uint32_t channel = 0) noexcept;
+
+  /// @brief 將 buffer 寫入檔案
+  [[nodiscard]] Result<> flush() noexcept;
+};
+
+// ----------------------------------------------------------------------------
+// CaptureFeed
+// ----------------------------------------------------------------------------
+
+/// @brief 擷取檔回放來源 (feed::PacketFeed)
+///
+/// 直接走訪記憶體中的擷取檔 (通常為 io::MappedFile::data())，不複製
+/// payload。只保存 span 與讀取位置，因此多個 worker 可共用同一份唯讀
+/// mapping 各自回放。
+/// - 封包時間戳為擷取時間 (ns)，搭配 sys::SimulatedClock 使用
+///
+class CaptureFeed {
+ public:
+  static constexpr size_t kDefaultBurst = 64;
+
+ private:
+  std::span<const std::byte> data_;  ///< 不含檔頭的紀錄區
+  size_t pos_{0};
+  size_t burst_;
+
+  CaptureFeed(std::span<const std::byte> records, size_t burst) noexcept
+      : data_(records), burst_(burst) {}
+
+ public:
+  /// @brief 驗證檔頭並建立回放來源
+  /// @param file 完整擷取檔內容
+  [[nodiscard]] static Result<CaptureFeed> from(
+      std::span<const std::byte> file, size_t burst = kDefaultBurst) noexcept {
+    if (file.size() < sizeof(CaptureFileHeader)) {
+      return tx::fail(std::errc::invalid_argument, "Capture file too small");
+    }
+
+    CaptureFileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (header.magic != kCaptureMagic) {
+      return tx::fail(std::errc::invalid_argument, "Bad capture magic");
+    }
+
+    return CaptureFeed(file.subspan(sizeof(CaptureFileHeader)), burst);
+  }
+
+  /// @brief 回放下一批封包
+  /// @return 處理的封包數；紀錄截斷時回傳錯誤
+  template <typename Sink>
+  Result<size_t> poll(Sink&& sink) noexcept {
+    size_t n = 0;
+    while (n < burst_ && !exhausted()) {
+      if (data_.size() - pos_ < sizeof(CaptureRecordHeader)) [[unlikely]] {
+        return tx::fail(std::errc::illegal_byte_sequence,
+                        "Truncated capture record header");
+      }
+
+      CaptureRecordHeader rec;
+      std::memcpy(&rec, data_.data() + pos_, sizeof(rec));
+      pos_ += sizeof(rec);
+
+      if (data_.size() - pos_ < rec.length) [[unlikely]] {
+        return tx::fail(std::errc::illegal_byte_sequence,
+                        "Truncated capture payload");
+      }
+
+      sink(data_.subspan(pos_, rec.length), rec.timestamp_ns);
+      pos_ += rec.length;
+      ++n;
+    }
+    return n;
+  }
+
+  [[nodiscard]] bool exhausted() const noexcept {
+    return pos_ >= data_.size();
+  }
+
+  void rewind() noexcept { pos_ = 0; }
+};
+
+}  // namespace tx::feed
+
+#endif
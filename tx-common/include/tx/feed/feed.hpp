@@ -0,0 +1,32 @@
+#ifndef TX_TRADING_ENGINE_FEED_FEED_HPP
+#define TX_TRADING_ENGINE_FEED_FEED_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "tx/error.hpp"
+
+namespace tx::feed {
+
+/// @brief 行情封包來源
+///
+/// 即時 (UdpFeed) 與回放 (MemoryFeed 等) 共用同一介面，上層 (StrategyHost)
+/// 只依賴此 concept，因此同一份策略程式碼不需修改即可在兩者上執行。
+/// - poll(sink): 非阻塞，將目前可取得的封包逐一交給
+///   `sink(std::span<const std::byte> packet, uint64_t timestamp)`，
+///   回傳處理的封包數
+/// - timestamp 為封包收到 (或擷取) 的時間，單位需與搭配的 sys::Clock 相同，
+///   回放時由 Clock::observe() 推動模擬時間
+/// - 回放來源可另外提供 `exhausted()` 表示資料已讀完
+///
+template <typename F>
+concept PacketFeed =
+    requires(F& feed, void (*sink)(std::span<const std::byte>, uint64_t)) {
+      { feed.poll(sink) } -> std::same_as<Result<size_t>>;
+    };
+
+}  // namespace tx::feed
+
+#endif
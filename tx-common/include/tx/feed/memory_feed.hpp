@@ -0,0 +1,69 @@
+#ifndef TX_TRADING_ENGINE_FEED_MEMORY_FEED_HPP
+#define TX_TRADING_ENGINE_FEED_MEMORY_FEED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "tx/error.hpp"
+
+namespace tx::feed {
+
+/// @brief 記憶體回放來源
+///
+/// 依序回放預先載入的封包，用於測試與小規模回放。封包資料由呼叫端持有，
+/// 本類別只保存 span。
+/// - timestamps 為各封包的擷取時間 (e.g. 奈秒)，未提供時皆為 0
+///
+class MemoryFeed {
+ public:
+  static constexpr size_t kDefaultBurst = 64;
+
+ private:
+  std::vector<std::span<const std::byte>> packets_;
+  std::vector<uint64_t> timestamps_;
+  size_t pos_{0};
+  size_t burst_;
+
+ public:
+  explicit MemoryFeed(std::vector<std::span<const std::byte>> packets,
+                      size_t burst = kDefaultBurst) noexcept
+      : packets_(std::move(packets)), burst_(burst) {}
+
+  /// @param timestamps 與 packets 一一對應的時間戳
+  MemoryFeed(std::vector<std::span<const std::byte>> packets,
+             std::vector<uint64_t> timestamps,
+             size_t burst = kDefaultBurst) noexcept
+      : packets_(std::move(packets)),
+        timestamps_(std::move(timestamps)),
+        burst_(burst) {
+    timestamps_.resize(packets_.size(), 0);
+  }
+
+  /// @brief 回放下一批封包
+  template <typename Sink>
+  Result<size_t> poll(Sink&& sink) noexcept {
+    size_t n = 0;
+    while (n < burst_ && pos_ < packets_.size()) {
+      uint64_t ts = pos_ < timestamps_.size() ? timestamps_[pos_] : 0;
+      sink(packets_[pos_], ts);
+      ++pos_;
+      ++n;
+    }
+    return n;
+  }
+
+  /// @brief 是否已回放完畢
+  [[nodiscard]] bool exhausted() const noexcept {
+    return pos_ >= packets_.size();
+  }
+
+  /// @brief 從頭開始回放
+  void rewind() noexcept { pos_ = 0; }
+};
+
+}  // namespace tx::feed
+
+#endif
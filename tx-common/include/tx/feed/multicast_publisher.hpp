@@ -0,0 +1,314 @@
+#ifndef TX_TRADING_ENGINE_FEED_MULTICAST_PUBLISHER_HPP
+#define TX_TRADING_ENGINE_FEED_MULTICAST_PUBLISHER_HPP
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/udp_socket.hpp"
+#include "tx/sys/clock.hpp"
+
+namespace tx::feed {
+
+// ----------------------------------------------------------------------------
+// Wire Format
+// ----------------------------------------------------------------------------
+
+/// @brief 內部重新發布 datagram 的標頭
+///
+/// datagram = PublishHeader + N × (uint16_t length + event bytes)
+/// @note 使用 host byte order，僅供同架構的內部消費者
+struct PublishHeader {
+  uint32_t sequence;  ///< datagram 序號 (連續遞增，供消費端偵測遺失)
+  uint16_t count;     ///< 事件數
+  uint16_t length;    ///< datagram 總長度 (含標頭)
+};
+static_assert(sizeof(PublishHeader) == 8);
+
+/// @brief 走訪 datagram 中的事件 (消費端)
+/// @param fn `fn(std::span<const std::byte> event)`
+/// @return 格式正確時為 true
+template <typename Fn>
+bool for_each_event(std::span<const std::byte> datagram, Fn&& fn) noexcept {
+  if (datagram.size() < sizeof(PublishHeader)) return false;
+
+  PublishHeader hdr;
+  std::memcpy(&hdr, datagram.data(), sizeof(hdr));
+  if (hdr.length != datagram.size()) return false;
+
+  size_t pos = sizeof(PublishHeader);
+  for (uint16_t i = 0; i < hdr.count; ++i) {
+    uint16_t len;
+    if (pos + sizeof(len) > datagram.size()) return false;
+    std::memcpy(&len, datagram.data() + pos, sizeof(len));
+    pos += sizeof(len);
+    if (pos + len > datagram.size()) return false;
+    fn(datagram.subspan(pos, len));
+    pos += len;
+  }
+  return pos == datagram.size();
+}
+
+// ----------------------------------------------------------------------------
+// MulticastPublisher
+// ----------------------------------------------------------------------------
+
+/// @brief 發布端設定
+struct PublisherConfig {
+  /// @brief 單一 datagram 上限 (1500 MTU - IP 20 - UDP 8)
+  size_t max_datagram_size{1472};
+  /// @brief 最舊的未送出事件最多等待多久 (微秒)，0 = 每次 poll() 都送出
+  uint32_t linger_us{0};
+  int ttl{1};            ///< Multicast TTL (1 = 同一子網)
+  bool loopback{false};  ///< 本機是否收到自己發送的封包
+};
+
+/// @brief 發布端統計
+struct PublisherStats {
+  uint64_t events{0};     ///< 已送出事件數
+  uint64_t datagrams{0};  ///< 已送出 datagram 數
+  uint64_t syscalls{0};   ///< sendmmsg 呼叫次數
+  uint64_t dropped{0};    ///< 發送失敗而丟棄的 datagram 數
+};
+
+/// @brief 批次 Multicast 發布端 (內部重新發布正規化行情)
+///
+/// 多個事件打包進同一個 datagram 直到 max_datagram_size，完成的 datagram
+/// 累積後以一次 sendmmsg 送出，取代每個 datagram 一次 sendto。
+/// - publish() 只寫入緩衝區；批次已滿 (kMaxBatch 個 datagram) 時才送出
+/// - poll() 在最舊的未送出事件超過 linger 時送出全部 (含未滿的 datagram)，
+///   event loop 每輪處理完輸入後呼叫；linger = 0 表示每輪都送出，
+///   同一輪輸入產生的事件仍會合併
+/// - linger 越長，每個 datagram 的事件越多、syscall 越少，但延遲越高
+///
+/// @tparam Clock 時間來源 (linger 判斷)，回放時可用 sys::SimulatedClock
+/// @note Thread Safety: 非執行緒安全
+///
+template <sys::Clock Clock = sys::TscClock>
+class MulticastPublisher {
+ public:
+  static constexpr size_t kMaxBatch = 64;  ///< 單次 sendmmsg 的 datagram 數
+  static constexpr size_t kMaxDatagramSize = 65507;
+  static constexpr size_t kEventOverhead = sizeof(uint16_t);
+
+ private:
+  io::UdpSocket socket_;
+  io::SocketAddress group_;
+  size_t max_size_;
+  uint64_t linger_ticks_;
+
+  std::vector<std::byte> buffer_;  ///< kMaxBatch 個 datagram 槽
+  std::array<size_t, kMaxBatch> lengths_{};
+  std::array<uint16_t, kMaxBatch> counts_{};
+  std::array<iovec, kMaxBatch> iov_{};
+  std::array<mmsghdr, kMaxBatch> msgs_{};
+
+  size_t sealed_{0};                      ///< 已封裝完成的 datagram 數
+  size_t cursor_{sizeof(PublishHeader)};  ///< 目前 datagram 的寫入位置
+  uint16_t count_{0};                     ///< 目前 datagram 的事件數
+  uint32_t sequence_{0};
+  uint64_t oldest_{0};  ///< 最舊的未送出事件時間 (clock tick)
+  bool pending_{false};
+  PublisherStats stats_{};
+
+  MulticastPublisher(io::UdpSocket socket, const io::SocketAddress& group,
+                     size_t max_size, uint64_t linger_ticks) noexcept
+      : socket_(std::move(socket)),
+        group_(group),
+        max_size_(max_size),
+        linger_ticks_(linger_ticks),
+        buffer_(kMaxBatch * max_size) {}
+
+ public:
+  // ----------------------------------------------------------------------------
+  // Factory Methods
+  // ----------------------------------------------------------------------------
+
+  /// @brief 建立發布端
+  /// @param group 目標地址 (Multicast group，測試時也可為 unicast)
+  /// @param config 發布設定
+  [[nodiscard]] static Result<MulticastPublisher> create(
+      const io::SocketAddress& group,
+      const PublisherConfig& config = {}) noexcept {
+    if (config.max_datagram_size < sizeof(PublishHeader) + kEventOverhead ||
+        config.max_datagram_size > kMaxDatagramSize) {
+      return tx::fail(std::errc::invalid_argument, "Invalid datagram size");
+    }
+
+    auto socket = TRY(io::UdpSocket::create());
+    CHECK(socket.set_multicast_ttl(config.ttl));
+    CHECK(socket.set_multicast_loopback(config.loopback));
+
+    return MulticastPublisher(
+        std::move(socket), group, config.max_datagram_size,
+        Clock::from_ns(uint64_t{config.linger_us} * 1000));
+  }
+
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+
+  /// @brief 送出剩餘事件
+  ~MulticastPublisher() noexcept {
+    if (socket_.is_valid()) {
+      (void)flush();
+    }
+  }
+  MulticastPublisher(const MulticastPublisher&) = delete;
+  MulticastPublisher& operator=(const MulticastPublisher&) = delete;
+  MulticastPublisher(MulticastPublisher&&) noexcept = default;
+  MulticastPublisher& operator=(MulticastPublisher&&) noexcept = default;
+
+  // ----------------------------------------------------------------------------
+  // 發布
+  // ----------------------------------------------------------------------------
+
+  /// @brief 加入一個事件 (只寫入緩衝區，批次滿時才送出)
+  /// @return 成功或錯誤 (事件過大、批次送出失敗)
+  Result<> publish(std::span<const std::byte> event) noexcept {
+    const size_t needed = kEventOverhead + event.size();
+    if (needed > max_size_ - sizeof(PublishHeader)) [[unlikely]] {
+      return tx::fail(std::errc::message_size, "Event exceeds datagram");
+    }
+
+    if (cursor_ + needed > max_size_) {
+      seal();
+      if (sealed_ == kMaxBatch) {
+        if (auto r = send_sealed(); !r) {
+          return std::unexpected(r.error());
+        }
+      }
+    }
+
+    std::byte* p = slot(sealed_) + cursor_;
+    const auto len = static_cast<uint16_t>(event.size());
+    std::memcpy(p, &len, sizeof(len));
+    std::memcpy(p + sizeof(len), event.data(), event.size());
+    cursor_ += needed;
+    ++count_;
+
+    if (!pending_) {
+      pending_ = true;
+      oldest_ = Clock::now();
+    }
+    return {};
+  }
+
+  /// @brief 加入一個 trivially copyable 的事件結構
+  template <typename T>
+    requires std::is_trivially_copyable_v<T> &&
+             (!std::is_convertible_v<const T&, std::span<const std::byte>>)
+  Result<> publish(const T& event) noexcept {
+    return publish(std::as_bytes(std::span(&event, 1)));
+  }
+
+  /// @brief linger 到期時送出全部
+  /// @return 送出的 datagram 數或錯誤
+  Result<size_t> poll() noexcept {
+    if (!pending_ || Clock::now() - oldest_ < linger_ticks_) {
+      return 0;
+    }
+    return flush();
+  }
+
+  /// @brief 立即送出全部 (含未滿的 datagram)
+  /// @return 送出的 datagram 數或錯誤
+  Result<size_t> flush() noexcept {
+    if (count_ > 0) {
+      seal();
+    }
+    return send_sealed();
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  /// @brief 尚未送出的 datagram 數 (含未滿的一個)
+  [[nodiscard]] size_t pending_datagrams() const noexcept {
+    return sealed_ + (count_ > 0 ? 1 : 0);
+  }
+  [[nodiscard]] const PublisherStats& stats() const noexcept { return stats_; }
+  [[nodiscard]] const io::UdpSocket& socket() const noexcept { return socket_; }
+
+ private:
+  [[nodiscard]] std::byte* slot(size_t i) noexcept {
+    return buffer_.data() + i * max_size_;
+  }
+
+  /// @brief 封裝目前的 datagram (寫入標頭)
+  void seal() noexcept {
+    PublishHeader hdr{.sequence = sequence_++,
+                      .count = count_,
+                      .length = static_cast<uint16_t>(cursor_)};
+    std::memcpy(slot(sealed_), &hdr, sizeof(hdr));
+    lengths_[sealed_] = cursor_;
+    counts_[sealed_] = count_;
+    ++sealed_;
+    cursor_ = sizeof(PublishHeader);
+    count_ = 0;
+  }
+
+  void account(size_t sent) noexcept {
+    stats_.datagrams += sent;
+    for (size_t i = 0; i < sent; ++i) {
+      stats_.events += counts_[i];
+    }
+  }
+
+  Result<size_t> send_sealed() noexcept {
+    const size_t total = sealed_;
+    if (total == 0) {
+      pending_ = false;
+      return 0;
+    }
+
+    // 指標在送出時才填入，物件移動後仍然正確
+    for (size_t i = 0; i < total; ++i) {
+      iov_[i] = iovec{.iov_base = slot(i), .iov_len = lengths_[i]};
+      msgs_[i] = mmsghdr{};
+      msgs_[i].msg_hdr.msg_name = group_.raw();
+      msgs_[i].msg_hdr.msg_namelen = group_.length();
+      msgs_[i].msg_hdr.msg_iov = &iov_[i];
+      msgs_[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    size_t sent = 0;
+    while (sent < total) {
+      ++stats_.syscalls;
+      auto n = socket_.sendmmsg(std::span(msgs_).subspan(sent, total - sent));
+      if (!n) {
+        // UDP 語意: 發送失敗的 datagram 直接丟棄，不阻塞重試
+        account(sent);
+        stats_.dropped += total - sent;
+        sealed_ = 0;
+        pending_ = false;
+        return std::unexpected(n.error());
+      }
+      sent += *n;
+    }
+
+    account(total);
+    sealed_ = 0;
+    pending_ = count_ > 0;
+    if (pending_) {
+      oldest_ = Clock::now();
+    }
+    return total;
+  }
+};
+
+}  // namespace tx::feed
+
+#endif
@@ -0,0 +1,210 @@
+#ifndef TX_TRADING_ENGINE_FEED_PACKET_RING_FEED_HPP
+#define TX_TRADING_ENGINE_FEED_PACKET_RING_FEED_HPP
+
+#include <arpa/inet.h>
+#include <linux/if_packet.h>
+#include <netinet/ip.h>
+#include <netinet/udp.h>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+#include "tx/error.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::feed {
+
+/// @brief PacketRingFeed 設定
+struct PacketRingConfig {
+  std::string_view interface{"lo"};  ///< 網卡名稱 (e.g. "eth0", "veth0")
+  /// @brief 過濾條件: 目的 IP 與埠號 (IP 為 0.0.0.0 時只比對埠號)
+  io::SocketAddress group{io::SocketAddress::any_ipv4(0)};
+  uint32_t block_size{1U << 20};  ///< 每個 block 大小 (需為頁大小的倍數)
+  uint32_t block_count{64};       ///< ring 中的 block 數
+  uint32_t frame_size{2048};      ///< 每個封包的最大槽位 (V3 為變長，僅上限)
+  /// @brief block 未滿時最多等待多久即交給使用者 (毫秒)
+  uint32_t block_timeout_ms{1};
+  size_t burst_blocks{4};  ///< 單次 poll() 最多處理的 block 數
+  /// @brief group 為 multicast 地址時，由 feed 自行加入 (見 PacketRingFeed)
+  bool join_group{true};
+};
+
+/// @brief PacketRingFeed 統計
+struct PacketRingStats {
+  uint64_t blocks{0};    ///< 已處理的 block 數
+  uint64_t packets{0};   ///< 交給 sink 的封包數
+  uint64_t filtered{0};  ///< 不符合過濾條件而略過的封包數
+};
+
+/// @brief TPACKET_V3 mmap ring 行情來源 (feed::PacketFeed)
+///
+/// 以 AF_PACKET socket 搭配 TPACKET_V3 ring 收包：kernel 直接把封包寫入
+/// 與使用者共享的記憶體，以 block 為單位交給使用者，收包不需要任何
+/// syscall (recvfrom 每個封包一次)。
+/// - 自行略過 L2、解析 IPv4/UDP 標頭並依目的地址/埠號過濾，payload 以
+///   零拷貝 span 交給 sink (通常接著交給 net::taifex::PacketIterator)
+/// - sink 可選擇接收 kernel 時間戳: `sink(packet, tsc, kernel_ns)`
+///   (ring 中每個封包都有，不需額外 SO_TIMESTAMPNS)；一般
+///   `sink(packet, tsc)` 的時間戳為取得 block 時的 TSC (與 UdpFeed 相同)
+/// - 需要 CAP_NET_RAW；可用於 loopback 與 veth 測試
+/// - AF_PACKET 不會加入 multicast group：group 為 multicast 地址時，
+///   create() 以 PACKET_ADD_MEMBERSHIP 讓網卡接收該 group 的 MAC，並以
+///   一個不讀取的 UDP socket 在該網卡上 IP_ADD_MEMBERSHIP 送出 IGMP join
+///   (交換器做 IGMP snooping 時才會轉送)；兩者都在 feed 解構時離開。
+///   join_group = false 時由呼叫端自行維持一個已加入的 socket
+///
+/// @note Thread Safety: 非執行緒安全
+///
+class PacketRingFeed {
+ private:
+  int fd_{-1};
+  int igmp_fd_{-1};  ///< 維持 IGMP membership 的 UDP socket (不讀取)
+  std::byte* ring_{nullptr};
+  size_t ring_size_{0};
+  uint32_t block_size_{0};
+  uint32_t block_count_{0};
+  uint32_t current_{0};  ///< 下一個要讀取的 block
+  size_t burst_blocks_{0};
+  uint32_t dst_ip_{0};    ///< network byte order，0 = 不比對
+  uint16_t dst_port_{0};  ///< network byte order
+  PacketRingStats stats_{};
+
+  PacketRingFeed(int fd, int igmp_fd, std::byte* ring,
+                 const PacketRingConfig& config, uint32_t dst_ip,
+                 uint16_t dst_port) noexcept;
+
+ public:
+  // ----------------------------------------------------------------------------
+  // Factory Methods
+  // ----------------------------------------------------------------------------
+
+  /// @brief 建立 ring 並綁定到網卡 (multicast group 同時加入)
+  /// @return PacketRingFeed 或錯誤 (權限不足為 EPERM)
+  [[nodiscard]] static Result<PacketRingFeed> create(
+      const PacketRingConfig& config) noexcept;
+
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+  ~PacketRingFeed() noexcept;
+  PacketRingFeed(const PacketRingFeed&) = delete;
+  PacketRingFeed& operator=(const PacketRingFeed&) = delete;
+  PacketRingFeed(PacketRingFeed&& other) noexcept;
+  PacketRingFeed& operator=(PacketRingFeed&& other) noexcept;
+
+  // ----------------------------------------------------------------------------
+  // 操作
+  // ----------------------------------------------------------------------------
+
+  /// @brief 處理 kernel 已交出的 block
+  /// @return 交給 sink 的封包數
+  template <typename Sink>
+  Result<size_t> poll(Sink&& sink) noexcept {
+    size_t delivered = 0;
+    for (size_t b = 0; b < burst_blocks_; ++b) {
+      auto* block = reinterpret_cast<tpacket_block_desc*>(
+          ring_ + size_t{current_} * block_size_);
+      if (!owned_by_user(block)) {
+        break;
+      }
+
+      const uint64_t tsc = sys::TSCTimer::now();
+      const auto& bh = block->hdr.bh1;
+      const auto* base = reinterpret_cast<const std::byte*>(block);
+      const auto* pkt = reinterpret_cast<const tpacket3_hdr*>(
+          base + bh.offset_to_first_pkt);
+
+      for (uint32_t i = 0; i < bh.num_pkts; ++i) {
+        if (auto payload = extract_payload(pkt)) {
+          const uint64_t kernel_ns =
+              uint64_t{pkt->tp_sec} * 1'000'000'000ULL + pkt->tp_nsec;
+          if constexpr (std::invocable<Sink&, std::span<const std::byte>,
+                                       uint64_t, uint64_t>) {
+            sink(*payload, tsc, kernel_ns);
+          } else {
+            sink(*payload, tsc);
+          }
+          ++delivered;
+        } else {
+          ++stats_.filtered;
+        }
+        pkt = reinterpret_cast<const tpacket3_hdr*>(
+            reinterpret_cast<const std::byte*>(pkt) + pkt->tp_next_offset);
+      }
+
+      release(block);
+      current_ = (current_ + 1) % block_count_;
+      ++stats_.blocks;
+    }
+    stats_.packets += delivered;
+    return delivered;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] const PacketRingStats& stats() const noexcept {
+    return stats_;
+  }
+
+  /// @brief kernel 端因 ring 已滿而丟棄的封包數 (讀取後 kernel 歸零)
+  [[nodiscard]] Result<uint64_t> kernel_drops() noexcept;
+
+  [[nodiscard]] int fd() const noexcept { return fd_; }
+
+ private:
+  void close() noexcept;
+
+  [[nodiscard]] static bool owned_by_user(tpacket_block_desc* block) noexcept {
+    return (std::atomic_ref(block->hdr.bh1.block_status)
+                .load(std::memory_order_acquire) &
+            TP_STATUS_USER) != 0;
+  }
+
+  static void release(tpacket_block_desc* block) noexcept {
+    std::atomic_ref(block->hdr.bh1.block_status)
+        .store(TP_STATUS_KERNEL, std::memory_order_release);
+  }
+
+  /// @brief 解析 IPv4/UDP 並依過濾條件取出 payload
+  [[nodiscard]] std::optional<std::span<const std::byte>> extract_payload(
+      const tpacket3_hdr* pkt) const noexcept {
+    const auto* frame = reinterpret_cast<const std::byte*>(pkt);
+    const size_t l2_len = size_t{pkt->tp_net} - pkt->tp_mac;
+    if (pkt->tp_snaplen < l2_len + sizeof(iphdr)) return std::nullopt;
+    const size_t l3_len = pkt->tp_snaplen - l2_len;
+
+    const auto* ip = reinterpret_cast<const iphdr*>(frame + pkt->tp_net);
+    const size_t ihl = size_t{ip->ihl} * 4;
+    if (ip->version != 4 || ip->protocol != IPPROTO_UDP ||
+        ihl < sizeof(iphdr) || l3_len < ihl + sizeof(udphdr)) {
+      return std::nullopt;
+    }
+    // 分片無法在單一 frame 內還原 (行情封包不應分片)
+    if ((ip->frag_off & htons(IP_MF | IP_OFFMASK)) != 0) return std::nullopt;
+    if (dst_ip_ != 0 && ip->daddr != dst_ip_) return std::nullopt;
+
+    const auto* udp = reinterpret_cast<const udphdr*>(
+        reinterpret_cast<const std::byte*>(ip) + ihl);
+    if (udp->dest != dst_port_) return std::nullopt;
+
+    const size_t udp_len = ntohs(udp->len);
+    if (udp_len < sizeof(udphdr) || ihl + udp_len > l3_len) {
+      return std::nullopt;  // 被 frame_size 截斷或長度錯誤
+    }
+
+    return std::span(reinterpret_cast<const std::byte*>(udp) + sizeof(udphdr),
+                     udp_len - sizeof(udphdr));
+  }
+};
+
+}  // namespace tx::feed
+
+#endif
@@ -0,0 +1,327 @@
+#ifndef TX_TRADING_ENGINE_FEED_RECOVERY_HPP
+#define TX_TRADING_ENGINE_FEED_RECOVERY_HPP
+
+#include <arpa/inet.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "tx/net/taifex/wire_format.hpp"
+
+namespace tx::feed {
+
+// ----------------------------------------------------------------------------
+// PacketBuffer
+// ----------------------------------------------------------------------------
+
+/// @brief 預先配置的封包 ring (回補期間暫存增量封包)
+///
+/// 建構時一次配置 capacity 個 slot_size 大小的槽位，之後 push() 只做
+/// memcpy。已滿時覆蓋最舊的封包 (由 ChannelRecovery 偵測為缺口)。
+///
+class PacketBuffer {
+ public:
+  /// @brief 取出的封包 (data 指向 ring 內部，pop_front() 前有效)
+  struct Entry {
+    uint32_t seq;
+    uint64_t timestamp;
+    std::span<const std::byte> packet;
+  };
+
+ private:
+  struct Slot {
+    uint32_t seq{0};
+    uint32_t length{0};
+    uint64_t timestamp{0};
+  };
+
+  std::vector<Slot> slots_;
+  std::vector<std::byte> data_;
+  size_t slot_size_;
+  size_t head_{0};  ///< 最舊封包的槽位
+  size_t size_{0};
+  uint64_t overwritten_{0};
+
+ public:
+  PacketBuffer(size_t capacity, size_t slot_size) noexcept
+      : slots_(std::max<size_t>(capacity, 1)),
+        data_(slots_.size() * slot_size),
+        slot_size_(slot_size) {}
+
+  /// @brief 加入封包 (已滿時覆蓋最舊者)
+  /// @return 封包超過 slot_size 時為 false (未加入)
+  bool push(uint32_t seq, uint64_t timestamp,
+            std::span<const std::byte> packet) noexcept {
+    if (packet.size() > slot_size_) [[unlikely]] {
+      return false;
+    }
+    if (size_ == slots_.size()) {
+      head_ = (head_ + 1) % slots_.size();
+      --size_;
+      ++overwritten_;
+    }
+    const size_t idx = (head_ + size_) % slots_.size();
+    slots_[idx] = Slot{.seq = seq,
+                       .length = static_cast<uint32_t>(packet.size()),
+                       .timestamp = timestamp};
+    std::memcpy(data_.data() + idx * slot_size_, packet.data(), packet.size());
+    ++size_;
+    return true;
+  }
+
+  [[nodiscard]] Entry front() const noexcept {
+    const Slot& slot = slots_[head_];
+    return Entry{.seq = slot.seq,
+                 .timestamp = slot.timestamp,
+                 .packet = std::span(data_.data() + head_ * slot_size_,
+                                     slot.length)};
+  }
+
+  void pop_front() noexcept {
+    head_ = (head_ + 1) % slots_.size();
+    --size_;
+  }
+
+  void clear() noexcept {
+    head_ = 0;
+    size_ = 0;
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+  [[nodiscard]] size_t capacity() const noexcept { return slots_.size(); }
+
+  /// @brief 因已滿而被覆蓋的封包數
+  [[nodiscard]] uint64_t overwritten() const noexcept { return overwritten_; }
+};
+
+// ----------------------------------------------------------------------------
+// ChannelRecovery
+// ----------------------------------------------------------------------------
+
+/// @brief 單一頻道的回補統計
+struct RecoveryStats {
+  uint64_t gaps{0};       ///< Live 時偵測到遺失的封包數
+  uint64_t buffered{0};   ///< 回補期間暫存的封包數
+  uint64_t oversized{0};  ///< 超過槽位大小而無法暫存的封包數
+  uint64_t snapshots{0};  ///< 已套用的快照數
+  uint64_t rejected{0};   ///< 與暫存封包之間有缺口而捨棄的快照數
+  uint64_t replayed{0};   ///< 快照後重播的暫存封包數
+};
+
+/// @brief 單一頻道的快照/增量回補狀態機
+///
+/// 狀態: Idle -> Live，或 Idle/Live -> Recovering -> Live
+/// - Idle: 尚未收到封包；第一個封包序號為 1 (開盤前即加入) 直接進入
+///   Live，否則視為盤中加入而開始回補
+/// - Live: 序號連續的封包直接套用；較舊的丟棄；跳號則開始回補
+/// - Recovering: 封包只暫存於 PacketBuffer (不套用)，等待快照。快照
+///   (內容反映到序號 S 為止) 到達後先套用快照，再依序重播暫存中序號 > S
+///   的封包，全部接上後回到 Live
+/// - 快照與暫存之間有缺口 (快照太舊，或暫存被覆蓋) 時捨棄快照並重新
+///   要求；重播途中遇到暫存內的缺口時，停在缺口前並重新要求
+///
+/// 本類別不做 I/O：呼叫端在 wants_snapshot() 時送出要求並呼叫
+/// mark_requested()，收到回應後呼叫 on_snapshot()。每個頻道各自獨立，
+/// 回補中的頻道不影響其他頻道。
+///
+/// @note Thread Safety: 非執行緒安全 (由負責該頻道的執行緒操作)
+///
+class ChannelRecovery {
+ public:
+  enum class State : uint8_t { Idle, Live, Recovering };
+
+  /// @brief on_packet() 對封包的處置
+  enum class Action : uint8_t {
+    Apply,     ///< 立即套用
+    Buffered,  ///< 已暫存，等待快照
+    Drop,      ///< 重複或過舊，丟棄
+  };
+
+  /// @brief 預設槽位大小 (1500 MTU 的最大 UDP payload)
+  static constexpr size_t kDefaultSlotSize = 1472;
+
+ private:
+  PacketBuffer buffer_;
+  State state_{State::Idle};
+  /// @brief Live: 下一個預期序號；Recovering: 下一個可暫存的序號
+  uint32_t next_seq_{0};
+  bool requested_{false};
+  RecoveryStats stats_{};
+
+ public:
+  /// @param capacity 暫存的封包數上限 (需涵蓋快照往返期間的流量)
+  /// @param slot_size 單一封包大小上限
+  explicit ChannelRecovery(size_t capacity,
+                           size_t slot_size = kDefaultSlotSize) noexcept
+      : buffer_(capacity, slot_size) {}
+
+  // ----------------------------------------------------------------------------
+  // 增量封包
+  // ----------------------------------------------------------------------------
+
+  /// @brief 判斷收到的增量封包如何處置
+  [[nodiscard]] Action on_packet(uint32_t seq, uint64_t timestamp,
+                                 std::span<const std::byte> packet) noexcept {
+    switch (state_) {
+      case State::Idle:
+        if (seq <= 1) {
+          state_ = State::Live;
+          next_seq_ = seq + 1;
+          return Action::Apply;
+        }
+        begin_recovery();
+        return buffer(seq, timestamp, packet);
+
+      case State::Live:
+        if (seq == next_seq_) [[likely]] {
+          ++next_seq_;
+          return Action::Apply;
+        }
+        if (seq < next_seq_) {
+          return Action::Drop;
+        }
+        stats_.gaps += seq - next_seq_;
+        begin_recovery();
+        return buffer(seq, timestamp, packet);
+
+      case State::Recovering:
+        if (seq < next_seq_) {
+          return Action::Drop;
+        }
+        return buffer(seq, timestamp, packet);
+    }
+    return Action::Drop;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 快照
+  // ----------------------------------------------------------------------------
+
+  /// @brief 是否需要送出快照要求
+  [[nodiscard]] bool wants_snapshot() const noexcept {
+    return state_ == State::Recovering && !requested_;
+  }
+
+  /// @brief 已送出快照要求 (回應前不再要求)
+  void mark_requested() noexcept { requested_ = true; }
+
+  /// @brief 要求失敗 (e.g. 連線中斷、服務端尚無快照)，下次
+  ///        wants_snapshot() 重新要求
+  void request_failed() noexcept { requested_ = false; }
+
+  /// @brief 處理快照回應
+  ///
+  /// @param snapshot_seq 快照內容涵蓋到的封包序號
+  /// @param apply_snapshot `apply_snapshot()`，套用快照內容
+  /// @param replay `replay(std::span<const std::byte> packet,
+  ///                       uint64_t timestamp)`，重播暫存封包
+  /// @return 快照被套用時為 true
+  template <typename SnapshotFn, typename ReplayFn>
+  bool on_snapshot(uint32_t snapshot_seq, SnapshotFn&& apply_snapshot,
+                   ReplayFn&& replay) noexcept {
+    if (state_ != State::Recovering) {
+      return false;  // 未要求或已完成回補 (過期的回應)
+    }
+    requested_ = false;
+
+    // 仍可提供的最舊序號：快照必須接得上
+    const uint32_t oldest = buffer_.empty() ? next_seq_ : buffer_.front().seq;
+    if (oldest > snapshot_seq + 1) {
+      ++stats_.rejected;
+      return false;
+    }
+
+    apply_snapshot();
+    ++stats_.snapshots;
+
+    uint32_t expected = snapshot_seq + 1;
+    while (!buffer_.empty()) {
+      const auto entry = buffer_.front();
+      if (entry.seq < expected) {
+        buffer_.pop_front();  // 已包含在快照內
+        continue;
+      }
+      if (entry.seq != expected) {
+        break;  // 暫存內有缺口
+      }
+      replay(entry.packet, entry.timestamp);
+      ++stats_.replayed;
+      ++expected;
+      buffer_.pop_front();
+    }
+
+    if (buffer_.empty() && expected >= next_seq_) {
+      state_ = State::Live;
+      next_seq_ = expected;
+    }
+    return true;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] State state() const noexcept { return state_; }
+  [[nodiscard]] uint32_t next_seq() const noexcept { return next_seq_; }
+  [[nodiscard]] size_t buffered() const noexcept { return buffer_.size(); }
+  [[nodiscard]] const RecoveryStats& stats() const noexcept { return stats_; }
+
+  /// @brief 暫存已滿而被覆蓋的封包數
+  [[nodiscard]] uint64_t overwritten() const noexcept {
+    return buffer_.overwritten();
+  }
+
+ private:
+  void begin_recovery() noexcept {
+    state_ = State::Recovering;
+    requested_ = false;
+    buffer_.clear();
+  }
+
+  Action buffer(uint32_t seq, uint64_t timestamp,
+                std::span<const std::byte> packet) noexcept {
+    if (buffer_.push(seq, timestamp, packet)) {
+      ++stats_.buffered;
+    } else {
+      ++stats_.oversized;  // 留下缺口，由快照或下一次回補補上
+    }
+    next_seq_ = seq + 1;
+    return Action::Buffered;
+  }
+};
+
+// ----------------------------------------------------------------------------
+// 工具
+// ----------------------------------------------------------------------------
+
+/// @brief 走訪連續存放的 TAIFEX 封包 (依各封包標頭的 packet_length 切割)
+/// @param fn `fn(std::span<const std::byte> packet)`
+/// @return 格式正確 (長度剛好用完) 時為 true
+template <typename Fn>
+bool for_each_packet(std::span<const std::byte> bytes, Fn&& fn) noexcept {
+  using net::taifex::PacketHeader;
+
+  size_t pos = 0;
+  while (pos + sizeof(PacketHeader) <= bytes.size()) {
+    uint16_t length;
+    std::memcpy(&length, bytes.data() + pos + offsetof(PacketHeader,
+                                                       packet_length),
+                sizeof(length));
+    length = ntohs(length);
+    if (length < sizeof(PacketHeader) || pos + length > bytes.size()) {
+      return false;
+    }
+    fn(bytes.subspan(pos, length));
+    pos += length;
+  }
+  return pos == bytes.size();
+}
+
+}  // namespace tx::feed
+
+#endif
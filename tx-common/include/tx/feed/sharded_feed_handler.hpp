@@ -0,0 +1,644 @@
+#ifndef TX_TRADING_ENGINE_FEED_SHARDED_FEED_HANDLER_HPP
+#define TX_TRADING_ENGINE_FEED_SHARDED_FEED_HANDLER_HPP
+
+#include <immintrin.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/feed/feed.hpp"
+#include "tx/feed/recovery.hpp"
+#include "tx/feed/snapshot_service.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/market/instrument_registry.hpp"
+#include "tx/market/order_book.hpp"
+#include "tx/market/prefetch.hpp"
+#include "tx/net/taifex/packet_iterator.hpp"
+#include "tx/net/taifex/parser.hpp"
+#include "tx/sync/spsc_queue.hpp"
+#include "tx/sys/cpu_affinity.hpp"
+#include "tx/sys/cpu_topology.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::feed {
+
+// ----------------------------------------------------------------------------
+// 正規化事件
+// ----------------------------------------------------------------------------
+
+/// @brief shard 發布給下游的行情事件
+///
+/// 帶有更新後的最佳一檔與最新成交，下游不需 (也不可) 讀取 shard 內部的
+/// OrderBook。
+struct MarketEvent {
+  enum class Kind : uint8_t { Book, Trade };
+
+  uint64_t timestamp{0};               ///< 收包時間 (feed 的時間戳)
+  market::InstrumentId instrument{0};  ///< 商品索引
+  uint32_t sequence{0};                ///< 來源封包的 pkt_seq_num
+  uint16_t channel{0};                 ///< 來源頻道
+  uint16_t changed{0};                 ///< OrderBook 變動遮罩
+  Kind kind{Kind::Book};               ///< 觸發的訊息種類
+  market::BookLevel bid{};             ///< 更新後的買方第一檔
+  market::BookLevel ask{};             ///< 更新後的賣方第一檔
+  core::Price last_price = core::Price::invalid();
+  core::Quantity last_qty = core::Quantity::zero();
+};
+
+/// @brief 單一 shard 的統計
+struct ShardStats {
+  uint64_t packets{0};          ///< 通過仲裁的封包數
+  uint64_t duplicates{0};       ///< 仲裁丟棄的封包數 (另一條線已收到或過舊)
+  uint64_t gaps{0};             ///< 序號跳號遺失的封包數 (未啟用回補時)
+  uint64_t buffered{0};         ///< 回補期間暫存、尚未套用的封包數
+  uint64_t recoveries{0};       ///< 套用的快照數
+  uint64_t invalid{0};          ///< 格式錯誤或頻道不符的封包數
+  uint64_t events{0};           ///< 發布到 ring 的事件數
+  uint64_t ring_full{0};        ///< ring 已滿而等待的次數 (下游過慢)
+  uint64_t foreign{0};          ///< 商品已屬於其他 shard 而略過的訊息數
+  uint64_t feed_errors{0};      ///< 線路 poll() 回傳錯誤的次數
+  uint64_t snapshot_misses{0};  ///< 服務端沒有快照 (status != 0) 的回應數
+  std::error_code last_error;   ///< 最近一次線路錯誤
+};
+
+// ----------------------------------------------------------------------------
+// ShardedFeedHandler
+// ----------------------------------------------------------------------------
+
+/// @brief 依頻道分片到多顆核心的行情處理器
+///
+/// TAIFEX 將商品分散在多個 multicast 頻道。每個頻道固定分配給一個
+/// shard (收包執行緒)，shard 在自己的核心上完成該頻道的收包、A/B 線仲裁、
+/// 解碼與 book 更新，再把 MarketEvent 寫入自己的 SPSC ring；下游以
+/// poll() 合併所有 ring。
+/// - 仲裁: 以 (頻道, pkt_seq_num) 判斷，先到者生效，較舊或重複的封包丟棄，
+///   序號跳號計入 gaps
+/// - 順序: 每個商品只由一個 shard 處理 (第一次出現時登記擁有者)，
+///   而單一 ring 為 FIFO，因此合併後同一商品的事件順序與交易所一致；
+///   不同商品之間不保證順序
+/// - 配置: start() 未指定 CPU 時以 sys::CpuTopology::select() 挑選
+///   (每顆實體核心一個 shard，避開 SMT sibling 與 CPU 0)；以
+///   set_interface() 指定收包網卡後優先使用網卡所在 NUMA node 的核心
+/// - 頻道依加入順序輪流分配，開盤流量最大的頻道應先加入
+/// - 回補: enable_recovery() 後每個頻道各有一個 ChannelRecovery，盤中
+///   加入或跳號時該頻道的封包改為暫存，並由所屬 shard 的 SnapshotClient
+///   以非阻塞 TCP 要求快照；快照套用並重播暫存後恢復即時處理。
+///   回補只影響該頻道，同一 shard 的其他頻道照常處理。服務端尚無快照
+///   (status != 0) 時，間隔 retry_interval 後重新要求
+///
+/// @tparam Feed 單條線路的封包來源 (feed::PacketFeed)
+/// @tparam MaxInstruments 商品數量上限
+/// @tparam RingCapacity 每個 shard ring 的容量 (2 的冪次)
+/// @note Thread Safety: subscribe()/add_channel()/assign()/start()/stop()
+///       在控制執行緒呼叫；poll() 只能由單一下游執行緒呼叫
+///
+template <PacketFeed Feed, size_t MaxInstruments = 1024,
+          size_t RingCapacity = 65536>
+class ShardedFeedHandler {
+ public:
+  using Registry = market::InstrumentRegistry<MaxInstruments>;
+  using Ring = sync::SPSCQueue<MarketEvent, RingCapacity>;
+
+  static constexpr uint16_t kUnowned = UINT16_MAX;
+  static constexpr size_t kDefaultBurst = 64;
+  /// @brief 每個頻道預設暫存的封包數
+  static constexpr size_t kDefaultRecoveryBuffer = 4096;
+  /// @brief 服務端沒有快照時，重新要求前的預設等待時間 (奈秒)
+  static constexpr uint64_t kDefaultSnapshotRetry = 100'000'000;
+
+ private:
+  /// @brief 一個頻道 (一或兩條線路)
+  struct Channel {
+    uint16_t id{0};
+    std::vector<Feed> lines;  ///< A/B 線 (同內容的備援 multicast)
+    uint32_t next_seq{0};     ///< 下一個預期序號
+    bool started{false};      ///< 是否已收到第一個封包
+    std::optional<ChannelRecovery> recovery;  ///< 啟用回補時取代上面的仲裁
+    uint64_t last_timestamp{0};               ///< 最近一個封包的時間戳
+    uint64_t retry_at{0};                     ///< 被拒後可再要求的時間 (TSC)
+  };
+
+  /// @brief 一個收包執行緒的全部狀態 (只由該執行緒存取)
+  struct Shard {
+    size_t cpu{0};
+    std::vector<Channel*> channels;
+    std::unique_ptr<std::array<market::OrderBook, MaxInstruments>> books =
+        std::make_unique<std::array<market::OrderBook, MaxInstruments>>();
+    ShardStats stats{};
+    std::optional<SnapshotClient> snapshots;  ///< 啟用回補時的快照連線
+    Ring ring;
+  };
+
+  Registry registry_;
+  std::vector<std::unique_ptr<Channel>> channels_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::unique_ptr<std::atomic<uint16_t>[]> owners_;  ///< 商品 -> shard
+  std::optional<io::SocketAddress> recovery_service_;
+  size_t recovery_buffer_{0};
+  uint64_t snapshot_retry_ns_{kDefaultSnapshotRetry};
+  int numa_node_{-1};  ///< 收包網卡所在 NUMA node (-1 = 不限)
+
+  std::vector<std::thread> threads_;
+  std::atomic<bool> stop_{true};  ///< 未 start() 時為 true
+  std::atomic<size_t> pin_failures_{0};
+  std::atomic<size_t> feed_errors_{0};  ///< 所有 shard 的線路錯誤總數
+  size_t next_shard_{0};  ///< poll() 下一輪起始的 shard
+
+ public:
+  // ----------------------------------------------------------------------------
+  // 建構函數
+  // ----------------------------------------------------------------------------
+
+  ShardedFeedHandler() noexcept
+      : owners_(std::make_unique<std::atomic<uint16_t>[]>(MaxInstruments)) {
+    for (size_t i = 0; i < MaxInstruments; ++i) {
+      owners_[i].store(kUnowned, std::memory_order_relaxed);
+    }
+  }
+
+  ~ShardedFeedHandler() noexcept { stop(); }
+  ShardedFeedHandler(const ShardedFeedHandler&) = delete;
+  ShardedFeedHandler& operator=(const ShardedFeedHandler&) = delete;
+  ShardedFeedHandler(ShardedFeedHandler&&) = delete;
+  ShardedFeedHandler& operator=(ShardedFeedHandler&&) = delete;
+
+  // ----------------------------------------------------------------------------
+  // 設定 (start() 之前)
+  // ----------------------------------------------------------------------------
+
+  /// @brief 訂閱商品 (未訂閱的商品訊息直接略過)
+  [[nodiscard]] Result<market::InstrumentId> subscribe(
+      std::string_view prod_id) noexcept {
+    return registry_.add(prod_id);
+  }
+
+  /// @brief 加入單線頻道
+  Result<> add_channel(uint16_t channel_id, Feed line) noexcept {
+    auto* ch = TRY(new_channel(channel_id));
+    ch->lines.push_back(std::move(line));
+    return {};
+  }
+
+  /// @brief 加入 A/B 雙線頻道 (以序號仲裁)
+  Result<> add_channel(uint16_t channel_id, Feed line_a, Feed line_b) noexcept {
+    auto* ch = TRY(new_channel(channel_id));
+    ch->lines.push_back(std::move(line_a));
+    ch->lines.push_back(std::move(line_b));
+    return {};
+  }
+
+  /// @brief 啟用快照/增量回補
+  /// @param service 快照回補服務地址 (SnapshotServer 或交易所的替代服務)
+  /// @param buffer_packets 每個頻道回補期間暫存的封包數上限
+  /// @param retry_interval 服務端沒有快照時，重新要求前的等待 (奈秒)
+  /// @note 需先呼叫 sys::TSCTimer::calibrate()
+  Result<> enable_recovery(
+      const io::SocketAddress& service,
+      size_t buffer_packets = kDefaultRecoveryBuffer,
+      uint64_t retry_interval = kDefaultSnapshotRetry) noexcept {
+    if (!threads_.empty()) {
+      return tx::fail(std::errc::operation_in_progress, "Handler running");
+    }
+    recovery_service_ = service;
+    recovery_buffer_ = buffer_packets;
+    snapshot_retry_ns_ = retry_interval;
+    return {};
+  }
+
+  /// @brief 指定收包網卡，start() 挑選 CPU 時優先使用其 NUMA node
+  /// @param interface 網卡名稱 (e.g. "eth0")；node 未知時不限 node
+  Result<> set_interface(std::string_view interface) noexcept {
+    return set_numa_node(sys::CpuTopology::interface_node(interface));
+  }
+
+  /// @brief 直接指定 start() 優先使用的 NUMA node (-1 = 不限)
+  Result<> set_numa_node(int node) noexcept {
+    if (!threads_.empty()) {
+      return tx::fail(std::errc::operation_in_progress, "Handler running");
+    }
+    numa_node_ = node;
+    return {};
+  }
+
+  /// @brief 依拓樸與設定的 NUMA node 挑選 shard CPU (每個頻道最多一顆)
+  [[nodiscard]] std::vector<size_t> select_cpus(
+      std::span<const sys::CpuInfo> topology) const noexcept {
+    return sys::CpuTopology::select(topology, channels_.size(), numa_node_);
+  }
+
+  /// @brief 將頻道分配給 shard (每顆 CPU 一個，最多與頻道數相同)
+  ///
+  /// 單獨呼叫 (不 start()) 時可由呼叫端以 poll_shard() 自行驅動。
+  Result<> assign(std::span<const size_t> cpus) noexcept {
+    if (!threads_.empty()) {
+      return tx::fail(std::errc::operation_in_progress, "Handler running");
+    }
+    if (cpus.empty() || channels_.empty()) {
+      return tx::fail(std::errc::invalid_argument, "No CPU or channel");
+    }
+
+    const size_t count = std::min(cpus.size(), channels_.size());
+    shards_.clear();
+    for (size_t i = 0; i < MaxInstruments; ++i) {
+      owners_[i].store(kUnowned, std::memory_order_relaxed);
+    }
+    for (size_t s = 0; s < count; ++s) {
+      auto shard = std::make_unique<Shard>();
+      shard->cpu = cpus[s];
+      if (recovery_service_) {
+        shard->snapshots.emplace(*recovery_service_);
+      }
+      shards_.push_back(std::move(shard));
+    }
+    for (size_t c = 0; c < channels_.size(); ++c) {
+      Channel& ch = *channels_[c];
+      ch.started = false;
+      if (recovery_service_) {
+        ch.recovery.emplace(recovery_buffer_);
+      }
+      shards_[c % count]->channels.push_back(&ch);
+    }
+    return {};
+  }
+
+  // ----------------------------------------------------------------------------
+  // 執行
+  // ----------------------------------------------------------------------------
+
+  /// @brief 依拓樸挑選 CPU 後啟動 (每個頻道最多一個 shard)
+  /// @see select_cpus()
+  Result<> start() noexcept {
+    return start(select_cpus(sys::CpuTopology::detect()));
+  }
+
+  /// @brief 分配頻道並啟動收包執行緒 (各自綁定到 cpus[i])
+  Result<> start(std::span<const size_t> cpus) noexcept {
+    CHECK(assign(cpus));
+
+    stop_.store(false, std::memory_order_relaxed);
+    threads_.reserve(shards_.size());
+    for (size_t s = 0; s < shards_.size(); ++s) {
+      threads_.emplace_back([this, s] { shard_loop(s); });
+    }
+    return {};
+  }
+
+  /// @brief 停止並等待收包執行緒結束 (ring 中剩餘事件仍可 poll())
+  void stop() noexcept {
+    stop_.store(true, std::memory_order_relaxed);
+    for (auto& t : threads_) {
+      if (t.joinable()) t.join();
+    }
+    threads_.clear();
+  }
+
+  /// @brief 執行 shard 的一輪收包 (shard 執行緒內部，或未 start() 時)
+  ///
+  /// 線路錯誤不中斷其他線路 (A/B 備援仍可能正常)，計入 stats().feed_errors
+  /// 與 feed_errors()，由擁有者決定是否停止。
+  ///
+  /// @return 處理的封包數 (含仲裁丟棄)
+  size_t poll_shard(size_t s) noexcept {
+    Shard& shard = *shards_[s];
+    size_t packets = 0;
+    for (Channel* ch : shard.channels) {
+      for (Feed& line : ch->lines) {
+        auto n = line.poll(
+            [&](std::span<const std::byte> packet, uint64_t timestamp) {
+              on_packet(shard, static_cast<uint16_t>(s), *ch, packet,
+                        timestamp);
+            });
+        if (!n) [[unlikely]] {
+          on_feed_error(shard, n.error());
+          continue;
+        }
+        packets += *n;
+      }
+    }
+    if (shard.snapshots) {
+      service_recovery(shard, static_cast<uint16_t>(s));
+    }
+    return packets;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 下游合併
+  // ----------------------------------------------------------------------------
+
+  /// @brief 輪流取出各 shard ring 中的事件
+  ///
+  /// @param sink `sink(const MarketEvent&)`
+  /// @param burst 每個 shard 單次最多取出的事件數
+  /// @return 取出的事件數
+  template <typename Sink>
+  size_t poll(Sink&& sink, size_t burst = kDefaultBurst) noexcept {
+    size_t total = 0;
+    const size_t count = shards_.size();
+    for (size_t i = 0; i < count; ++i) {
+      Ring& ring = shards_[(next_shard_ + i) % count]->ring;
+      MarketEvent event;
+      for (size_t n = 0; n < burst && ring.try_pop(event); ++n) {
+        sink(event);
+        ++total;
+      }
+    }
+    if (count > 0) {
+      next_shard_ = (next_shard_ + 1) % count;
+    }
+    return total;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] const Registry& registry() const noexcept { return registry_; }
+  [[nodiscard]] size_t shard_count() const noexcept { return shards_.size(); }
+  [[nodiscard]] size_t shard_cpu(size_t s) const noexcept {
+    return shards_[s]->cpu;
+  }
+
+  /// @brief shard 負責的頻道編號
+  [[nodiscard]] std::vector<uint16_t> shard_channels(size_t s) const {
+    std::vector<uint16_t> ids;
+    for (const Channel* ch : shards_[s]->channels) ids.push_back(ch->id);
+    return ids;
+  }
+
+  /// @brief 商品所屬的 shard，尚未出現過為 kUnowned
+  [[nodiscard]] uint16_t owner(market::InstrumentId id) const noexcept {
+    return owners_[id].load(std::memory_order_relaxed);
+  }
+
+  /// @brief 頻道的回補狀態機 (未啟用回補或無此頻道為 nullptr)
+  /// @note 與 stats() 相同，stop() 後或於 shard 執行緒讀取
+  [[nodiscard]] const ChannelRecovery* recovery(
+      uint16_t channel_id) const noexcept {
+    for (const auto& ch : channels_) {
+      if (ch->id == channel_id && ch->recovery) return &*ch->recovery;
+    }
+    return nullptr;
+  }
+
+  /// @brief shard 統計 (stop() 後或於 shard 執行緒讀取)
+  [[nodiscard]] const ShardStats& stats(size_t s) const noexcept {
+    return shards_[s]->stats;
+  }
+
+  /// @brief 所有 shard 的線路錯誤總數 (可於任意執行緒讀取)
+  ///
+  /// 擁有者定期檢查：持續增加表示線路中斷 (e.g. 網卡或 multicast 被移除)，
+  /// 應 stop() 並切換備援；細節見 stop() 後的 stats().last_error。
+  [[nodiscard]] size_t feed_errors() const noexcept {
+    return feed_errors_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief 綁定 CPU 失敗的 shard 數 (失敗時仍會以未綁定狀態執行)
+  [[nodiscard]] size_t pin_failures() const noexcept {
+    return pin_failures_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  Result<Channel*> new_channel(uint16_t channel_id) noexcept {
+    if (!threads_.empty()) {
+      return tx::fail(std::errc::operation_in_progress, "Handler running");
+    }
+    for (const auto& ch : channels_) {
+      if (ch->id == channel_id) {
+        return tx::fail(std::errc::file_exists, "Duplicate channel");
+      }
+    }
+    auto ch = std::make_unique<Channel>();
+    ch->id = channel_id;
+    channels_.push_back(std::move(ch));
+    return channels_.back().get();
+  }
+
+  void shard_loop(size_t s) noexcept {
+    if (!sys::CPUAffinity::pin_to_cpu(shards_[s]->cpu)) {
+      pin_failures_.fetch_add(1, std::memory_order_relaxed);
+    }
+    while (!stop_.load(std::memory_order_relaxed)) {
+      if (poll_shard(s) == 0) {
+        _mm_pause();
+      }
+    }
+  }
+
+  void on_feed_error(Shard& shard, std::error_code error) noexcept {
+    ++shard.stats.feed_errors;
+    shard.stats.last_error = error;
+    feed_errors_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// @brief A/B 仲裁：回傳 false 表示丟棄
+  [[nodiscard]] static bool arbitrate(Shard& shard, Channel& ch,
+                                      uint32_t seq) noexcept {
+    if (ch.started && seq < ch.next_seq) {
+      ++shard.stats.duplicates;
+      return false;
+    }
+    if (ch.started && seq > ch.next_seq) {
+      shard.stats.gaps += seq - ch.next_seq;
+    }
+    ch.started = true;
+    ch.next_seq = seq + 1;
+    return true;
+  }
+
+  void on_packet(Shard& shard, uint16_t s, Channel& ch,
+                 std::span<const std::byte> packet,
+                 uint64_t timestamp) noexcept {
+    auto it = net::taifex::PacketIterator::from(packet);
+    if (!it || it->header().channel_id != ch.id) [[unlikely]] {
+      ++shard.stats.invalid;
+      return;
+    }
+    const uint32_t seq = it->header().pkt_seq_num;
+    ch.last_timestamp = timestamp;
+
+    if (ch.recovery) {
+      switch (ch.recovery->on_packet(seq, timestamp, packet)) {
+        case ChannelRecovery::Action::Apply:
+          break;
+        case ChannelRecovery::Action::Buffered:
+          ++shard.stats.buffered;
+          return;
+        case ChannelRecovery::Action::Drop:
+          ++shard.stats.duplicates;
+          return;
+      }
+    } else if (!arbitrate(shard, ch, seq)) {
+      return;
+    }
+    ++shard.stats.packets;
+    decode(shard, s, ch, *it, seq, timestamp);
+  }
+
+  /// @brief 送出快照要求、處理快照回應 (每輪 poll_shard() 一次)
+  void service_recovery(Shard& shard, uint16_t s) noexcept {
+    uint64_t now = 0;  // 只在有頻道需要要求時讀取 TSC
+    for (Channel* ch : shard.channels) {
+      if (!ch->recovery->wants_snapshot()) continue;
+      if (now == 0) now = sys::TSCTimer::now();
+      if (now < ch->retry_at) continue;
+      shard.snapshots->request(ch->id);
+      ch->recovery->mark_requested();
+    }
+
+    const auto find = [&shard](uint16_t channel_id) -> Channel* {
+      for (Channel* ch : shard.channels) {
+        if (ch->id == channel_id) return ch;
+      }
+      return nullptr;
+    };
+
+    // 連線錯誤時 SnapshotClient 已斷線，未回應的要求會在重連後重送
+    (void)shard.snapshots->poll(
+        [&](uint16_t channel_id, uint32_t snapshot_seq,
+            std::span<const std::byte> packets) {
+          if (Channel* ch = find(channel_id)) {
+            apply_snapshot(shard, s, *ch, snapshot_seq, packets);
+          }
+        },
+        [&](uint16_t channel_id, uint16_t /*status*/) {
+          // 服務端尚無快照 (e.g. 剛開盤)：等待後重新要求，否則頻道會
+          // 永遠停在回補狀態
+          ++shard.stats.snapshot_misses;
+          if (Channel* ch = find(channel_id)) {
+            ch->recovery->request_failed();
+            ch->retry_at = sys::TSCTimer::now() +
+                           sys::TSCTimer::ns_to_cycles(snapshot_retry_ns_);
+          }
+        });
+  }
+
+  void apply_snapshot(Shard& shard, uint16_t s, Channel& ch,
+                      uint32_t snapshot_seq,
+                      std::span<const std::byte> packets) noexcept {
+    const uint64_t timestamp = ch.last_timestamp;
+    const bool applied = ch.recovery->on_snapshot(
+        snapshot_seq,
+        [&] {
+          for_each_packet(packets, [&](std::span<const std::byte> packet) {
+            auto it = net::taifex::PacketIterator::from(packet);
+            if (it) {
+              decode(shard, s, ch, *it, snapshot_seq, timestamp);
+            }
+          });
+        },
+        [&](std::span<const std::byte> packet, uint64_t buffered_ts) {
+          auto it = net::taifex::PacketIterator::from(packet);
+          if (it) {
+            --shard.stats.buffered;
+            ++shard.stats.packets;
+            decode(shard, s, ch, *it, it->header().pkt_seq_num, buffered_ts);
+          }
+        });
+    if (applied) {
+      ++shard.stats.recoveries;
+    }
+  }
+
+  /// @brief 解碼封包內的訊息、更新 book 並發布事件
+  void decode(Shard& shard, uint16_t s, const Channel& ch,
+              net::taifex::PacketIterator& it, uint32_t seq,
+              uint64_t timestamp) noexcept {
+    using namespace net::taifex;
+
+    market::for_each_prefetched(
+        it,
+        [this](const MessageView& msg) {
+          return market::resolve_instrument(registry_, msg);
+        },
+        [&shard](market::InstrumentId id) {
+          market::prefetch_for_write((*shard.books)[id]);
+        },
+        [&](const MessageView& msg, market::InstrumentId id) {
+          if (!claim(id, s)) {
+            ++shard.stats.foreign;
+            return;
+          }
+          decode_message(shard, ch, msg, id, seq, timestamp);
+        });
+  }
+
+  void decode_message(Shard& shard, const Channel& ch,
+                      const net::taifex::MessageView& msg,
+                      market::InstrumentId id, uint32_t seq,
+                      uint64_t timestamp) noexcept {
+    using namespace net::taifex;
+
+    market::OrderBook& book = (*shard.books)[id];
+    MarketEvent event{.timestamp = timestamp,
+                      .instrument = id,
+                      .sequence = seq,
+                      .channel = ch.id};
+    if (msg.msg_type == '6') {
+      auto snap = parse_r06_snapshot(msg.bytes);
+      if (!snap) [[unlikely]] {
+        return;
+      }
+      event.changed = book.apply(*snap);
+      event.kind = MarketEvent::Kind::Book;
+    } else if (msg.msg_type == '2') {
+      auto trade = parse_r02_trade(msg.bytes);
+      if (!trade) [[unlikely]] {
+        return;
+      }
+      event.changed = book.apply(*trade);
+      event.kind = MarketEvent::Kind::Trade;
+    } else {
+      return;
+    }
+
+    event.bid = book.best_bid();
+    event.ask = book.best_ask();
+    event.last_price = book.last_price();
+    event.last_qty = book.last_qty();
+    publish(shard, event);
+  }
+
+  /// @brief 登記或確認商品的擁有者 shard
+  [[nodiscard]] bool claim(market::InstrumentId id, uint16_t s) noexcept {
+    uint16_t owner = owners_[id].load(std::memory_order_relaxed);
+    if (owner == s) [[likely]] {
+      return true;
+    }
+    if (owner == kUnowned &&
+        owners_[id].compare_exchange_strong(owner, s,
+                                            std::memory_order_relaxed)) {
+      return true;
+    }
+    return owner == s;
+  }
+
+  /// @brief 寫入 ring；已滿時等待下游 (行情不可丟，背壓回到 socket buffer)
+  /// @note 未 start() (由呼叫端 poll_shard()) 時無法等待，ring 已滿即丟棄
+  void publish(Shard& shard, const MarketEvent& event) noexcept {
+    while (!shard.ring.try_push(event)) {
+      ++shard.stats.ring_full;
+      if (stop_.load(std::memory_order_relaxed)) {
+        return;
+      }
+      _mm_pause();
+    }
+    ++shard.stats.events;
+  }
+};
+
+}  // namespace tx::feed
+
+#endif
@@ -0,0 +1,246 @@
+#ifndef TX_TRADING_ENGINE_FEED_SNAPSHOT_SERVICE_HPP
+#define TX_TRADING_ENGINE_FEED_SNAPSHOT_SERVICE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/tcp_socket.hpp"
+
+namespace tx::feed {
+
+// ----------------------------------------------------------------------------
+// Wire Format
+// ----------------------------------------------------------------------------
+
+/// @brief 快照要求 (client -> server)
+/// @note 使用 host byte order，僅供本機 / 同架構的回補服務
+struct SnapshotRequest {
+  uint16_t channel;   ///< 頻道編號
+  uint16_t reserved;  ///< 保留 (0)
+};
+static_assert(sizeof(SnapshotRequest) == 4);
+
+/// @brief 快照回應標頭 (server -> client)，後接 length bytes 的封包內容
+struct SnapshotHeader {
+  uint16_t channel;  ///< 頻道編號
+  uint16_t status;   ///< 0 = 成功，其餘為無此頻道 (length 為 0)
+  uint32_t seq;      ///< 快照內容涵蓋到的封包序號
+  uint32_t length;   ///< 內容長度 (連續的 TAIFEX 封包)
+};
+static_assert(sizeof(SnapshotHeader) == 12);
+
+/// @brief 服務端提供的單一頻道快照
+struct Snapshot {
+  uint32_t seq{0};                 ///< 涵蓋到的封包序號
+  std::vector<std::byte> packets;  ///< 連續的 TAIFEX 封包 (通常為 R06)
+};
+
+// ----------------------------------------------------------------------------
+// SnapshotClient
+// ----------------------------------------------------------------------------
+
+/// @brief 非阻塞的快照回補 client
+///
+/// 由收包執行緒在每輪 poll 中驅動：request() 只排入要求，連線 (非阻塞
+/// connect)、送出與接收都在 poll() 內以非阻塞 I/O 推進，不會讓其他頻道
+/// 的即時處理停下來。
+/// - 連線中斷時尚未回應的要求會在重新連線後重送；連線失敗後至少間隔
+///   retry_interval 才重試
+/// - 接收緩衝區在建構時配置 (max_snapshot)，超過的回應視為錯誤並斷線
+///
+/// @note Thread Safety: 非執行緒安全
+///
+class SnapshotClient {
+ public:
+  static constexpr size_t kDefaultMaxSnapshot = 1U << 20;
+
+ private:
+  io::SocketAddress server_;
+  std::optional<io::TcpSocket> socket_;
+  bool connecting_{false};
+  uint64_t retry_interval_ns_;
+  uint64_t retry_at_{0};  ///< 下一次可重試連線的時間 (TSC)
+
+  std::vector<uint16_t> outstanding_;  ///< 已要求、尚未回應的頻道
+  std::vector<std::byte> out_;         ///< 待送出的要求
+  size_t out_pos_{0};
+  std::vector<std::byte> in_;          ///< 已收到、尚未處理的位元組
+  size_t in_size_{0};
+
+ public:
+  /// @param server 回補服務地址
+  /// @param max_snapshot 單一快照內容的大小上限
+  /// @param retry_interval 連線失敗後的重試間隔 (奈秒)
+  explicit SnapshotClient(const io::SocketAddress& server,
+                          size_t max_snapshot = kDefaultMaxSnapshot,
+                          uint64_t retry_interval = 100'000'000) noexcept
+      : server_(server),
+        retry_interval_ns_(retry_interval),
+        in_(sizeof(SnapshotHeader) + max_snapshot) {}
+
+  /// @brief 要求頻道快照 (重複要求同一頻道只送一次)
+  void request(uint16_t channel) noexcept;
+
+  /// @brief 推進連線與 I/O，交出完整的快照回應
+  ///
+  /// @param sink `sink(uint16_t channel, uint32_t seq,
+  ///                   std::span<const std::byte> packets)`
+  /// @param unavailable `unavailable(uint16_t channel, uint16_t status)`，
+  ///        服務端沒有該頻道快照 (status != 0) 時呼叫；要求已結束，
+  ///        呼叫端需自行再次 request()
+  /// @return 交出的快照數或錯誤 (錯誤時已斷線，未回應的要求會保留)
+  template <typename Sink, typename Unavailable>
+  Result<size_t> poll(Sink&& sink, Unavailable&& unavailable) noexcept {
+    CHECK(progress());
+
+    size_t delivered = 0;
+    size_t pos = 0;
+    while (in_size_ - pos >= sizeof(SnapshotHeader)) {
+      SnapshotHeader hdr;
+      std::memcpy(&hdr, in_.data() + pos, sizeof(hdr));
+      if (hdr.length > in_.size() - sizeof(SnapshotHeader)) [[unlikely]] {
+        disconnect();
+        return tx::fail(std::errc::message_size, "Snapshot too large");
+      }
+      if (in_size_ - pos < sizeof(hdr) + hdr.length) {
+        break;
+      }
+
+      std::erase(outstanding_, hdr.channel);
+      if (hdr.status == 0) {
+        sink(hdr.channel, hdr.seq,
+             std::span<const std::byte>(in_.data() + pos + sizeof(hdr),
+                                        hdr.length));
+        ++delivered;
+      } else {
+        unavailable(hdr.channel, hdr.status);
+      }
+      pos += sizeof(hdr) + hdr.length;
+    }
+
+    if (pos > 0) {
+      std::memmove(in_.data(), in_.data() + pos, in_size_ - pos);
+      in_size_ -= pos;
+    }
+    return delivered;
+  }
+
+  /// @brief 同上，忽略沒有快照的回應
+  template <typename Sink>
+  Result<size_t> poll(Sink&& sink) noexcept {
+    return poll(std::forward<Sink>(sink), [](uint16_t, uint16_t) {});
+  }
+
+  [[nodiscard]] bool is_connected() const noexcept {
+    return socket_.has_value() && !connecting_;
+  }
+
+  /// @brief 尚未回應的要求數
+  [[nodiscard]] size_t outstanding() const noexcept {
+    return outstanding_.size();
+  }
+
+ private:
+  // 以下實作於 snapshot_service.cpp
+  Result<> progress() noexcept;
+  Result<> start_connect() noexcept;
+  void disconnect() noexcept;
+};
+
+// ----------------------------------------------------------------------------
+// SnapshotServer
+// ----------------------------------------------------------------------------
+
+/// @brief 本機替代的快照回補服務 (測試與開發環境)
+///
+/// 代替交易所的 TCP 回補服務：接受連線、讀取 SnapshotRequest，並以
+/// provider 提供的內容回應。全部以非阻塞 I/O 在 poll() 中完成，可放在
+/// 測試執行緒的迴圈或獨立執行緒中驅動。
+///
+/// @note Thread Safety: 非執行緒安全
+///
+class SnapshotServer {
+ private:
+  io::TcpSocket listener_;
+  std::vector<io::TcpSocket> clients_;
+  std::vector<std::vector<std::byte>> pending_;  ///< 各 client 未完整的要求
+
+  explicit SnapshotServer(io::TcpSocket listener) noexcept
+      : listener_(std::move(listener)) {}
+
+ public:
+  /// @brief 在 address 上監聽 (port 0 = 自動分配)
+  [[nodiscard]] static Result<SnapshotServer> create(
+      const io::SocketAddress& address) noexcept;
+
+  /// @brief 接受新連線並回應已收到的要求
+  ///
+  /// @param provider `std::optional<Snapshot> provider(uint16_t channel)`，
+  ///                 nullopt 表示無此頻道
+  /// @return 回應的要求數或錯誤
+  template <typename Provider>
+  Result<size_t> poll(Provider&& provider) noexcept {
+    CHECK(accept_pending());
+
+    size_t served = 0;
+    for (size_t i = 0; i < clients_.size();) {
+      std::vector<uint16_t> channels;
+      bool alive = read_requests(i, channels);
+
+      for (size_t c = 0; alive && c < channels.size(); ++c) {
+        std::optional<Snapshot> snap = provider(channels[c]);
+        SnapshotHeader hdr{.channel = channels[c],
+                           .status = snap ? uint16_t{0} : uint16_t{1},
+                           .seq = snap ? snap->seq : 0,
+                           .length = snap ? static_cast<uint32_t>(
+                                                snap->packets.size())
+                                          : 0};
+        alive = send_all(clients_[i], std::as_bytes(std::span(&hdr, 1))) &&
+                (!snap || send_all(clients_[i], snap->packets));
+        served += alive ? 1 : 0;
+      }
+
+      if (!alive) {
+        clients_.erase(clients_.begin() + static_cast<ptrdiff_t>(i));
+        pending_.erase(pending_.begin() + static_cast<ptrdiff_t>(i));
+        continue;
+      }
+      ++i;
+    }
+    return served;
+  }
+
+  [[nodiscard]] Result<io::SocketAddress> local_address() const noexcept {
+    return listener_.local_address();
+  }
+
+  /// @brief 目前的連線數
+  [[nodiscard]] size_t client_count() const noexcept { return clients_.size(); }
+
+  /// @brief 關閉所有 client 連線 (模擬服務端斷線)
+  void drop_clients() noexcept {
+    clients_.clear();
+    pending_.clear();
+  }
+
+ private:
+  // 以下實作於 snapshot_service.cpp
+  Result<> accept_pending() noexcept;
+  /// @return 連線仍有效時為 true
+  bool read_requests(size_t index, std::vector<uint16_t>& channels) noexcept;
+  /// @return 全部送出時為 true (失敗表示連線已中斷)
+  static bool send_all(io::TcpSocket& socket,
+                       std::span<const std::byte> data) noexcept;
+};
+
+}  // namespace tx::feed
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef TX_TRADING_ENGINE_FEED_UDP_FEED_HPP
+#define TX_TRADING_ENGINE_FEED_UDP_FEED_HPP
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#include "tx/error.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/udp_socket.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::feed {
+
+/// @brief 即時行情來源 (UDP Multicast)
+///
+/// 以非阻塞 socket 收包，poll() 在 EAGAIN 或達到單次上限時返回，
+/// 讓 event loop 可以穿插處理 timer 與回報。
+/// 封包時間戳為收包當下的 TSC cycle (與 sys::TscClock 同單位)。
+///
+class UdpFeed {
+ public:
+  static constexpr size_t kMaxDatagramSize = 65536;
+  static constexpr size_t kDefaultBurst = 64;  ///< 單次 poll() 最多收包數
+
+ private:
+  io::UdpSocket socket_;
+  size_t burst_;
+  std::array<std::byte, kMaxDatagramSize> buffer_;
+
+  UdpFeed(io::UdpSocket socket, size_t burst) noexcept
+      : socket_(std::move(socket)), burst_(burst) {}
+
+ public:
+  // ==================================
+  // Factory Methods
+  // ==================================
+
+  /// @brief 綁定並加入 Multicast group
+  /// @param group Multicast 地址與埠號 (e.g. "239.1.1.1:10000")
+  /// @param interface_addr 網卡地址 (0.0.0.0 = 自動選擇)
+  /// @param burst 單次 poll() 最多處理封包數
+  static Result<UdpFeed> join(const io::SocketAddress& group,
+                              const io::SocketAddress& interface_addr =
+                                  io::SocketAddress::any_ipv4(0),
+                              size_t burst = kDefaultBurst) noexcept {
+    auto socket =
+        TRY(io::UdpSocket::bind(io::SocketAddress::any_ipv4(group.port())));
+    CHECK(socket.join_multicast_group(group, interface_addr));
+    CHECK(socket.set_nonblocking(true));
+    return UdpFeed(std::move(socket), burst);
+  }
+
+  /// @brief 由已設定好的 socket 建立 (e.g. unicast 測試)
+  static Result<UdpFeed> from_socket(io::UdpSocket socket,
+                                     size_t burst = kDefaultBurst) noexcept {
+    CHECK(socket.set_nonblocking(true));
+    return UdpFeed(std::move(socket), burst);
+  }
+
+  // ==================================
+  // RAII 管理
+  // ==================================
+  ~UdpFeed() noexcept = default;
+  UdpFeed(const UdpFeed&) = delete;
+  UdpFeed& operator=(const UdpFeed&) = delete;
+  UdpFeed(UdpFeed&&) = default;
+  UdpFeed& operator=(UdpFeed&&) = default;
+
+  // ==================================
+  // 操作
+  // ==================================
+
+  /// @brief 收取目前可用的封包
+  /// @return 處理的封包數或錯誤 (EAGAIN 不視為錯誤)
+  template <typename Sink>
+  Result<size_t> poll(Sink&& sink) noexcept {
+    size_t n = 0;
+    while (n < burst_) {
+      auto len = socket_.recvfrom(buffer_);
+      if (!len) {
+        if (len.error() == std::errc::resource_unavailable_try_again) {
+          break;
+        }
+        return std::unexpected(len.error());
+      }
+      sink(std::span<const std::byte>(buffer_.data(), *len),
+           sys::TSCTimer::now());
+      ++n;
+    }
+    return n;
+  }
+
+  [[nodiscard]] const io::UdpSocket& socket() const noexcept { return socket_; }
+};
+
+}  // namespace tx::feed
+
+#endif
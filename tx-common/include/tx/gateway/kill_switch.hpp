@@ -0,0 +1,226 @@
+#ifndef TX_TRADING_ENGINE_GATEWAY_KILL_SWITCH_HPP
+#define TX_TRADING_ENGINE_GATEWAY_KILL_SWITCH_HPP
+
+#include <poll.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "tx/core/type.hpp"
+#include "tx/error.hpp"
+#include "tx/net/fix/prepared_message.hpp"
+
+namespace tx::gateway {
+
+/// @brief 產生 OrderCancelRequest 所需的委託資訊
+struct CancelFields {
+  std::string_view orig_cl_ord_id;  ///< Tag 41: 目前有效的 ClOrdID
+  std::string_view cl_ord_id;       ///< Tag 11: 刪單本身的 ClOrdID
+  std::string_view order_id;        ///< Tag 37: 交易所委託書號 (可空)
+  std::string_view symbol;          ///< Tag 55
+  core::Side side{};                ///< Tag 54
+  core::Quantity order_qty = core::Quantity::zero();  ///< Tag 38
+};
+
+/// @brief 預先序列化的全撤 (mass cancel) 開關
+///
+/// 每張有效委託在狀態改變時 (新單 / 改單確認) 即以 track() 產生一則
+/// OrderCancelRequest (35=F) 的 PreparedMessage，結束時 (成交完畢 / 已刪
+/// / 被拒) untrack()。風控觸發時 fire() 只需對每則訊息 stamp() 序號
+/// 與時間，再以 writev 批次送出，不在熱路徑上做任何序列化或配置。
+///
+/// 每個 session 的刪單連續存放 (刪除時與最後一筆交換)，fire() 依序走訪。
+/// OrderId -> 位置的索引為建構時配置的 open-addressing 表，track() /
+/// untrack() 不配置記憶體。
+///
+/// @note Thread Safety: 非執行緒安全 (由送單執行緒使用)
+///
+class KillSwitch {
+ public:
+  using SessionId = uint16_t;
+
+  /// @brief 每次 writev 的最大訊息數 (< IOV_MAX)
+  static constexpr size_t kMaxBatch = 256;
+
+  /// @brief fire() 等待 socket 可寫的預設上限
+  static constexpr std::chrono::nanoseconds kDefaultWriteTimeout =
+      std::chrono::seconds(1);
+
+ private:
+  struct Session {
+    std::string begin_string;
+    std::string sender;
+    std::string target;
+    net::fix::TimePrecision precision;
+    std::vector<net::fix::PreparedMessage> cancels;
+    std::vector<core::OrderId> ids;  ///< 與 cancels 平行
+
+    [[nodiscard]] net::fix::SessionHeader header() const noexcept {
+      return {.begin_string = begin_string,
+              .sender = sender,
+              .target = target,
+              .precision = precision};
+    }
+  };
+
+  struct Slot {
+    SessionId session;
+    uint32_t index;
+  };
+
+  /// @brief 索引表的一格 (key 為 OrderId::invalid() 表示空)
+  struct Entry {
+    core::OrderId key = core::OrderId::invalid();
+    Slot slot{};
+  };
+
+  using SteadyClock = std::chrono::steady_clock;
+
+  std::vector<Session> sessions_;
+  std::vector<Entry> slots_;  ///< 線性探測，容量為 2 的冪次 (>= 2 倍)
+  size_t slot_mask_;
+  size_t live_{0};
+  std::vector<iovec> iov_;
+  size_t max_orders_;
+
+ public:
+  /// @param max_orders 預期的有效委託上限 (預先配置)
+  explicit KillSwitch(size_t max_orders = 4096);
+
+  /// @brief 登錄 session (複製標頭字串)
+  SessionId add_session(const net::fix::SessionHeader& header);
+
+  // ----------------------------------------------------------------------------
+  // 委託狀態
+  // ----------------------------------------------------------------------------
+
+  /// @brief 新增或更新委託的刪單 (新單 / 改單確認時呼叫)
+  /// @return 訊息超過 PreparedMessage 容量、有效委託已達 max_orders 或
+  ///         id 無效時失敗
+  Result<> track(core::OrderId id, SessionId session,
+                 const CancelFields& fields) noexcept;
+
+  /// @brief 委託已結束 (全部成交 / 已刪 / 被拒)
+  void untrack(core::OrderId id) noexcept;
+
+  /// @brief session 中的有效委託數
+  [[nodiscard]] size_t live(SessionId session) const noexcept {
+    return sessions_[session].cancels.size();
+  }
+
+  [[nodiscard]] size_t live() const noexcept { return live_; }
+
+  [[nodiscard]] size_t session_count() const noexcept {
+    return sessions_.size();
+  }
+
+  // ----------------------------------------------------------------------------
+  // 觸發
+  // ----------------------------------------------------------------------------
+
+  /// @brief 送出 session 中所有委託的刪單
+  ///
+  /// 委託不會因此 untrack (仍需等待刪單確認)；再次 fire() 會以新的序號
+  /// 重送。
+  ///
+  /// @param next_seq session 的下一個 MsgSeqNum；只前進完整寫出的訊息
+  ///                 數，失敗時即為對方可能收到的下一個序號
+  /// @param sending_time TimestampCache::format() 的結果 (精度需與
+  ///                     session 相同)
+  /// @param writer `writev(std::span<const iovec>) -> Result<size_t>`
+  ///               (e.g. io::TcpSocket)；EAGAIN 時若提供 `fd()` 則以
+  ///               poll() 等待可寫，否則重試
+  /// @param timeout 整次 fire() 等待可寫的上限
+  /// @return 送出的刪單數；寫入錯誤或逾時 (timed_out) 時 session 應視
+  ///         為中斷 (最後一則訊息可能只寫出一部分)
+  template <typename Writer>
+  Result<size_t> fire(
+      SessionId session, uint64_t& next_seq, std::string_view sending_time,
+      Writer& writer,
+      std::chrono::nanoseconds timeout = kDefaultWriteTimeout) noexcept {
+    const auto deadline = SteadyClock::now() + timeout;
+    auto& cancels = sessions_[session].cancels;
+    const size_t count = cancels.size();
+    for (size_t first = 0; first < count; first += kMaxBatch) {
+      const size_t n = std::min(kMaxBatch, count - first);
+      for (size_t i = 0; i < n; ++i) {
+        const auto msg =
+            TRY(cancels[first + i].stamp(next_seq + i, sending_time));
+        iov_[i] = {const_cast<char*>(msg.data()), msg.size()};
+      }
+      size_t completed = 0;
+      auto written =
+          write_all(writer, std::span(iov_.data(), n), deadline, completed);
+      next_seq += completed;
+      CHECK(written);
+    }
+    return count;
+  }
+
+ private:
+  [[nodiscard]] size_t find_slot(core::OrderId id) const noexcept;
+  void erase_slot(size_t pos) noexcept;
+
+  /// @brief 送完所有區段 (處理部分寫入與 EAGAIN)
+  /// @param completed 完整寫出的區段數
+  template <typename Writer>
+  static Result<> write_all(Writer& writer, std::span<iovec> iov,
+                            SteadyClock::time_point deadline,
+                            size_t& completed) noexcept {
+    while (!iov.empty()) {
+      auto written = writer.writev(iov);
+      if (!written) [[unlikely]] {
+        if (written.error() == std::errc::resource_unavailable_try_again) {
+          CHECK(wait_writable(writer, deadline));
+          continue;
+        }
+        return std::unexpected(written.error());
+      }
+      size_t remain = *written;
+      while (!iov.empty() && remain >= iov.front().iov_len) {
+        remain -= iov.front().iov_len;
+        iov = iov.subspan(1);
+        ++completed;
+      }
+      if (remain > 0) {
+        auto& partial = iov.front();
+        partial.iov_base = static_cast<char*>(partial.iov_base) + remain;
+        partial.iov_len -= remain;
+      }
+    }
+    return {};
+  }
+
+  /// @brief 等待可寫直到 deadline (writer 沒有 fd() 時只檢查 deadline)
+  template <typename Writer>
+  static Result<> wait_writable(Writer& writer,
+                                SteadyClock::time_point deadline) noexcept {
+    const auto left = std::chrono::ceil<std::chrono::milliseconds>(
+        deadline - SteadyClock::now());
+    if (left.count() <= 0) {
+      return tx::fail(std::errc::timed_out, "Kill switch write timed out");
+    }
+    if constexpr (requires { writer.fd(); }) {
+      pollfd pfd{.fd = writer.fd(), .events = POLLOUT, .revents = 0};
+      const auto wait_ms = std::min<int64_t>(left.count(), INT_MAX);
+      if (::poll(&pfd, 1, static_cast<int>(wait_ms)) < 0 && errno != EINTR) {
+        return tx::fail(errno, "poll() failed");
+      }
+    }
+    return {};
+  }
+};
+
+}  // namespace tx::gateway
+
+#endif
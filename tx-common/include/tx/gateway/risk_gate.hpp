@@ -0,0 +1,139 @@
+#ifndef TX_TRADING_ENGINE_GATEWAY_RISK_GATE_HPP
+#define TX_TRADING_ENGINE_GATEWAY_RISK_GATE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tx/core/type.hpp"
+#include "tx/error.hpp"
+#include "tx/market/instrument_registry.hpp"
+#include "tx/market/reference_data.hpp"
+#include "tx/sync/rcu.hpp"
+
+namespace tx::gateway {
+
+// ----------------------------------------------------------------------------
+// 風控額度
+// ----------------------------------------------------------------------------
+
+/// @brief 單一商品的風控額度 (口數)
+struct RiskLimits {
+  int64_t max_order_qty{0};  ///< 單筆委託上限 (0 = 禁止下單)
+  int64_t max_position{0};   ///< 成交後淨部位絕對值上限
+};
+
+/// @brief 以 InstrumentId 索引的風控額度表 (不可變版本)
+class RiskTable {
+ private:
+  std::vector<RiskLimits> limits_;
+  bool halted_{false};
+
+ public:
+  /// @param max_instruments InstrumentRegistry 的容量 (InstrumentId 上限)
+  explicit RiskTable(size_t max_instruments);
+
+  /// @brief 商品額度；超過容量時為 nullptr
+  [[nodiscard]] const RiskLimits* find(
+      market::InstrumentId id) const noexcept {
+    return id < limits_.size() ? &limits_[id] : nullptr;
+  }
+
+  /// @brief 是否停止所有新單
+  [[nodiscard]] bool halted() const noexcept { return halted_; }
+
+  // ----------------------------------------------------------------------------
+  // 建立 (寫入端)
+  // ----------------------------------------------------------------------------
+
+  Result<> set(market::InstrumentId id, const RiskLimits& limits) noexcept;
+  void set_halted(bool halted) noexcept { halted_ = halted; }
+};
+
+/// @brief 盤中可更新的風控額度 (讀取端只需一次 load)
+using RiskData = sync::Rcu<RiskTable>;
+
+// ----------------------------------------------------------------------------
+// RiskGate
+// ----------------------------------------------------------------------------
+
+/// @brief 事前風控檢查結果
+enum class RiskCheck : uint8_t {
+  Pass,
+  Halted,             ///< 全面停止新單
+  UnknownInstrument,  ///< 無參考資料 / 額度
+  QtyLimit,           ///< 超過單筆上限
+  PositionLimit,      ///< 成交後部位超過上限
+  PriceBand,          ///< 超出漲跌停或非最小升降單位的整數倍
+};
+
+/// @brief 送單前的風控檢查 (每個送單執行緒一個)
+///
+/// 參考資料與額度皆由 RCU 發布：check() 只有兩次指標 load 加上查表，
+/// 不需要 lock，盤中調整額度或收到新的 I01 時寫入端換上新版本即可，
+/// 不會阻塞送單。check() 取得的版本在下一次 quiescent() 前有效，送單
+/// 執行緒應在每輪 event loop 結束時呼叫 quiescent()，長時間阻塞前呼叫
+/// offline()。
+///
+/// @note Thread Safety: 非執行緒安全 (由單一送單執行緒使用)
+class RiskGate {
+ private:
+  market::ReferenceData::Reader reference_;
+  RiskData::Reader limits_;
+
+  RiskGate(market::ReferenceData::Reader reference,
+           RiskData::Reader limits) noexcept;
+
+ public:
+  /// @brief 於送單執行緒註冊兩份資料的讀取端
+  [[nodiscard]] static Result<RiskGate> create(
+      market::ReferenceData& reference, RiskData& limits) noexcept;
+
+  /// @brief 檢查委託
+  /// @param position 目前淨部位 (多為正、空為負)
+  [[nodiscard]] RiskCheck check(market::InstrumentId id, core::Side side,
+                                core::Price price, core::Quantity qty,
+                                int64_t position) const noexcept {
+    const RiskTable& table = limits_.read();
+    if (table.halted()) [[unlikely]] return RiskCheck::Halted;
+
+    const market::InstrumentSpec* spec = reference_.read().find(id);
+    const RiskLimits* limits = table.find(id);
+    if (spec == nullptr || limits == nullptr) [[unlikely]] {
+      return RiskCheck::UnknownInstrument;
+    }
+
+    if (qty.value() <= 0 || qty.value() > limits->max_order_qty) {
+      return RiskCheck::QtyLimit;
+    }
+    const int64_t after = side == core::Side::Buy ? position + qty.value()
+                                                  : position - qty.value();
+    if (after > limits->max_position || -after > limits->max_position) {
+      return RiskCheck::PositionLimit;
+    }
+    if (!market::ReferenceTable::is_tradable(*spec, price)) {
+      return RiskCheck::PriceBand;
+    }
+    return RiskCheck::Pass;
+  }
+
+  /// @brief 宣告不再使用之前 check() 所讀取的版本
+  void quiescent() noexcept {
+    reference_.quiescent();
+    limits_.quiescent();
+  }
+
+  void offline() noexcept {
+    reference_.offline();
+    limits_.offline();
+  }
+
+  void online() noexcept {
+    reference_.online();
+    limits_.online();
+  }
+};
+
+}  // namespace tx::gateway
+
+#endif
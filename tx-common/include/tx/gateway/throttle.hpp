@@ -0,0 +1,231 @@
+#ifndef TX_TRADING_ENGINE_GATEWAY_THROTTLE_HPP
+#define TX_TRADING_ENGINE_GATEWAY_THROTTLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "tx/sys/clock.hpp"
+
+namespace tx::gateway {
+
+// ----------------------------------------------------------------------------
+// 設定與共享狀態
+// ----------------------------------------------------------------------------
+
+/// @brief 送單訊息類別 (決定可使用的 token 額度)
+enum class MessageClass : uint8_t {
+  Order,  ///< 新單 / 改單
+  Cancel  ///< 刪單 (可使用保留額度)
+};
+
+/// @brief Token bucket 參數 (單位為 clock tick)
+struct ThrottleConfig {
+  uint64_t interval;        ///< 補充一個 token 的時間 (= 1 / 速率)
+  uint32_t burst;           ///< bucket 容量 (可連續送出的訊息數)
+  uint32_t cancel_reserve;  ///< 只有刪單可以使用的 token 數
+
+  /// @brief 以「每秒訊息數」建立
+  /// @note TscClock 需先呼叫 TSCTimer::calibrate()
+  template <sys::Clock Clock = sys::TscClock>
+  [[nodiscard]] static ThrottleConfig per_second(
+      uint32_t rate, uint32_t burst, uint32_t cancel_reserve = 0) noexcept {
+    assert(rate > 0 && cancel_reserve < burst);
+    return {.interval = Clock::from_ns(1'000'000'000ULL / rate),
+            .burst = burst,
+            .cancel_reserve = cancel_reserve};
+  }
+};
+
+/// @brief 限流器的共享狀態
+///
+/// 只有一個 64-bit 欄位，以 std::atomic_ref 存取：同一 session 的多個
+/// 執行緒共用同一個物件，跨 process 時放在 SharedMemory 中
+/// (`shm.as<ThrottleState>()`)。
+///
+/// @note 跨 process 共用時，各 process 的時鐘必須一致 (TSC 在 invariant
+///       TSC 的機器上跨核心同步)
+struct alignas(64) ThrottleState {
+  /// @brief 理論抵達時間 (GCRA)：bucket 全滿的時間點
+  uint64_t tat{0};
+};
+
+static_assert(std::is_trivially_copyable_v<ThrottleState>);
+static_assert(std::atomic_ref<uint64_t>::is_always_lock_free);
+
+// ----------------------------------------------------------------------------
+// Throttle
+// ----------------------------------------------------------------------------
+
+/// @brief 送單限流 (token bucket，以 GCRA 實作)
+///
+/// Token bucket 等價於只記錄「理論抵達時間」tat：每送出一則訊息 tat 前進
+/// interval，tat 超前現在超過 burst * interval 即表示 token 用完。狀態只有
+/// 一個整數，一次 CAS 即可完成檢查與扣除，不需要鎖，也不需要背景補充。
+///
+/// 刪單優先：新單只能使用 burst - cancel_reserve 個 token，保留的額度只
+/// 給刪單，確保限流時仍能撤單。
+///
+/// @note Thread Safety: try_acquire() 可由多個執行緒 / process 同時呼叫
+class Throttle {
+ private:
+  ThrottleState* state_;
+  uint64_t interval_;
+  uint64_t order_limit_;   ///< 新單允許 tat 超前 now 的上限
+  uint64_t cancel_limit_;  ///< 刪單允許 tat 超前 now 的上限
+
+ public:
+  /// @param state 共享狀態 (需比 Throttle 長壽)
+  Throttle(ThrottleState& state, const ThrottleConfig& config) noexcept
+      : state_(&state),
+        interval_(config.interval),
+        order_limit_((config.burst - config.cancel_reserve) * config.interval),
+        cancel_limit_(config.burst * config.interval) {
+    assert(config.cancel_reserve < config.burst);
+  }
+
+  /// @brief 嘗試取得一個 token
+  /// @param now 目前時間 (與 config 相同的 clock)
+  /// @return 0 = 放行；否則為還需等待的 clock tick
+  [[nodiscard]] uint64_t try_acquire(MessageClass cls,
+                                     uint64_t now) noexcept {
+    const uint64_t limit =
+        cls == MessageClass::Cancel ? cancel_limit_ : order_limit_;
+    std::atomic_ref<uint64_t> tat(state_->tat);
+    uint64_t current = tat.load(std::memory_order_relaxed);
+    while (true) {
+      const uint64_t next = std::max(current, now) + interval_;
+      if (next - now > limit) [[unlikely]] {
+        return next - now - limit;
+      }
+      if (tat.compare_exchange_weak(current, next,
+                                    std::memory_order_relaxed)) {
+        return 0;
+      }
+    }
+  }
+
+  /// @brief 目前可用的 token 數 (不扣除)
+  [[nodiscard]] uint64_t available(MessageClass cls,
+                                   uint64_t now) const noexcept {
+    const uint64_t limit =
+        cls == MessageClass::Cancel ? cancel_limit_ : order_limit_;
+    const uint64_t tat =
+        std::atomic_ref<uint64_t>(state_->tat).load(std::memory_order_relaxed);
+    const uint64_t ahead = tat > now ? tat - now : 0;
+    return ahead >= limit ? 0 : (limit - ahead) / interval_;
+  }
+};
+
+// ----------------------------------------------------------------------------
+// ThrottledSender
+// ----------------------------------------------------------------------------
+
+/// @brief token 用完時的處理方式
+enum class OverflowPolicy : uint8_t {
+  Reject,  ///< 直接拒絕 (由策略決定是否重送)
+  Queue    ///< 排隊，於 drain() 時補送
+};
+
+/// @brief submit() 的結果
+enum class Admission : uint8_t {
+  Sent,     ///< 已送出
+  Queued,   ///< 排隊中
+  Rejected  ///< 被拒絕 (Reject 政策或佇列已滿)
+};
+
+/// @brief 單一 session 的送單入口：Throttle + 排隊政策
+///
+/// 刪單與新單各有一條佇列，drain() 時先送刪單。同類訊息不會超車：
+/// 佇列中還有訊息時，新的訊息一律排在後面。
+///
+/// @tparam Msg 待送訊息 (e.g. order handle / pool index)
+/// @tparam Capacity 每條佇列的容量 (2 的冪次)
+/// @note Thread Safety: 非執行緒安全 (由 session 的執行緒使用)；
+///       底層 Throttle 可與其他 session 共用
+template <typename Msg, size_t Capacity = 256>
+  requires std::is_trivially_copyable_v<Msg> && (Capacity > 0) &&
+           ((Capacity & (Capacity - 1)) == 0)
+class ThrottledSender {
+ private:
+  /// @brief 單執行緒環形佇列
+  struct Ring {
+    std::array<Msg, Capacity> items{};
+    size_t head{0};
+    size_t tail{0};
+
+    [[nodiscard]] bool empty() const noexcept { return head == tail; }
+    [[nodiscard]] bool full() const noexcept {
+      return tail - head == Capacity;
+    }
+    [[nodiscard]] size_t size() const noexcept { return tail - head; }
+    void push(const Msg& msg) noexcept {
+      items[tail++ & (Capacity - 1)] = msg;
+    }
+    [[nodiscard]] const Msg& front() const noexcept {
+      return items[head & (Capacity - 1)];
+    }
+    void pop() noexcept { ++head; }
+  };
+
+  Throttle throttle_;
+  OverflowPolicy policy_;
+  Ring cancels_;
+  Ring orders_;
+
+  [[nodiscard]] Ring& ring(MessageClass cls) noexcept {
+    return cls == MessageClass::Cancel ? cancels_ : orders_;
+  }
+
+ public:
+  ThrottledSender(const Throttle& throttle, OverflowPolicy policy) noexcept
+      : throttle_(throttle), policy_(policy) {}
+
+  /// @brief 送出或依政策排隊
+  /// @param send `send(const Msg&)`，取得 token 後立即呼叫
+  template <typename Send>
+  Admission submit(MessageClass cls, const Msg& msg, uint64_t now,
+                   Send&& send) noexcept {
+    Ring& queue = ring(cls);
+    if (queue.empty() && throttle_.try_acquire(cls, now) == 0) [[likely]] {
+      send(msg);
+      return Admission::Sent;
+    }
+    if (policy_ == OverflowPolicy::Reject || queue.full()) {
+      return Admission::Rejected;
+    }
+    queue.push(msg);
+    return Admission::Queued;
+  }
+
+  /// @brief 依 token 補送排隊的訊息 (刪單優先)
+  /// @return 送出的訊息數
+  template <typename Send>
+  size_t drain(uint64_t now, Send&& send) noexcept {
+    size_t sent = 0;
+    for (MessageClass cls : {MessageClass::Cancel, MessageClass::Order}) {
+      Ring& queue = ring(cls);
+      while (!queue.empty() && throttle_.try_acquire(cls, now) == 0) {
+        send(queue.front());
+        queue.pop();
+        ++sent;
+      }
+    }
+    return sent;
+  }
+
+  /// @brief 排隊中的訊息數
+  [[nodiscard]] size_t pending(MessageClass cls) const noexcept {
+    return cls == MessageClass::Cancel ? cancels_.size() : orders_.size();
+  }
+
+  [[nodiscard]] Throttle& throttle() noexcept { return throttle_; }
+};
+
+}  // namespace tx::gateway
+
+#endif
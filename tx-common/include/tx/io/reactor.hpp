@@ -0,0 +1,134 @@
+#ifndef TX_TRADING_ENGINE_IO_REACTOR_HPP
+#define TX_TRADING_ENGINE_IO_REACTOR_HPP
+
+#include <sys/epoll.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/sys/timer_wheel.hpp"
+
+namespace tx::io {
+
+/// @brief 等待 I/O 就緒或 timer 到期的侵入式節點
+///
+/// 由等待者持有 (e.g. coroutine awaiter 位於 coroutine frame 中)，
+/// Reactor 只保存指標，不做任何配置。
+struct IoWaiter {
+  /// @param events epoll 事件 (timer 到期時為 0)
+  void (*on_ready)(IoWaiter* self, uint32_t events){nullptr};
+};
+
+/// @brief 單執行緒 epoll reactor
+///
+/// fd 以 edge-triggered 方式註冊一次，之後每次等待只需把 IoWaiter 放進
+/// 對應的 reader/writer 槽，不需 epoll_ctl。timer 以 TSC cycle 為單位，
+/// 由內建的 sys::TimerWheel 管理。
+/// - 等待者必須先嘗試操作，遇到 EAGAIN 才登記等待 (edge-triggered 語意)
+/// - 每個 fd 同時最多一個 reader 與一個 writer
+///
+/// @note Thread Safety: 非執行緒安全，所有操作需在 reactor 執行緒進行
+///
+class Reactor {
+ public:
+  static constexpr size_t kMaxEvents = 64;
+  static constexpr size_t kTimerCapacity = 4096;
+
+  using Timers = sys::TimerWheel<kTimerCapacity>;
+
+ private:
+  struct Registration {
+    IoWaiter* reader{nullptr};
+    IoWaiter* writer{nullptr};
+    bool registered{false};
+  };
+
+  int epfd_{-1};
+  std::vector<Registration> fds_;  ///< 以 fd 為索引
+  std::unique_ptr<Timers> timers_;
+
+  Reactor(int epfd, std::unique_ptr<Timers> timers) noexcept;
+
+ public:
+  // ----------------------------------------------------------------------------
+  // Factory Methods
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] static Result<Reactor> create() noexcept;
+
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+  ~Reactor() noexcept;
+  Reactor(const Reactor&) = delete;
+  Reactor& operator=(const Reactor&) = delete;
+  Reactor(Reactor&& other) noexcept;
+  Reactor& operator=(Reactor&& other) noexcept;
+
+  // ----------------------------------------------------------------------------
+  // fd 管理
+  // ----------------------------------------------------------------------------
+
+  /// @brief 註冊 fd (EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET)
+  /// @note fd 需為非阻塞；重複註冊不會出錯
+  [[nodiscard]] Result<> add(int fd) noexcept;
+
+  /// @brief 取消註冊並丟棄該 fd 上的等待者 (關閉 fd 前呼叫)
+  Result<> remove(int fd) noexcept;
+
+  // ----------------------------------------------------------------------------
+  // 等待
+  // ----------------------------------------------------------------------------
+
+  /// @brief 等待 fd 可讀 (一次性)
+  /// @note fd 需先以 add() 註冊
+  void wait_readable(int fd, IoWaiter* waiter) noexcept;
+
+  /// @brief 等待 fd 可寫 (一次性)
+  /// @note fd 需先以 add() 註冊
+  void wait_writable(int fd, IoWaiter* waiter) noexcept;
+
+  /// @brief 取消尚未觸發的 I/O 等待
+  void cancel_wait(int fd, IoWaiter* waiter) noexcept;
+
+  /// @brief 在 deadline_tsc 時呼叫 waiter->on_ready(waiter, 0)
+  [[nodiscard]] Result<sys::TimerHandle> schedule(uint64_t deadline_tsc,
+                                                  IoWaiter* waiter) noexcept;
+
+  /// @brief 取消 timer
+  bool cancel_timer(sys::TimerHandle handle) noexcept {
+    return timers_->cancel(handle);
+  }
+
+  // ----------------------------------------------------------------------------
+  // Event Loop
+  // ----------------------------------------------------------------------------
+
+  /// @brief 處理一輪事件: epoll_wait -> I/O 等待者 -> 到期 timer
+  ///
+  /// @param timeout_ms epoll_wait 逾時 (0 = busy poll, < 0 = 無限等待)。
+  ///                   有 timer 等待時縮短為距離最近 timer 的時間
+  ///                   (無條件進位至 ms)
+  /// @return 觸發的等待者數量或錯誤
+  Result<size_t> poll(int timeout_ms = 0) noexcept;
+
+  /// @brief 是否仍有等待中的 I/O 或 timer
+  [[nodiscard]] bool has_pending() const noexcept;
+
+  [[nodiscard]] int fd() const noexcept { return epfd_; }
+
+ private:
+  /// @brief 已註冊 fd 的 Registration (不擴充 fds_)
+  Registration& slot(int fd) noexcept;
+
+  /// @brief 依最近的 timer 到期時間調整 epoll_wait 逾時
+  [[nodiscard]] int timer_timeout(int timeout_ms) const noexcept;
+};
+
+}  // namespace tx::io
+
+#endif
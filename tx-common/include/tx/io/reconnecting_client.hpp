@@ -0,0 +1,327 @@
+#ifndef TX_TRADING_ENGINE_IO_RECONNECTING_CLIENT_HPP
+#define TX_TRADING_ENGINE_IO_RECONNECTING_CLIENT_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+#include "tx/error.hpp"
+#include "tx/io/reactor.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/tcp_socket.hpp"
+#include "tx/sys/timer_wheel.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::io {
+
+// ----------------------------------------------------------------------------
+// 重連策略
+// ----------------------------------------------------------------------------
+
+/// @brief 重連參數
+struct ReconnectPolicy {
+  std::chrono::nanoseconds connect_timeout{std::chrono::seconds(2)};
+  std::chrono::nanoseconds initial_backoff{std::chrono::milliseconds(100)};
+  std::chrono::nanoseconds max_backoff{std::chrono::seconds(30)};
+  uint32_t multiplier{2};  ///< 每次失敗後的放大倍數
+  /// @brief 隨機扣除的比例 [0, 1]：實際延遲落在
+  ///        [backoff * (1 - jitter), backoff]，避免多個 client 同步重連
+  double jitter{0.5};
+  uint64_t seed{0};  ///< 亂數種子，0 = 以 TSC 取種
+  bool nodelay{true};
+};
+
+/// @brief 帶 jitter 的指數退避
+///
+/// 第 n 次失敗的上限為 min(max_backoff, initial_backoff * multiplier^n)，
+/// 實際延遲再隨機扣除最多 jitter 比例。亂數使用 xorshift64*，不配置記憶體。
+///
+class ExponentialBackoff {
+ private:
+  ReconnectPolicy policy_;
+  std::chrono::nanoseconds ceiling_;  ///< 本次的退避上限 (未含 jitter)
+  uint64_t state_;
+  uint32_t attempts_{0};
+
+ public:
+  explicit ExponentialBackoff(const ReconnectPolicy& policy) noexcept
+      : policy_(policy),
+        ceiling_(policy.initial_backoff),
+        state_(policy.seed != 0 ? policy.seed : sys::TSCTimer::now() | 1) {}
+
+  /// @brief 取得下一次的延遲並推進狀態
+  [[nodiscard]] std::chrono::nanoseconds next() noexcept {
+    const auto ceiling = ceiling_;
+    ++attempts_;
+
+    // 先以除法檢查避免溢位
+    const uint32_t multiplier = std::max<uint32_t>(policy_.multiplier, 1);
+    if (ceiling_ >= policy_.max_backoff / multiplier) {
+      ceiling_ = policy_.max_backoff;
+    } else {
+      ceiling_ *= multiplier;
+    }
+
+    const double jitter = std::clamp(policy_.jitter, 0.0, 1.0);
+    const double cut = jitter * uniform();
+    return std::chrono::nanoseconds(static_cast<int64_t>(
+        static_cast<double>(ceiling.count()) * (1.0 - cut)));
+  }
+
+  /// @brief 連線成功後重設
+  void reset() noexcept {
+    ceiling_ = policy_.initial_backoff;
+    attempts_ = 0;
+  }
+
+  /// @brief 連續失敗次數
+  [[nodiscard]] uint32_t attempts() const noexcept { return attempts_; }
+
+ private:
+  /// @return [0, 1) 的均勻亂數
+  [[nodiscard]] double uniform() noexcept {
+    state_ ^= state_ >> 12;
+    state_ ^= state_ << 25;
+    state_ ^= state_ >> 27;
+    const uint64_t r = state_ * 0x2545F4914F6CDD1DULL;
+    return static_cast<double>(r >> 11) * 0x1.0p-53;
+  }
+};
+
+// ----------------------------------------------------------------------------
+// ReconnectingClient
+// ----------------------------------------------------------------------------
+
+/// @brief 自動重連的 TCP client (由 io::Reactor 驅動，永不阻塞)
+///
+/// 狀態: Idle -> Connecting -> Connected -> (disconnect) -> Backoff ->
+/// Connecting ...。連線、逾時與退避全部以 reactor 的 I/O 等待與 timer
+/// 完成，呼叫端只需持續呼叫 reactor.poll()。
+///
+/// Handler 介面 (編譯期檢查，選用的 callback 可省略):
+/// - `void on_connected(TcpSocket&)`
+/// - `void on_disconnected(std::error_code)` (選用，已連線後斷線)
+/// - `void on_connect_failed(std::error_code, uint32_t attempt,
+///                           std::chrono::nanoseconds retry_in)` (選用)
+///
+/// 連線後的讀寫由呼叫端負責 (e.g. coro::async_read)，發現斷線時呼叫
+/// disconnect() 即會在退避後重連。
+///
+/// @note Thread Safety: 非執行緒安全，需在 reactor 執行緒操作；
+///       物件註冊到 reactor 後不可移動
+///
+template <typename Handler>
+class ReconnectingClient {
+ public:
+  enum class State : uint8_t { Idle, Connecting, Connected, Backoff };
+
+ private:
+  /// @brief 嵌入的等待節點 (由 on_ready 找回 client)
+  struct Waiter : IoWaiter {
+    ReconnectingClient* owner{nullptr};
+  };
+
+  Reactor& reactor_;
+  Handler& handler_;
+  SocketAddress remote_;
+  ReconnectPolicy policy_;
+  ExponentialBackoff backoff_;
+
+  std::optional<TcpSocket> socket_;
+  State state_{State::Idle};
+  Waiter io_waiter_{};     ///< 等待連線完成 (可寫)
+  Waiter timer_waiter_{};  ///< 連線逾時或退避到期
+  sys::TimerHandle timer_{};
+
+ public:
+  // ----------------------------------------------------------------------------
+  // 建構函數
+  // ----------------------------------------------------------------------------
+
+  ReconnectingClient(Reactor& reactor, Handler& handler,
+                     const SocketAddress& remote,
+                     const ReconnectPolicy& policy = {}) noexcept
+      : reactor_(reactor),
+        handler_(handler),
+        remote_(remote),
+        policy_(policy),
+        backoff_(policy) {
+    io_waiter_.owner = this;
+    io_waiter_.on_ready = &ReconnectingClient::on_writable;
+    timer_waiter_.owner = this;
+    timer_waiter_.on_ready = &ReconnectingClient::on_timer;
+  }
+
+  ~ReconnectingClient() noexcept { stop(); }
+  ReconnectingClient(const ReconnectingClient&) = delete;
+  ReconnectingClient& operator=(const ReconnectingClient&) = delete;
+  ReconnectingClient(ReconnectingClient&&) = delete;
+  ReconnectingClient& operator=(ReconnectingClient&&) = delete;
+
+  // ----------------------------------------------------------------------------
+  // 控制
+  // ----------------------------------------------------------------------------
+
+  /// @brief 開始連線 (立即返回)
+  void start() noexcept {
+    if (state_ == State::Idle) {
+      begin_connect();
+    }
+  }
+
+  /// @brief 回報連線中斷 (e.g. recv 回傳 0 或錯誤)，退避後重連
+  void disconnect(std::error_code ec) noexcept {
+    if (state_ != State::Connected) {
+      return;
+    }
+    close_socket();
+    if constexpr (requires { handler_.on_disconnected(ec); }) {
+      handler_.on_disconnected(ec);
+    }
+    backoff_.reset();
+    schedule_retry();
+  }
+
+  /// @brief 停止並關閉連線 (不觸發 callback)
+  void stop() noexcept {
+    cancel_timer();
+    if (socket_) {
+      reactor_.cancel_wait(socket_->fd(), &io_waiter_);
+    }
+    close_socket();
+    state_ = State::Idle;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] State state() const noexcept { return state_; }
+  [[nodiscard]] bool is_connected() const noexcept {
+    return state_ == State::Connected;
+  }
+
+  /// @brief 已連線時的 socket，否則為 nullptr
+  [[nodiscard]] TcpSocket* socket() noexcept {
+    return state_ == State::Connected ? &*socket_ : nullptr;
+  }
+
+  /// @brief 連續失敗次數 (連線成功後歸零)
+  [[nodiscard]] uint32_t attempts() const noexcept {
+    return backoff_.attempts();
+  }
+
+ private:
+  void begin_connect() noexcept {
+    state_ = State::Connecting;
+
+    auto socket = TcpSocket::start_connect(remote_, policy_.nodelay);
+    if (!socket) {
+      connect_failed(socket.error());
+      return;
+    }
+    socket_.emplace(std::move(*socket));
+
+    if (auto r = reactor_.add(socket_->fd()); !r) {
+      close_socket();
+      connect_failed(r.error());
+      return;
+    }
+
+    // deadline timer 失敗時仍可等待連線完成，只是沒有逾時保護
+    auto timer = reactor_.schedule(deadline_after(policy_.connect_timeout),
+                                   &timer_waiter_);
+    timer_ = timer ? *timer : sys::TimerHandle{};
+
+    // edge-triggered: 註冊時若已可寫 (立即完成或已失敗) 會馬上觸發
+    reactor_.wait_writable(socket_->fd(), &io_waiter_);
+  }
+
+  void connect_failed(std::error_code ec) noexcept {
+    const auto delay = schedule_retry();
+    if constexpr (requires {
+                    handler_.on_connect_failed(ec, backoff_.attempts(), delay);
+                  }) {
+      handler_.on_connect_failed(ec, backoff_.attempts(), delay);
+    }
+  }
+
+  /// @return 退避延遲
+  std::chrono::nanoseconds schedule_retry() noexcept {
+    state_ = State::Backoff;
+    const auto delay = backoff_.next();
+    auto timer = reactor_.schedule(deadline_after(delay), &timer_waiter_);
+    if (!timer) {
+      // timer 已滿：無法排程退避，回到 Idle 由呼叫端決定何時 start()
+      state_ = State::Idle;
+      return delay;
+    }
+    timer_ = *timer;
+    return delay;
+  }
+
+  static void on_writable(IoWaiter* w, uint32_t /*events*/) noexcept {
+    auto* self = static_cast<Waiter*>(w)->owner;
+    if (self->state_ != State::Connecting) {
+      return;
+    }
+    self->cancel_timer();
+
+    auto result = self->socket_->connect_result();
+    if (!result) {
+      self->close_socket();
+      self->connect_failed(result.error());
+      return;
+    }
+
+    self->state_ = State::Connected;
+    self->backoff_.reset();
+    self->handler_.on_connected(*self->socket_);
+  }
+
+  static void on_timer(IoWaiter* w, uint32_t /*events*/) noexcept {
+    auto* self = static_cast<Waiter*>(w)->owner;
+    self->timer_ = {};
+
+    switch (self->state_) {
+      case State::Connecting:
+        self->reactor_.cancel_wait(self->socket_->fd(), &self->io_waiter_);
+        self->close_socket();
+        self->connect_failed(std::make_error_code(std::errc::timed_out));
+        break;
+      case State::Backoff:
+        self->begin_connect();
+        break;
+      case State::Idle:
+      case State::Connected:
+        break;
+    }
+  }
+
+  void cancel_timer() noexcept {
+    if (timer_.is_valid()) {
+      reactor_.cancel_timer(timer_);
+      timer_ = {};
+    }
+  }
+
+  void close_socket() noexcept {
+    if (socket_) {
+      (void)reactor_.remove(socket_->fd());
+      socket_.reset();
+    }
+  }
+
+  [[nodiscard]] static uint64_t deadline_after(
+      std::chrono::nanoseconds delay) noexcept {
+    const auto ns = static_cast<uint64_t>(std::max<int64_t>(delay.count(), 0));
+    return sys::TSCTimer::now() + sys::TSCTimer::ns_to_cycles(ns);
+  }
+};
+
+}  // namespace tx::io
+
+#endif
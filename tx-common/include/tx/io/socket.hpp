@@ -1,6 +1,10 @@
 #ifndef TX_TRADING_ENGINE_IO_SOCKET_HPP
 #define TX_TRADING_ENGINE_IO_SOCKET_HPP
 
+#include <linux/filter.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
 #include <cstddef>
 #include <span>
 
@@ -61,6 +65,16 @@ class Socket {
   ///
   Result<> connect(const SocketAddress& addr) noexcept;
 
+  /// @brief 非阻塞連線 (需先 set_nonblocking(true))
+  /// @return true = 已完成連線, false = 連線中 (等待可寫後呼叫
+  ///         connect_result() 取得結果)
+  ///
+  Result<bool> connect_nonblocking(const SocketAddress& addr) noexcept;
+
+  /// @brief 取得非阻塞連線的結果 (SO_ERROR)
+  ///
+  Result<> connect_result() const noexcept;
+
   // ----------------------------------------------------------------------------
   // I/O Operations
   // ----------------------------------------------------------------------------
@@ -68,9 +82,17 @@ class Socket {
   /// @brief 發送數據 (TCP)
   /// @param data 要發送的位元組序列
   /// @return 實際發送的位元組數 (可能 < data.size())
+  /// @note 對端已關閉時回傳 EPIPE，不會觸發 SIGPIPE
   ///
   Result<size_t> send(std::span<const std::byte> data) noexcept;
 
+  /// @brief 以單一 syscall 發送多段數據 (TCP, writev 語意)
+  /// @param iov 依序發送的區段 (最多 IOV_MAX 段)
+  /// @return 實際發送的位元組數 (可能 < 總長度，可能停在區段中間)
+  /// @note 以 sendmsg(MSG_NOSIGNAL) 實作，對端已關閉時回傳 EPIPE
+  ///
+  Result<size_t> writev(std::span<const iovec> iov) noexcept;
+
   /// @brief 接收數據 (TCP)
   /// @param buffer 接收緩衝區
   /// @return 實際接收的位元組數 (0 = 對端關閉連線 FIN)
@@ -93,6 +115,12 @@ class Socket {
   Result<size_t> recvfrom(std::span<std::byte> buffer,
                           SocketAddress* src = nullptr) noexcept;
 
+  /// @brief 以單一 syscall 發送多個 datagram（UDP, sendmmsg）
+  /// @param msgs 已填好 msg_hdr 的訊息，完成後 msg_len 為各自發送的長度
+  /// @return 實際發送的訊息數（可能 < msgs.size()）
+  ///
+  Result<size_t> sendmmsg(std::span<mmsghdr> msgs) noexcept;
+
   // ----------------------------------------------------------------------------
   // Socket Options
   // ----------------------------------------------------------------------------
@@ -138,6 +166,17 @@ class Socket {
   ///
   Result<> set_multicast_loopback(bool enable) noexcept;
 
+  /// @brief 掛上 classic BPF 過濾程式（SO_ATTACH_FILTER，不需特權）
+  /// @param program BPF 指令，回傳 0 的封包在 kernel 內即丟棄
+  /// @details 已有過濾程式時會被取代；UDP socket 的載入位移以 UDP 標頭
+  ///          開頭為 0（payload 從 8 開始）
+  ///
+  Result<> attach_filter(std::span<const sock_filter> program) noexcept;
+
+  /// @brief 移除 BPF 過濾程式（SO_DETACH_FILTER）
+  ///
+  Result<> detach_filter() noexcept;
+
   // ----------------------------------------------------------------------------
   // Queries
   // ----------------------------------------------------------------------------
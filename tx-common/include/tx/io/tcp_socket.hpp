@@ -1,6 +1,8 @@
 #ifndef TX_TRADING_ENGINE_IO_TCP_SOCKET_HPP
 #define TX_TRADING_ENGINE_IO_TCP_SOCKET_HPP
 
+#include <chrono>
+
 #include "tx/io/socket.hpp"
 #include "tx/io/socket_address.hpp"
 
@@ -22,6 +24,28 @@ class TcpSocket {
   /// @return TcpSocket 或錯誤
   static Result<TcpSocket> connect(const SocketAddress& remote_addr,
                                    bool nodelay = true) noexcept;
+  /// @brief 建立 TCP Client 連線（有期限）
+  ///
+  /// 以非阻塞 connect + poll() 等待，遠端無回應時不會卡在 kernel 的 SYN
+  /// 重送逾時（數十秒）。成功後 socket 恢復為阻塞模式。
+  ///
+  /// @param remote_addr 遠端地址
+  /// @param timeout 連線期限
+  /// @param nodelay 是否禁用 Nagle 算法
+  /// @return TcpSocket 或錯誤（逾時為 std::errc::timed_out）
+  static Result<TcpSocket> connect(const SocketAddress& remote_addr,
+                                   std::chrono::nanoseconds timeout,
+                                   bool nodelay = true) noexcept;
+  /// @brief 開始非阻塞連線（立即返回）
+  ///
+  /// 回傳的 socket 為非阻塞模式，連線可能仍在進行中：等待 fd 可寫
+  /// （poll 或 io::Reactor）後以 connect_result() 取得結果。
+  ///
+  /// @param remote_addr 遠端地址
+  /// @param nodelay 是否禁用 Nagle 算法
+  /// @return 連線中的 TcpSocket 或錯誤（e.g. 立即被拒絕）
+  static Result<TcpSocket> start_connect(const SocketAddress& remote_addr,
+                                         bool nodelay = true) noexcept;
   /// @brief 建立 TCP Server 監聽
   /// @param local_addr 本地綁定地址
   /// @param backlog 連線佇列大小（預設 128）
@@ -59,6 +83,11 @@ class TcpSocket {
     return socket_.send(data);
   }
 
+  /// @brief 以單一 syscall 發送多段數據 (writev)
+  Result<size_t> writev(std::span<const iovec> iov) noexcept {
+    return socket_.writev(iov);
+  }
+
   /// @brief 接收數據
   Result<size_t> recv(std::span<std::byte> buffer) noexcept {
     return socket_.recv(buffer);
@@ -88,6 +117,14 @@ class TcpSocket {
   /// @brief 檢查 socket 是否有效
   [[nodiscard]] bool is_valid() const noexcept { return socket_.is_valid(); }
 
+  /// @brief 取得 start_connect() 的連線結果（SO_ERROR）
+  [[nodiscard]] Result<> connect_result() const noexcept {
+    return socket_.connect_result();
+  }
+
+  /// @brief 取得 file descriptor（註冊到 reactor 用）
+  [[nodiscard]] int fd() const noexcept { return socket_.fd(); }
+
   /// @brief 取得本地地址
   [[nodiscard]] Result<SocketAddress> local_address() const noexcept {
     return socket_.local_address();
@@ -92,6 +92,13 @@ class UdpSocket {
     return socket_.sendto(data, dest);
   }
 
+  /// @brief 批次發送多個 datagram（一次 sendmmsg syscall）
+  /// @param msgs 已填好目標地址與 iovec 的訊息
+  /// @return 實際發送的訊息數（可能 < msgs.size()，需重送剩餘部分）
+  Result<size_t> sendmmsg(std::span<mmsghdr> msgs) noexcept {
+    return socket_.sendmmsg(msgs);
+  }
+
   /// @brief 接收數據（並取得發送端地址）
   /// @param buffer 接收緩衝區
   /// @param src 發送端地址（可選，nullptr = 不需要）
@@ -130,6 +137,16 @@ class UdpSocket {
     return socket_.set_nonblocking(enable);
   }
 
+  /// @brief 掛上 classic BPF 過濾程式（不需特權）
+  /// @details 不符合的 datagram 在 kernel 內丟棄，不喚醒、不複製
+  ///          （TAIFEX 條件可用 net::taifex::FeedFilter 產生）
+  Result<> attach_filter(std::span<const sock_filter> program) noexcept {
+    return socket_.attach_filter(program);
+  }
+
+  /// @brief 移除 BPF 過濾程式
+  Result<> detach_filter() noexcept { return socket_.detach_filter(); }
+
   // ===========================
   // 查詢函數
   // ===========================
@@ -0,0 +1,111 @@
+#ifndef TX_TRADING_ENGINE_MARKET_BLACK76_HPP
+#define TX_TRADING_ENGINE_MARKET_BLACK76_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "tx/market/options_chain.hpp"
+#include "tx/simd/dispatch.hpp"
+
+namespace tx::market {
+
+/// @brief Black-76 (期貨選擇權) 的共用參數
+///
+/// TXO 以 TXF 作為標的定價：同一到期月份的所有履約價共用 forward、
+/// 到期時間與折現因子。價格單位任意但需一致 (e.g. forward、履約價與
+/// 權利金皆為 tick)；Greeks 隨之縮放 (gamma 為 1 / 單位、vega 為單位)。
+struct BlackParams {
+  double forward;        ///< 標的期貨價格
+  double expiry;         ///< 到期時間 (年，> 0)
+  double discount = 1.0;  ///< 折現因子 e^{-rT}
+  OptionType type = OptionType::Call;
+};
+
+/// @brief 批次計算的輸出陣列 (nullptr 表示不需要該項)
+struct GreeksOut {
+  double* price = nullptr;
+  double* delta = nullptr;  ///< 對 forward
+  double* gamma = nullptr;
+  double* vega = nullptr;   ///< 波動率變動 1.0 (= 100%) 的價格變動
+};
+
+// ----------------------------------------------------------------------------
+// Dispatch Objects
+// ----------------------------------------------------------------------------
+
+/// @brief Black-76 批次 kernel (實作於 black76.cpp)
+///
+/// scalar 版本以 std::erfc / std::exp / std::log 計算，作為向量版本的
+/// 參考實作；AVX2 / AVX-512 版本以多項式近似 exp、log 與常態分配
+/// (相對誤差約 1e-14)，一次處理 4 / 8 個履約價。
+namespace kernels {
+
+/// @brief 價格與 Greeks
+/// @param strike 履約價 (與 OptionsChain 相同的 int32 tick)
+/// @param vol 年化波動率 (> 0)
+extern simd::Dispatch<void(const BlackParams& params, const int32_t* strike,
+                           const double* vol, const GreeksOut& out,
+                           size_t count)>
+    black76_greeks;
+
+/// @brief 隱含波動率 (Newton 法，跳出搜尋區間時退回二分法)
+///
+/// 價內的履約價先以 put-call parity 換成價外的另一邊，再對 log 價格做
+/// Newton (價外權利金對波動率近似指數變化)。所有 lane 收斂後提前結束。
+///
+/// @param price 權利金；不在無套利區間 (折現內含價值, 價格上限) 內或
+///              為 NaN 時，結果為 NaN
+/// @param vol 輸入為起點：(1e-4, 5) 內的值 (e.g. 上一個 tick 的結果)
+///            直接使用，其餘 (0、NaN) 改用 Manaster-Koehler 的
+///            sqrt(2 |ln(F/K)| / T)；輸出為隱含波動率
+extern simd::Dispatch<void(const BlackParams& params, const int32_t* strike,
+                           const double* price, double* vol, size_t count)>
+    black76_implied_vol;
+
+}  // namespace kernels
+
+/// @brief 重新選擇 Black-76 kernel 的實作 (不高於 max)
+void resolve_black76(simd::Isa max) noexcept;
+
+// ----------------------------------------------------------------------------
+// Kernels
+// ----------------------------------------------------------------------------
+
+/// @brief 整個履約價陣列的價格與 Greeks
+///
+///     chain.mid_prices(OptionType::Call, expiry, mids);
+///     black76_implied_vol({.forward = txf_mid, .expiry = t},
+///                         chain.strikes(expiry), mids, vols);
+///     black76_greeks({.forward = txf_mid, .expiry = t}, chain.strikes(expiry),
+///                    vols, {.delta = deltas.data()});
+///
+/// @pre vol 與 out 中非空的陣列長度 >= strike.size()
+inline void black76_greeks(const BlackParams& params,
+                           std::span<const int32_t> strike,
+                           std::span<const double> vol,
+                           const GreeksOut& out) noexcept {
+  assert(vol.size() >= strike.size());
+  kernels::black76_greeks(params, strike.data(), vol.data(), out,
+                          strike.size());
+}
+
+/// @brief 整個履約價陣列的隱含波動率
+///
+/// vol 保留上一個 tick 的結果即可作為起點 (標的小幅變動時只需 2 ~ 3 次
+/// 迭代)；第一次呼叫前填 0。
+///
+/// @pre price 與 vol 長度 >= strike.size()
+inline void black76_implied_vol(const BlackParams& params,
+                                std::span<const int32_t> strike,
+                                std::span<const double> price,
+                                std::span<double> vol) noexcept {
+  assert(price.size() >= strike.size() && vol.size() >= strike.size());
+  kernels::black76_implied_vol(params, strike.data(), price.data(),
+                               vol.data(), strike.size());
+}
+
+}  // namespace tx::market
+
+#endif
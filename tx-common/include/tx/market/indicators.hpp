@@ -0,0 +1,429 @@
+#ifndef TX_TRADING_ENGINE_MARKET_INDICATORS_HPP
+#define TX_TRADING_ENGINE_MARKET_INDICATORS_HPP
+
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include "tx/market/order_book.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+#include "tx/sys/clock.hpp"
+
+namespace tx::market {
+
+// ----------------------------------------------------------------------------
+// 基本型別
+// ----------------------------------------------------------------------------
+
+/// @brief Q47.16 定點數
+///
+/// 指標一律以整數更新：結果可重現 (回測與即時完全一致)，也不會因
+/// 長時間累加而漂移。價格類指標的單位為 tick。
+struct Fixed {
+  static constexpr int kFracBits = 16;
+  static constexpr int64_t kOne = int64_t{1} << kFracBits;
+
+  int64_t raw{0};
+
+  [[nodiscard]] static constexpr Fixed from_int(int64_t value) noexcept {
+    return {value * kOne};
+  }
+  /// @brief numerator / denominator (向零捨入)
+  [[nodiscard]] static constexpr Fixed ratio(__int128 numerator,
+                                             __int128 denominator) noexcept {
+    return {static_cast<int64_t>(numerator * kOne / denominator)};
+  }
+
+  [[nodiscard]] constexpr double to_double() const noexcept {
+    return static_cast<double>(raw) / static_cast<double>(kOne);
+  }
+
+  [[nodiscard]] constexpr auto operator<=>(const Fixed&) const noexcept =
+      default;
+};
+
+/// @brief 固定容量的環形視窗 (最舊 -> 最新)
+///
+/// 滿了之後 push() 覆蓋最舊的元素；呼叫端若需要維護總和，應在 push()
+/// 前以 full() / front() 取得即將被移除的值。
+///
+/// @tparam N 容量 (2 的冪次)
+template <typename T, size_t N>
+  requires(N > 0) && ((N & (N - 1)) == 0)
+class RingWindow {
+ private:
+  std::array<T, N> items_{};
+  uint64_t head_{0};
+  uint64_t tail_{0};
+
+ public:
+  void push(const T& value) noexcept {
+    items_[tail_++ & (N - 1)] = value;
+    if (tail_ - head_ > N) ++head_;
+  }
+  void pop_front() noexcept {
+    assert(!empty());
+    ++head_;
+  }
+
+  /// @brief 第 i 舊的元素
+  [[nodiscard]] const T& operator[](size_t i) const noexcept {
+    return items_[(head_ + i) & (N - 1)];
+  }
+  [[nodiscard]] const T& front() const noexcept { return (*this)[0]; }
+  [[nodiscard]] const T& back() const noexcept {
+    return items_[(tail_ - 1) & (N - 1)];
+  }
+
+  [[nodiscard]] size_t size() const noexcept {
+    return tail_ - head_;
+  }
+  [[nodiscard]] bool empty() const noexcept { return head_ == tail_; }
+  [[nodiscard]] bool full() const noexcept { return size() == N; }
+  [[nodiscard]] static constexpr size_t capacity() noexcept { return N; }
+};
+
+// ----------------------------------------------------------------------------
+// 數值指標 (與資料來源無關)
+// ----------------------------------------------------------------------------
+
+/// @brief 指數移動平均，alpha = 2^-Shift
+///
+/// alpha 限定為 2 的負冪次，更新只需一次減法與一次位移：
+/// value += (x - value) >> Shift。對應的半衰期約為 0.69 * 2^Shift 筆。
+template <int Shift>
+  requires(Shift > 0) && (Shift < 32)
+class Ema {
+ private:
+  Fixed value_{};
+  bool primed_{false};
+
+ public:
+  void update(Fixed x) noexcept {
+    if (!primed_) [[unlikely]] {
+      value_ = x;
+      primed_ = true;
+      return;
+    }
+    value_.raw += (x.raw - value_.raw) >> Shift;
+  }
+
+  [[nodiscard]] Fixed value() const noexcept { return value_; }
+  /// @brief 是否已有第一筆資料
+  [[nodiscard]] bool primed() const noexcept { return primed_; }
+};
+
+/// @brief 最近 N 筆整數的平均與變異數 (母體)
+///
+/// 以整數維護總和與平方和 (平方和為 128-bit)，移出 / 加入各一次
+/// 加減，不會累積浮點誤差。
+template <size_t N>
+class RollingVariance {
+ private:
+  RingWindow<int64_t, N> window_;
+  int64_t sum_{0};
+  __int128 sum_sq_{0};
+
+ public:
+  void update(int64_t x) noexcept {
+    if (window_.full()) {
+      const int64_t old = window_.front();
+      sum_ -= old;
+      sum_sq_ -= static_cast<__int128>(old) * old;
+    }
+    window_.push(x);
+    sum_ += x;
+    sum_sq_ += static_cast<__int128>(x) * x;
+  }
+
+  [[nodiscard]] Fixed mean() const noexcept {
+    return window_.empty() ? Fixed{} : Fixed::ratio(sum_, count());
+  }
+
+  /// @brief (n * sum(x^2) - sum(x)^2) / n^2
+  [[nodiscard]] Fixed variance() const noexcept {
+    const auto n = static_cast<__int128>(count());
+    if (n == 0) return {};
+    return Fixed::ratio(n * sum_sq_ - static_cast<__int128>(sum_) * sum_,
+                        n * n);
+  }
+
+  [[nodiscard]] int64_t count() const noexcept {
+    return static_cast<int64_t>(window_.size());
+  }
+  [[nodiscard]] bool full() const noexcept { return window_.full(); }
+};
+
+// ----------------------------------------------------------------------------
+// 行情指標 (on_book / on_trade)
+// ----------------------------------------------------------------------------
+//
+// 每個指標實作 `void on_book(const OrderBook&)` 與 / 或
+// `void on_trade(const net::taifex::ParsedR02Trade&)`，並以 book 的
+// changed_mask() 判斷是否需要重算。
+
+namespace detail {
+
+inline constexpr uint16_t kTopMask =
+    OrderBook::bid_bit(0) | OrderBook::ask_bit(0);
+
+/// @brief 前 Levels 檔的遮罩
+template <size_t Levels>
+inline constexpr uint16_t kLevelsMask = static_cast<uint16_t>(
+    ((1U << Levels) - 1) | (((1U << Levels) - 1) << OrderBook::kDepth));
+
+[[nodiscard]] inline bool has_two_sides(const OrderBook& book) noexcept {
+  return book.bid_depth() > 0 && book.ask_depth() > 0;
+}
+
+/// @brief 中價 (tick)
+[[nodiscard]] inline Fixed mid(const OrderBook& book) noexcept {
+  return {(book.best_bid().price.to_ticks() + book.best_ask().price.to_ticks())
+          << (Fixed::kFracBits - 1)};
+}
+
+}  // namespace detail
+
+/// @brief 中價的指數移動平均 (最佳一檔變動時更新)
+template <int Shift>
+class MidEma {
+ private:
+  Ema<Shift> ema_;
+
+ public:
+  void on_book(const OrderBook& book) noexcept {
+    if ((book.changed_mask() & detail::kTopMask) == 0) return;
+    if (!detail::has_two_sides(book)) return;
+    ema_.update(detail::mid(book));
+  }
+
+  [[nodiscard]] Fixed value() const noexcept { return ema_.value(); }
+  [[nodiscard]] bool primed() const noexcept { return ema_.primed(); }
+};
+
+/// @brief 最近 N 次中價變動的變異數 (tick^2，短期已實現波動)
+template <size_t N>
+class MidVariance {
+ private:
+  RollingVariance<N> changes_;
+  Fixed last_mid_{};
+  bool has_mid_{false};
+
+ public:
+  void on_book(const OrderBook& book) noexcept {
+    if ((book.changed_mask() & detail::kTopMask) == 0) return;
+    if (!detail::has_two_sides(book)) return;
+    const Fixed mid = detail::mid(book);
+    if (has_mid_ && mid != last_mid_) {
+      // 中價以半 tick 為單位，變動量為小整數
+      changes_.update((mid.raw - last_mid_.raw) >> (Fixed::kFracBits - 1));
+    }
+    last_mid_ = mid;
+    has_mid_ = true;
+  }
+
+  /// @brief 變異數 (tick^2)
+  [[nodiscard]] Fixed value() const noexcept {
+    // 半 tick^2 -> tick^2
+    return {changes_.variance().raw / 4};
+  }
+  [[nodiscard]] int64_t count() const noexcept { return changes_.count(); }
+};
+
+/// @brief 以對手量加權的 microprice (tick)
+///
+/// (bid * ask_qty + ask * bid_qty) / (bid_qty + ask_qty)：買方量較大時
+/// 偏向賣價，反映下一個成交價較可能的方向。
+class Microprice {
+ private:
+  Fixed value_{};
+  bool valid_{false};
+
+ public:
+  void on_book(const OrderBook& book) noexcept {
+    if ((book.changed_mask() & detail::kTopMask) == 0) return;
+    const auto& bid = book.best_bid();
+    const auto& ask = book.best_ask();
+    const int64_t bid_qty = bid.qty.value();
+    const int64_t ask_qty = ask.qty.value();
+    valid_ = detail::has_two_sides(book) && bid_qty + ask_qty > 0;
+    if (!valid_) return;
+    value_ = Fixed::ratio(
+        static_cast<__int128>(bid.price.to_ticks()) * ask_qty +
+            static_cast<__int128>(ask.price.to_ticks()) * bid_qty,
+        bid_qty + ask_qty);
+  }
+
+  [[nodiscard]] Fixed value() const noexcept { return value_; }
+  /// @brief 兩側皆有報價
+  [[nodiscard]] bool valid() const noexcept { return valid_; }
+};
+
+/// @brief 前 Levels 檔的委託量不平衡 (bid - ask) / (bid + ask)，[-1, 1]
+template <size_t Levels = 1>
+  requires(Levels > 0) && (Levels <= OrderBook::kDepth)
+class BookImbalance {
+ private:
+  Fixed value_{};
+
+ public:
+  void on_book(const OrderBook& book) noexcept {
+    if ((book.changed_mask() & detail::kLevelsMask<Levels>) == 0) return;
+    int64_t bid_qty = 0;
+    int64_t ask_qty = 0;
+    for (size_t i = 0; i < Levels; ++i) {
+      bid_qty += book.bid(i).qty.value();
+      ask_qty += book.ask(i).qty.value();
+    }
+    const int64_t total = bid_qty + ask_qty;
+    value_ = total == 0 ? Fixed{} : Fixed::ratio(bid_qty - ask_qty, total);
+  }
+
+  [[nodiscard]] Fixed value() const noexcept { return value_; }
+};
+
+/// @brief 時間視窗內的成交筆數、成交量與成交速率
+///
+/// 以 Clock 為時間軸，而非 R02 的 match_time：後者為當日時間，夜盤
+/// (15:00 ~ 05:00) 跨過午夜時會歸零。TscClock 為單調遞增；回放時
+/// SimulatedClock 由封包時間戳推動，結果同樣可重現。
+///
+/// 每筆成交加入視窗並移出過期者，攤銷 O(1)；視窗內超過 Capacity 筆
+/// 時最舊的成交被提早移出 (Capacity 應依最大成交速率設定)。沒有成交時
+/// 數值不會自行衰減，讀取前應以 expire(now) 移出過期者 (e.g. 在 timer
+/// 或每次 on_book 時)。
+///
+/// @tparam Capacity 視窗內最多保留的成交筆數 (2 的冪次)
+/// @tparam Clock 時間來源 (TscClock 需先呼叫 TSCTimer::calibrate())
+template <size_t Capacity = 1024, sys::Clock Clock = sys::TscClock>
+class TradeIntensity {
+ private:
+  struct Trade {
+    uint64_t time;  ///< clock tick
+    int64_t qty;
+  };
+
+  RingWindow<Trade, Capacity> trades_;
+  uint64_t window_ns_;
+  uint64_t window_ticks_;
+  int64_t volume_{0};
+
+ public:
+  /// @param window_ns 視窗長度 (奈秒)
+  explicit TradeIntensity(uint64_t window_ns) noexcept
+      : window_ns_(window_ns), window_ticks_(Clock::from_ns(window_ns)) {
+    assert(window_ns > 0);
+  }
+
+  void on_trade(const net::taifex::ParsedR02Trade& trade) noexcept {
+    const uint64_t now = Clock::now();
+    expire(now);
+    if (trades_.full()) {
+      volume_ -= trades_.front().qty;
+    }
+    trades_.push({.time = now, .qty = trade.match_qty});
+    volume_ += trade.match_qty;
+  }
+
+  /// @brief 移出 now 時已超出視窗的成交
+  /// @param now Clock tick (e.g. Clock::now())
+  void expire(uint64_t now) noexcept {
+    while (!trades_.empty() && trades_.front().time + window_ticks_ <= now) {
+      volume_ -= trades_.front().qty;
+      trades_.pop_front();
+    }
+  }
+
+  /// @brief 視窗內的成交筆數
+  [[nodiscard]] int64_t trades() const noexcept {
+    return static_cast<int64_t>(trades_.size());
+  }
+  /// @brief 視窗內的成交量
+  [[nodiscard]] int64_t volume() const noexcept { return volume_; }
+  /// @brief 每秒成交筆數
+  [[nodiscard]] Fixed rate() const noexcept {
+    return Fixed::ratio(static_cast<__int128>(trades()) * 1'000'000'000,
+                        window_ns_);
+  }
+};
+
+// ----------------------------------------------------------------------------
+// IndicatorStack
+// ----------------------------------------------------------------------------
+
+/// @brief 至少實作 on_book() 或 on_trade() 其中之一
+template <typename T>
+concept Indicator =
+    requires(T& i, const OrderBook& book) { i.on_book(book); } ||
+    requires(T& i, const net::taifex::ParsedR02Trade& trade) {
+      i.on_trade(trade);
+    };
+
+/// @brief 單一商品的指標組合
+///
+/// 事件依模板參數的順序分派給每個指標；是否實作 on_book / on_trade 以
+/// `if constexpr (requires ...)` 偵測 (與 strategy::StrategyHost 相同)，
+/// 整個 stack 在編譯期展開，沒有 virtual call。
+///
+///     using Signals = IndicatorStack<MidEma<4>, Microprice, BookImbalance<3>,
+///                                    TradeIntensity<>>;
+///     Signals ind({}, {}, {}, TradeIntensity<>(1'000'000'000));
+///
+///     void on_book(InstrumentId, const OrderBook& book) { ind.on_book(book); }
+///     ... ind.get<Microprice>().value() ...
+///
+template <Indicator... Indicators>
+class IndicatorStack {
+ private:
+  std::tuple<Indicators...> items_;
+
+ public:
+  IndicatorStack() = default;
+  explicit IndicatorStack(Indicators... items) noexcept
+      : items_(std::move(items)...) {}
+
+  void on_book(const OrderBook& book) noexcept {
+    std::apply(
+        [&](auto&... item) {
+          (
+              [&] {
+                if constexpr (requires { item.on_book(book); }) {
+                  item.on_book(book);
+                }
+              }(),
+              ...);
+        },
+        items_);
+  }
+
+  void on_trade(const net::taifex::ParsedR02Trade& trade) noexcept {
+    std::apply(
+        [&](auto&... item) {
+          (
+              [&] {
+                if constexpr (requires { item.on_trade(trade); }) {
+                  item.on_trade(trade);
+                }
+              }(),
+              ...);
+        },
+        items_);
+  }
+
+  template <typename T>
+  [[nodiscard]] const T& get() const noexcept {
+    return std::get<T>(items_);
+  }
+  template <size_t I>
+  [[nodiscard]] const auto& get() const noexcept {
+    return std::get<I>(items_);
+  }
+};
+
+}  // namespace tx::market
+
+#endif
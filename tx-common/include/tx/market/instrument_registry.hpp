@@ -0,0 +1,147 @@
+#ifndef TX_TRADING_ENGINE_MARKET_INSTRUMENT_REGISTRY_HPP
+#define TX_TRADING_ENGINE_MARKET_INSTRUMENT_REGISTRY_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <system_error>
+
+#include "tx/error.hpp"
+
+namespace tx::market {
+
+/// @brief 商品在 registry 中的索引 (連續、從 0 開始)
+using InstrumentId = uint32_t;
+
+/// @brief TAIFEX 商品代碼長度 (左靠右補空白)
+inline constexpr size_t kProdIdSize = 20;
+
+/// @brief 商品代碼 -> 連續索引的對照表
+///
+/// 讓 book、策略狀態等以陣列 (而非 map) 存放，hot path 只需一次
+/// open-addressing 查表即可由 wire 上的 prod_id 找到索引。
+/// - 容量固定，建立後查詢不配置記憶體
+/// - 查詢直接使用 wire 上 20 bytes 的 prod_id，不需先 trim
+///
+/// @tparam Capacity 商品數量上限
+/// @note Thread Safety: add() 非執行緒安全，應於啟動階段完成註冊
+///
+template <size_t Capacity>
+  requires(Capacity > 0) && (Capacity < UINT32_MAX / 2)
+class InstrumentRegistry {
+ private:
+  using Symbol = std::array<char, kProdIdSize>;
+
+  static constexpr size_t kBuckets = std::bit_ceil(Capacity * 2);
+  static constexpr size_t kBucketMask = kBuckets - 1;
+  static constexpr uint32_t kEmpty = UINT32_MAX;
+
+  std::array<Symbol, Capacity> symbols_{};  ///< 依 InstrumentId 存放的代碼
+  std::array<uint32_t, kBuckets> table_;    ///< hash bucket -> InstrumentId
+  size_t size_{0};
+
+ public:
+  // ----------------------------------------------------------------------------
+  // 建構函數
+  // ----------------------------------------------------------------------------
+
+  InstrumentRegistry() noexcept { table_.fill(kEmpty); }
+
+  // ----------------------------------------------------------------------------
+  // 註冊
+  // ----------------------------------------------------------------------------
+
+  /// @brief 註冊商品
+  /// @param prod_id 商品代碼 (e.g. "TXFC6")，不含補齊空白
+  /// @return 商品索引 (已註冊則回傳既有索引) 或錯誤
+  [[nodiscard]] Result<InstrumentId> add(std::string_view prod_id) noexcept {
+    if (prod_id.empty() || prod_id.size() > kProdIdSize) {
+      return tx::fail(std::errc::invalid_argument, "Invalid prod_id length");
+    }
+
+    Symbol key;
+    key.fill(' ');
+    std::memcpy(key.data(), prod_id.data(), prod_id.size());
+
+    size_t bucket = hash(key.data()) & kBucketMask;
+    while (table_[bucket] != kEmpty) {
+      if (symbols_[table_[bucket]] == key) {
+        return table_[bucket];
+      }
+      bucket = (bucket + 1) & kBucketMask;
+    }
+
+    if (size_ == Capacity) {
+      return tx::fail(std::errc::no_buffer_space, "InstrumentRegistry full");
+    }
+
+    auto id = static_cast<InstrumentId>(size_++);
+    symbols_[id] = key;
+    table_[bucket] = id;
+    return id;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  /// @brief 以 wire 格式 prod_id 查詢
+  /// @param wire_prod_id 指向 20 bytes (左靠右補空白) 的商品代碼
+  /// @note 與 find() 分開命名，避免字串常值誤用此 overload 而越界讀取
+  [[nodiscard]] std::optional<InstrumentId> find_wire(
+      const char* wire_prod_id) const noexcept {
+    size_t bucket = hash(wire_prod_id) & kBucketMask;
+    while (table_[bucket] != kEmpty) {
+      InstrumentId id = table_[bucket];
+      if (std::memcmp(symbols_[id].data(), wire_prod_id, kProdIdSize) == 0) {
+        return id;
+      }
+      bucket = (bucket + 1) & kBucketMask;
+    }
+    return std::nullopt;
+  }
+
+  /// @brief 以一般字串查詢 (非 hot path)
+  [[nodiscard]] std::optional<InstrumentId> find(
+      std::string_view prod_id) const noexcept {
+    if (prod_id.size() > kProdIdSize) return std::nullopt;
+    Symbol key;
+    key.fill(' ');
+    std::memcpy(key.data(), prod_id.data(), prod_id.size());
+    return find_wire(key.data());
+  }
+
+  /// @brief 取得商品代碼 (去除補齊空白)
+  [[nodiscard]] std::string_view symbol(InstrumentId id) const noexcept {
+    std::string_view sv(symbols_[id].data(), kProdIdSize);
+    return sv.substr(0, sv.find_last_not_of(' ') + 1);
+  }
+
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+  [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+
+ private:
+  /// @brief 20 bytes 代碼的 hash (8 + 8 + 4 bytes 分段相乘混合)
+  [[nodiscard]] static uint64_t hash(const char* p) noexcept {
+    uint64_t a;
+    uint64_t b;
+    uint32_t c;
+    std::memcpy(&a, p, 8);
+    std::memcpy(&b, p + 8, 8);
+    std::memcpy(&c, p + 16, 4);
+
+    uint64_t h = a * 0x9E3779B97F4A7C15ULL;
+    h ^= b * 0xC2B2AE3D27D4EB4FULL;
+    h ^= c * 0x165667B19E3779F9ULL;
+    h ^= h >> 29;
+    return h;
+  }
+};
+
+}  // namespace tx::market
+
+#endif
@@ -0,0 +1,226 @@
+#ifndef TX_TRADING_ENGINE_MARKET_OPTIONS_CHAIN_HPP
+#define TX_TRADING_ENGINE_MARKET_OPTIONS_CHAIN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "tx/core/type.hpp"
+#include "tx/error.hpp"
+#include "tx/market/instrument_registry.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+
+namespace tx::market {
+
+/// @brief 買權 / 賣權
+enum class OptionType : uint8_t { Call = 0, Put = 1 };
+
+/// @brief 到期月份在 chain 中的索引 (依 add_expiry() 順序)
+using ExpiryId = uint16_t;
+
+/// @brief 選擇權序列在 chain 中的位置
+struct OptionKey {
+  ExpiryId expiry;
+  uint32_t strike;  ///< 到期月份內的履約價索引 (依履約價遞增)
+  OptionType type;
+};
+
+/// @brief 單一選擇權的最佳一檔
+struct TopOfBook {
+  core::Price bid = core::Price::invalid();
+  core::Price ask = core::Price::invalid();
+  core::Quantity bid_qty = core::Quantity::zero();
+  core::Quantity ask_qty = core::Quantity::zero();
+};
+
+/// @brief TXO 選擇權序列的 structure-of-arrays 行情表
+///
+/// 數千個序列若各自配置 OrderBook，掃描整條 chain 時每個序列都是一次
+/// cache miss。這裡依「到期月份 -> 履約價 -> 買/賣權」排列，所有序列的
+/// 最佳一檔存放在連續陣列：
+/// - hot：買賣價 (int32 tick) 與數量 (uint32)，買權與賣權各一組陣列，
+///   同一到期月份的履約價相鄰 (slot = expiry 起點 + 履約價索引)
+/// - cold：履約價、最新成交、累積量、更新時間等，掃描時不會載入
+///
+/// 同一 slot 的買權與賣權索引相同，put-call parity 等跨序列計算只需
+/// 對兩組陣列做相同位移的線性走訪。掃描直接走訪 quotes() 的陣列，
+/// 迴圈內無分支即可被編譯器向量化 (見 mid_prices())。
+///
+/// 行情由 InstrumentRegistry 的索引對應：bind() 建立 InstrumentId ->
+/// slot 的表，apply() 只需一次陣列查表。缺少報價的一側以數量 0 表示。
+///
+/// @note Thread Safety: 非執行緒安全 (由行情執行緒更新與掃描)；
+///       add_expiry() / bind() 應於啟動階段完成
+///
+class OptionsChain {
+ public:
+  /// @brief 單一買 / 賣權的最佳一檔陣列 (以 slot 索引)
+  struct Quotes {
+    std::vector<int32_t> bid_px;
+    std::vector<int32_t> ask_px;
+    std::vector<uint32_t> bid_qty;
+    std::vector<uint32_t> ask_qty;
+  };
+
+  /// @brief 掃描時不需要的欄位
+  struct Cold {
+    core::Price last_price = core::Price::invalid();
+    core::Quantity last_qty = core::Quantity::zero();
+    uint64_t total_volume{0};
+    uint32_t update_time{0};
+    uint8_t status{0};  ///< 0:正常, 1:暫停, 2:收盤
+  };
+
+ private:
+  static constexpr uint32_t kUnbound = UINT32_MAX;
+  static constexpr uint32_t kPutBit = 1U << 31;
+
+  struct Expiry {
+    uint32_t contract_month;  ///< YYYYMM
+    uint32_t begin;           ///< 第一個 slot
+    uint32_t size;            ///< 履約價數
+  };
+
+  std::vector<Expiry> expiries_;
+  std::vector<int32_t> strikes_;  ///< 依 slot 的履約價 (tick)
+  Quotes calls_;
+  Quotes puts_;
+  std::vector<Cold> call_cold_;
+  std::vector<Cold> put_cold_;
+  /// @brief InstrumentId -> slot | (Put ? kPutBit : 0)
+  std::vector<uint32_t> legs_;
+
+ public:
+  /// @param max_instruments InstrumentRegistry 的容量 (InstrumentId 上限)
+  explicit OptionsChain(size_t max_instruments);
+
+  // ----------------------------------------------------------------------------
+  // 建立 (啟動階段)
+  // ----------------------------------------------------------------------------
+
+  /// @brief 新增到期月份
+  /// @param contract_month YYYYMM (或 YYYYMMWn 等自訂編碼)
+  /// @param strikes 履約價 (需嚴格遞增)
+  /// @return 到期月份索引
+  [[nodiscard]] Result<ExpiryId> add_expiry(
+      uint32_t contract_month, std::span<const core::Price> strikes);
+
+  /// @brief 將商品對應到 chain 中的位置
+  /// @return 位置不存在或商品索引超過容量時失敗
+  Result<> bind(InstrumentId id, const OptionKey& key) noexcept;
+
+  // ----------------------------------------------------------------------------
+  // 更新
+  // ----------------------------------------------------------------------------
+
+  /// @brief 套用 R06 快照的最佳一檔與最新成交
+  /// @return 最佳一檔是否變動；未 bind() 的商品直接忽略 (false)
+  bool apply(InstrumentId id,
+             const net::taifex::ParsedR06Snapshot& snap) noexcept {
+    if (id >= legs_.size() || legs_[id] == kUnbound) [[unlikely]] {
+      return false;
+    }
+    const uint32_t leg = legs_[id];
+    const uint32_t slot = leg & ~kPutBit;
+    Quotes& quotes = (leg & kPutBit) != 0 ? puts_ : calls_;
+    Cold& cold = (leg & kPutBit) != 0 ? put_cold_[slot] : call_cold_[slot];
+
+    const auto& bid = snap.bid_levels[0];
+    const auto& ask = snap.ask_levels[0];
+    const int32_t bid_px = snap.bid_level_cnt > 0 ? bid.price : 0;
+    const int32_t ask_px = snap.ask_level_cnt > 0 ? ask.price : 0;
+    const uint32_t bid_qty = snap.bid_level_cnt > 0 ? bid.quantity : 0;
+    const uint32_t ask_qty = snap.ask_level_cnt > 0 ? ask.quantity : 0;
+
+    const bool changed =
+        quotes.bid_px[slot] != bid_px || quotes.ask_px[slot] != ask_px ||
+        quotes.bid_qty[slot] != bid_qty || quotes.ask_qty[slot] != ask_qty;
+    quotes.bid_px[slot] = bid_px;
+    quotes.ask_px[slot] = ask_px;
+    quotes.bid_qty[slot] = bid_qty;
+    quotes.ask_qty[slot] = ask_qty;
+
+    cold.last_price = core::Price::from_ticks(snap.last_price);
+    cold.last_qty = core::Quantity::from_value(snap.last_qty);
+    cold.total_volume = snap.total_volume;
+    cold.update_time = snap.update_time;
+    cold.status = snap.prod_status;
+    return changed;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  /// @brief 商品對應的位置
+  [[nodiscard]] std::optional<OptionKey> key_of(InstrumentId id) const noexcept;
+
+  /// @brief 單一序列的最佳一檔 (無報價的一側為 invalid / zero)
+  [[nodiscard]] TopOfBook top(const OptionKey& key) const noexcept {
+    const uint32_t slot = expiries_[key.expiry].begin + key.strike;
+    const Quotes& q = quotes(key.type);
+    TopOfBook top;
+    if (q.bid_qty[slot] > 0) {
+      top.bid = core::Price::from_ticks(q.bid_px[slot]);
+      top.bid_qty = core::Quantity::from_value(q.bid_qty[slot]);
+    }
+    if (q.ask_qty[slot] > 0) {
+      top.ask = core::Price::from_ticks(q.ask_px[slot]);
+      top.ask_qty = core::Quantity::from_value(q.ask_qty[slot]);
+    }
+    return top;
+  }
+
+  [[nodiscard]] const Cold& cold(const OptionKey& key) const noexcept {
+    const uint32_t slot = expiries_[key.expiry].begin + key.strike;
+    return key.type == OptionType::Put ? put_cold_[slot] : call_cold_[slot];
+  }
+
+  /// @brief 整條 chain (所有到期月份) 的買權 / 賣權陣列
+  [[nodiscard]] const Quotes& quotes(OptionType type) const noexcept {
+    return type == OptionType::Put ? puts_ : calls_;
+  }
+
+  /// @brief 到期月份在 quotes() 陣列中的範圍 [begin, begin + size)
+  [[nodiscard]] uint32_t expiry_begin(ExpiryId expiry) const noexcept {
+    return expiries_[expiry].begin;
+  }
+  [[nodiscard]] uint32_t strike_count(ExpiryId expiry) const noexcept {
+    return expiries_[expiry].size;
+  }
+  [[nodiscard]] uint32_t contract_month(ExpiryId expiry) const noexcept {
+    return expiries_[expiry].contract_month;
+  }
+
+  /// @brief 到期月份的履約價 (tick，遞增)
+  [[nodiscard]] std::span<const int32_t> strikes(
+      ExpiryId expiry) const noexcept {
+    return std::span(strikes_).subspan(expiries_[expiry].begin,
+                                       expiries_[expiry].size);
+  }
+
+  [[nodiscard]] size_t expiry_count() const noexcept {
+    return expiries_.size();
+  }
+  /// @brief 所有到期月份的履約價總數 (= quotes() 陣列長度)
+  [[nodiscard]] size_t slot_count() const noexcept { return strikes_.size(); }
+
+  // ----------------------------------------------------------------------------
+  // 掃描
+  // ----------------------------------------------------------------------------
+
+  /// @brief 計算到期月份內每個履約價的中價 (tick)
+  ///
+  /// 兩側皆有報價時為 (bid + ask) / 2，否則為 NaN。迴圈以 select 取代
+  /// 分支，可展開為 SIMD。
+  ///
+  /// @param out 長度需 >= strike_count(expiry)
+  void mid_prices(OptionType type, ExpiryId expiry,
+                  std::span<double> out) const noexcept;
+};
+
+}  // namespace tx::market
+
+#endif
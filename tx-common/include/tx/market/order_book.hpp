@@ -0,0 +1,148 @@
+#ifndef TX_TRADING_ENGINE_MARKET_ORDER_BOOK_HPP
+#define TX_TRADING_ENGINE_MARKET_ORDER_BOOK_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "tx/core/type.hpp"
+#include "tx/net/taifex/parser.hpp"
+
+namespace tx::market {
+
+/// @brief 單一價位
+struct BookLevel {
+  core::Price price = core::Price::invalid();
+  core::Quantity qty = core::Quantity::zero();
+  uint32_t order_count = 0;
+
+  [[nodiscard]] constexpr bool operator==(const BookLevel&) const noexcept =
+      default;
+};
+
+/// @brief 五檔行情簿 (由 R06 快照與 R02 成交維護)
+///
+/// 每次 apply() 都會回傳並保存「變動價位遮罩」，下游 (策略、合成價差、
+/// 指標) 可只針對有變動的價位重新計算，而不是每則訊息都全部重算。
+/// - bit [0, kDepth): 買方第 i 檔
+/// - bit [kDepth, 2 * kDepth): 賣方第 i 檔
+/// - kTradeBit: 最新成交 (last price/qty) 變動
+///
+class OrderBook {
+ public:
+  static constexpr size_t kDepth = 5;
+
+  static constexpr uint16_t kBidMask = (1U << kDepth) - 1;
+  static constexpr uint16_t kAskMask = kBidMask << kDepth;
+  static constexpr uint16_t kTradeBit = 1U << (2 * kDepth);
+
+  [[nodiscard]] static constexpr uint16_t bid_bit(size_t level) noexcept {
+    return static_cast<uint16_t>(1U << level);
+  }
+  [[nodiscard]] static constexpr uint16_t ask_bit(size_t level) noexcept {
+    return static_cast<uint16_t>(1U << (kDepth + level));
+  }
+
+ private:
+  std::array<BookLevel, kDepth> bids_{};
+  std::array<BookLevel, kDepth> asks_{};
+  uint8_t bid_depth_{0};
+  uint8_t ask_depth_{0};
+  uint8_t status_{0};    ///< 0:正常, 1:暫停, 2:收盤
+  uint16_t changed_{0};  ///< 最近一次 apply() 的變動遮罩
+  uint32_t update_time_{0};
+  core::Price last_price_ = core::Price::invalid();
+  core::Quantity last_qty_ = core::Quantity::zero();
+  uint64_t total_volume_{0};
+
+ public:
+  // ----------------------------------------------------------------------------
+  // 更新
+  // ----------------------------------------------------------------------------
+
+  /// @brief 套用 R06 五檔快照
+  /// @return 變動價位遮罩
+  uint16_t apply(const net::taifex::ParsedR06Snapshot& snap) noexcept {
+    uint16_t mask = 0;
+
+    bid_depth_ = std::min<uint8_t>(snap.bid_level_cnt, kDepth);
+    ask_depth_ = std::min<uint8_t>(snap.ask_level_cnt, kDepth);
+
+    for (size_t i = 0; i < kDepth; ++i) {
+      BookLevel bid =
+          i < bid_depth_ ? to_level(snap.bid_levels[i]) : BookLevel{};
+      BookLevel ask =
+          i < ask_depth_ ? to_level(snap.ask_levels[i]) : BookLevel{};
+      if (bids_[i] != bid) {
+        bids_[i] = bid;
+        mask |= bid_bit(i);
+      }
+      if (asks_[i] != ask) {
+        asks_[i] = ask;
+        mask |= ask_bit(i);
+      }
+    }
+
+    auto last_price = core::Price::from_ticks(snap.last_price);
+    auto last_qty = core::Quantity::from_value(snap.last_qty);
+    if (last_price != last_price_ || last_qty != last_qty_) {
+      last_price_ = last_price;
+      last_qty_ = last_qty;
+      mask |= kTradeBit;
+    }
+
+    status_ = snap.prod_status;
+    update_time_ = snap.update_time;
+    total_volume_ = snap.total_volume;
+    changed_ = mask;
+    return mask;
+  }
+
+  /// @brief 套用 R02 成交
+  /// @return 變動遮罩 (僅 kTradeBit)
+  uint16_t apply(const net::taifex::ParsedR02Trade& trade) noexcept {
+    last_price_ = core::Price::from_ticks(trade.match_price);
+    last_qty_ = core::Quantity::from_value(trade.match_qty);
+    total_volume_ = trade.total_volume;
+    changed_ = kTradeBit;
+    return changed_;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] const BookLevel& bid(size_t level) const noexcept {
+    return bids_[level];
+  }
+  [[nodiscard]] const BookLevel& ask(size_t level) const noexcept {
+    return asks_[level];
+  }
+  [[nodiscard]] size_t bid_depth() const noexcept { return bid_depth_; }
+  [[nodiscard]] size_t ask_depth() const noexcept { return ask_depth_; }
+
+  [[nodiscard]] const BookLevel& best_bid() const noexcept { return bids_[0]; }
+  [[nodiscard]] const BookLevel& best_ask() const noexcept { return asks_[0]; }
+
+  /// @brief 最近一次 apply() 的變動遮罩
+  [[nodiscard]] uint16_t changed_mask() const noexcept { return changed_; }
+
+  [[nodiscard]] core::Price last_price() const noexcept { return last_price_; }
+  [[nodiscard]] core::Quantity last_qty() const noexcept { return last_qty_; }
+  [[nodiscard]] uint64_t total_volume() const noexcept { return total_volume_; }
+  [[nodiscard]] uint32_t update_time() const noexcept { return update_time_; }
+  [[nodiscard]] uint8_t status() const noexcept { return status_; }
+
+ private:
+  [[nodiscard]] static BookLevel to_level(
+      const net::taifex::ParsedR06Level& lv) noexcept {
+    return BookLevel{.price = core::Price::from_ticks(lv.price),
+                     .qty = core::Quantity::from_value(lv.quantity),
+                     .order_count = lv.order_count};
+  }
+};
+
+}  // namespace tx::market
+
+#endif
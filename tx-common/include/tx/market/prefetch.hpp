@@ -0,0 +1,113 @@
+#ifndef TX_TRADING_ENGINE_MARKET_PREFETCH_HPP
+#define TX_TRADING_ENGINE_MARKET_PREFETCH_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <optional>
+
+#include "tx/market/instrument_registry.hpp"
+#include "tx/net/taifex/packet_iterator.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+
+namespace tx::market {
+
+/// @brief 預設的 look-ahead 訊息數
+///
+/// 一則 R06 的解碼加套用約為數十 ns，與一次 DRAM miss 相當；提前 4 則
+/// 足以蓋過延遲，又不會讓預取的 cache line 在使用前被擠出 L1。
+inline constexpr size_t kDefaultPrefetchDistance = 4;
+
+/// @brief 預取物件涵蓋的所有 cache line (準備寫入)
+template <typename T>
+inline void prefetch_for_write(const T& object) noexcept {
+  constexpr size_t kLine = 64;
+  const auto* p = reinterpret_cast<const char*>(&object);
+  for (size_t off = 0; off < sizeof(T); off += kLine) {
+    __builtin_prefetch(p + off, 1, 3);
+  }
+}
+
+/// @brief 由訊息的 prod_id 查詢商品索引 (R06/R02 的 prod_id 緊接在
+///        MessageHeader 之後)
+/// @return 未註冊或訊息過短時為 nullopt
+template <size_t Capacity>
+[[nodiscard]] inline std::optional<InstrumentId> resolve_instrument(
+    const InstrumentRegistry<Capacity>& registry,
+    const net::taifex::MessageView& msg) noexcept {
+  if (msg.bytes.size() < sizeof(net::taifex::MessageHeader) + kProdIdSize)
+      [[unlikely]] {
+    return std::nullopt;
+  }
+  return registry.find_wire(reinterpret_cast<const char*>(msg.bytes.data()) +
+                            sizeof(net::taifex::MessageHeader));
+}
+
+/// @brief 以 look-ahead 預取走訪封包內的訊息
+///
+/// 一個封包內的數十則訊息各自對應不同商品，依序處理時每則訊息第一次
+/// 存取 book 都是 cache miss。此迴圈先解析後面 Distance 則訊息的商品
+/// 索引並發出預取，再處理目前的訊息，讓記憶體延遲與處理重疊：
+///
+///     resolve(0..D-1) + prefetch
+///     for i: resolve(i+D) + prefetch; process(i)
+///
+/// 商品索引只查詢一次 (於預取時) 並隨訊息保存。Distance = 0 即為依序
+/// 處理 (不預取)。
+///
+/// @tparam Distance look-ahead 訊息數
+/// @param resolve `std::optional<InstrumentId> resolve(const MessageView&)`
+/// @param prefetch `void prefetch(InstrumentId)`，預取 book 與狀態
+/// @param process `void process(const MessageView&, InstrumentId)`，
+///                只對 resolve 成功的訊息呼叫，順序與封包內相同
+template <size_t Distance = kDefaultPrefetchDistance, typename ResolveFn,
+          typename PrefetchFn, typename ProcessFn>
+inline void for_each_prefetched(net::taifex::PacketIterator& it,
+                                ResolveFn&& resolve, PrefetchFn&& prefetch,
+                                ProcessFn&& process) noexcept {
+  using net::taifex::MessageView;
+
+  if constexpr (Distance == 0) {
+    while (auto msg = it.next()) {
+      if (auto id = resolve(*msg)) {
+        process(*msg, *id);
+      }
+    }
+  } else {
+    struct Pending {
+      MessageView msg;
+      InstrumentId id;
+    };
+    // 2 的冪次 ring，索引只需 mask
+    constexpr size_t kSlots = std::bit_ceil(Distance + 1);
+    std::array<Pending, kSlots> window;
+    size_t head = 0;
+    size_t tail = 0;
+
+    // 取得下一則已註冊的訊息並預取
+    auto fill = [&]() noexcept {
+      while (auto msg = it.next()) {
+        if (auto id = resolve(*msg)) {
+          prefetch(*id);
+          window[tail & (kSlots - 1)] = Pending{.msg = *msg, .id = *id};
+          ++tail;
+          return true;
+        }
+      }
+      return false;
+    };
+
+    for (size_t i = 0; i < Distance && fill(); ++i) {
+    }
+    while (head != tail) {
+      const Pending cur = window[head & (kSlots - 1)];
+      ++head;
+      fill();
+      process(cur.msg, cur.id);
+    }
+  }
+}
+
+}  // namespace tx::market
+
+#endif
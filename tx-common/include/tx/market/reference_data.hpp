@@ -0,0 +1,76 @@
+#ifndef TX_TRADING_ENGINE_MARKET_REFERENCE_DATA_HPP
+#define TX_TRADING_ENGINE_MARKET_REFERENCE_DATA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "tx/core/type.hpp"
+#include "tx/market/instrument_registry.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+#include "tx/sync/rcu.hpp"
+
+namespace tx::market {
+
+/// @brief 商品參考資料 (價格單位與行情相同，為 tick)
+struct InstrumentSpec {
+  int32_t reference_price{0};  ///< 參考價
+  int32_t upper_limit{0};      ///< 漲停價
+  int32_t lower_limit{0};      ///< 跌停價
+  int32_t tick_size{1};        ///< 最小升降單位
+  int32_t multiplier{0};       ///< 每點契約價值 (TWD)
+  uint8_t decimal_locator{0};  ///< 價格小數位數
+  uint32_t trade_date{0};      ///< YYYYMMDD
+  bool listed{false};          ///< 是否已收到參考資料
+};
+
+/// @brief 以 InstrumentId 索引的參考資料表 (不可變版本)
+///
+/// 盤中透過 ReferenceData 發布：寫入端複製目前版本、套用 I01 或手動
+/// 調整後整份換上，讀取端看到的永遠是一致的版本。
+class ReferenceTable {
+ private:
+  std::vector<InstrumentSpec> specs_;
+
+ public:
+  /// @param max_instruments InstrumentRegistry 的容量 (InstrumentId 上限)
+  explicit ReferenceTable(size_t max_instruments);
+
+  /// @brief 商品參考資料；未上市或超過容量時為 nullptr
+  [[nodiscard]] const InstrumentSpec* find(InstrumentId id) const noexcept {
+    if (id >= specs_.size() || !specs_[id].listed) [[unlikely]] {
+      return nullptr;
+    }
+    return &specs_[id];
+  }
+
+  /// @brief 價格是否在漲跌停範圍內且為最小升降單位的整數倍
+  [[nodiscard]] static bool is_tradable(const InstrumentSpec& spec,
+                                        core::Price price) noexcept {
+    const int64_t ticks = price.to_ticks();
+    return ticks >= spec.lower_limit && ticks <= spec.upper_limit &&
+           ticks % spec.tick_size == 0;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 建立 (寫入端)
+  // ----------------------------------------------------------------------------
+
+  /// @brief 設定商品參考資料 (標記為已上市)
+  /// @return 商品索引超過容量或 tick_size <= 0 時失敗
+  Result<> set(InstrumentId id, const InstrumentSpec& spec) noexcept;
+
+  /// @brief 套用 I01：更新參考價、漲跌停與交易日，保留 tick_size 與
+  ///        multiplier
+  Result<> apply(InstrumentId id,
+                 const net::taifex::ParsedI01ProductInfo& info) noexcept;
+
+  [[nodiscard]] size_t capacity() const noexcept { return specs_.size(); }
+};
+
+/// @brief 盤中可更新的參考資料 (讀取端只需一次 load)
+using ReferenceData = sync::Rcu<ReferenceTable>;
+
+}  // namespace tx::market
+
+#endif
@@ -0,0 +1,210 @@
+#ifndef TX_TRADING_ENGINE_MARKET_SPREAD_BOOK_HPP
+#define TX_TRADING_ENGINE_MARKET_SPREAD_BOOK_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "tx/core/type.hpp"
+#include "tx/error.hpp"
+#include "tx/market/instrument_registry.hpp"
+#include "tx/market/order_book.hpp"
+
+namespace tx::market {
+
+/// @brief 價差在 SpreadBook 中的索引 (依 add_spread() 順序)
+using SpreadId = uint32_t;
+
+/// @brief 價差的一隻腳
+///
+/// 價差價格 = sum(price_ratio * 腳的價格)。買進價差時 price_ratio > 0 的腳
+/// 買進 (吃 ask)、< 0 的腳賣出 (吃 bid)；qty_ratio 為每一單位價差的口數。
+///
+/// e.g. TXF / MXF 價差 (1 口 TXF 對 4 口 MXF，價格以點數相減)：
+///     {.instrument = txf, .price_ratio = 1, .qty_ratio = 1}
+///     {.instrument = mxf, .price_ratio = -1, .qty_ratio = 4}
+/// 跨月價差：{near, 1, 1}、{far, -1, 1}
+struct SpreadLeg {
+  InstrumentId instrument;
+  int32_t price_ratio;  ///< 價格係數 (非 0，正負號決定買賣方向)
+  uint32_t qty_ratio;   ///< 每單位價差的口數 (> 0)
+};
+
+/// @brief 價差的隱含最佳一檔
+struct ImpliedQuote {
+  core::Price bid = core::Price::invalid();
+  core::Price ask = core::Price::invalid();
+  core::Quantity bid_qty = core::Quantity::zero();  ///< 價差單位
+  core::Quantity ask_qty = core::Quantity::zero();
+};
+
+/// @brief 由各腳 OrderBook 推導的價差 / 基差 book
+///
+/// 每個價差快取各腳的最佳一檔，腳的 book 更新時只在 changed_mask() 含
+/// 第一檔 (bid_bit(0) / ask_bit(0)) 時重算訂閱該商品的價差，深檔變動與
+/// 純成交訊息直接略過。重算只走訪該價差的腳 (<= kMaxLegs)，全部為整數
+/// 運算 (tick 與口數)。
+///
+/// 隱含買價 = sum(r > 0 ? r * bid : r * ask)，數量為各腳可成交量除以
+/// qty_ratio 的最小值；任一腳缺少所需的一側時該側為 invalid。
+///
+///     SpreadBook spreads(registry.capacity());
+///     auto basis = spreads.add_spread({{{txf, 1, 1}, {mxf, -1, 4}}});
+///     ...
+///     void on_book(InstrumentId id, const OrderBook& book) {
+///       spreads.on_book(id, book, [&](SpreadId s, const ImpliedQuote& q) {
+///         ...
+///       });
+///     }
+///
+/// @note Thread Safety: 非執行緒安全 (由行情執行緒更新)；add_spread()
+///       應於啟動階段完成
+///
+class SpreadBook {
+ public:
+  /// @brief 每個價差的腳數上限 (butterfly / condor)
+  static constexpr size_t kMaxLegs = 4;
+
+  /// @brief 影響隱含價格的 book 變動
+  static constexpr uint16_t kLegMask =
+      OrderBook::bid_bit(0) | OrderBook::ask_bit(0);
+
+ private:
+  /// @brief 腳的最佳一檔快取 (數量 0 表示該側無報價)
+  struct LegQuote {
+    int64_t bid_px{0};
+    int64_t ask_px{0};
+    int64_t bid_qty{0};
+    int64_t ask_qty{0};
+  };
+
+  struct Spread {
+    std::array<SpreadLeg, kMaxLegs> legs{};
+    std::array<LegQuote, kMaxLegs> quotes{};
+    uint32_t leg_count{0};
+    ImpliedQuote implied;
+  };
+
+  /// @brief 商品被哪些價差的哪隻腳引用
+  struct Subscription {
+    SpreadId spread;
+    uint32_t leg;
+  };
+
+  std::vector<Spread> spreads_;
+  std::vector<std::vector<Subscription>> subscribers_;  ///< 以 InstrumentId
+
+ public:
+  /// @param max_instruments InstrumentRegistry 的容量 (InstrumentId 上限)
+  explicit SpreadBook(size_t max_instruments);
+
+  // ----------------------------------------------------------------------------
+  // 建立 (啟動階段)
+  // ----------------------------------------------------------------------------
+
+  /// @brief 新增價差
+  /// @param legs 2 ~ kMaxLegs 隻腳
+  /// @return 價差索引；腳數、係數不合法或商品索引超過容量時失敗
+  [[nodiscard]] Result<SpreadId> add_spread(std::span<const SpreadLeg> legs);
+
+  // ----------------------------------------------------------------------------
+  // 更新
+  // ----------------------------------------------------------------------------
+
+  /// @brief 套用腳的 book 變動
+  /// @param on_change `void(SpreadId, const ImpliedQuote&)`，隱含報價變動
+  ///        時呼叫
+  /// @return 隱含報價變動的價差數
+  template <typename F>
+  size_t on_book(InstrumentId id, const OrderBook& book, F&& on_change) {
+    if ((book.changed_mask() & kLegMask) == 0) return 0;
+    if (id >= subscribers_.size()) [[unlikely]] return 0;
+
+    const LegQuote quote = to_leg_quote(book);
+    size_t changed = 0;
+    for (const auto& sub : subscribers_[id]) {
+      Spread& spread = spreads_[sub.spread];
+      spread.quotes[sub.leg] = quote;
+      const ImpliedQuote implied = compute(spread);
+      if (same(implied, spread.implied)) continue;
+      spread.implied = implied;
+      on_change(sub.spread, spread.implied);
+      ++changed;
+    }
+    return changed;
+  }
+
+  size_t on_book(InstrumentId id, const OrderBook& book) {
+    return on_book(id, book, [](SpreadId, const ImpliedQuote&) {});
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] const ImpliedQuote& implied(SpreadId spread) const noexcept {
+    return spreads_[spread].implied;
+  }
+
+  [[nodiscard]] std::span<const SpreadLeg> legs(
+      SpreadId spread) const noexcept {
+    return std::span(spreads_[spread].legs)
+        .first(spreads_[spread].leg_count);
+  }
+
+  [[nodiscard]] size_t size() const noexcept { return spreads_.size(); }
+
+ private:
+  [[nodiscard]] static LegQuote to_leg_quote(const OrderBook& book) noexcept {
+    const auto& bid = book.best_bid();
+    const auto& ask = book.best_ask();
+    const bool has_bid = book.bid_depth() > 0;
+    const bool has_ask = book.ask_depth() > 0;
+    return {.bid_px = has_bid ? bid.price.to_ticks() : 0,
+            .ask_px = has_ask ? ask.price.to_ticks() : 0,
+            .bid_qty = has_bid ? bid.qty.value() : 0,
+            .ask_qty = has_ask ? ask.qty.value() : 0};
+  }
+
+  [[nodiscard]] static ImpliedQuote compute(const Spread& spread) noexcept {
+    int64_t bid_px = 0;
+    int64_t ask_px = 0;
+    int64_t bid_qty = INT64_MAX;
+    int64_t ask_qty = INT64_MAX;
+    for (uint32_t i = 0; i < spread.leg_count; ++i) {
+      const SpreadLeg& leg = spread.legs[i];
+      const LegQuote& q = spread.quotes[i];
+      const auto ratio = static_cast<int64_t>(leg.qty_ratio);
+      // 賣出價差：正係數的腳賣在 bid、負係數的腳買在 ask；買進相反
+      const bool buy_leg = leg.price_ratio > 0;
+      bid_px += leg.price_ratio * (buy_leg ? q.bid_px : q.ask_px);
+      ask_px += leg.price_ratio * (buy_leg ? q.ask_px : q.bid_px);
+      bid_qty = std::min(bid_qty, (buy_leg ? q.bid_qty : q.ask_qty) / ratio);
+      ask_qty = std::min(ask_qty, (buy_leg ? q.ask_qty : q.bid_qty) / ratio);
+    }
+
+    ImpliedQuote implied;
+    if (bid_qty > 0) {
+      implied.bid = core::Price::from_ticks(bid_px);
+      implied.bid_qty = core::Quantity::from_value(bid_qty);
+    }
+    if (ask_qty > 0) {
+      implied.ask = core::Price::from_ticks(ask_px);
+      implied.ask_qty = core::Quantity::from_value(ask_qty);
+    }
+    return implied;
+  }
+
+  [[nodiscard]] static bool same(const ImpliedQuote& a,
+                                 const ImpliedQuote& b) noexcept {
+    return a.bid == b.bid && a.ask == b.ask && a.bid_qty == b.bid_qty &&
+           a.ask_qty == b.ask_qty;
+  }
+};
+
+}  // namespace tx::market
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef TX_TRADING_ENGINE_MEM_OBJECT_POOL_HPP
+#define TX_TRADING_ENGINE_MEM_OBJECT_POOL_HPP
+
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace tx::mem {
+
+/// @brief 固定容量物件池
+///
+/// 預先配置 Capacity 個物件的儲存空間，取得/歸還皆為 O(1) 且不會觸發
+/// heap 配置，適合 hot path 上頻繁建立/銷毀的小物件 (e.g. timer node)。
+/// - 以 free-list 串接空閒 slot，index 為 uint32_t
+/// - 提供 index_of()/at() 讓上層以 index 作為穩定 handle
+/// - Thread Safety: 非執行緒安全，只能由單一執行緒使用
+///
+template <typename T, size_t Capacity>
+  requires(Capacity > 0) && (Capacity <= UINT32_MAX)
+class ObjectPool {
+ private:
+  static constexpr uint32_t kNil = UINT32_MAX;  ///< free-list 結尾
+
+  struct alignas(T) Storage {
+    std::byte bytes[sizeof(T)];
+  };
+
+  std::array<Storage, Capacity> slots_;    ///< 物件實際存放位置
+  std::array<uint32_t, Capacity> next_{};  ///< free-list 下一個 index
+  uint32_t free_head_{0};                  ///< free-list 起點
+  size_t size_{0};                         ///< 使用中物件數量
+
+ public:
+  // ----------------------------------------------------------------------------
+  // MARK: 建構函數
+  // ----------------------------------------------------------------------------
+
+  ObjectPool() noexcept {
+    for (uint32_t i = 0; i < Capacity; ++i) {
+      next_[i] = i + 1;
+    }
+    next_[Capacity - 1] = kNil;
+  }
+
+  // ----------------------------------------------------------------------------
+  // MARK: RAII
+  // ----------------------------------------------------------------------------
+
+  /// @warning 解構時不會呼叫仍在使用中物件的解構子，呼叫端需自行歸還
+  ~ObjectPool() noexcept = default;
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+  ObjectPool(ObjectPool&&) = delete;
+  ObjectPool& operator=(ObjectPool&&) = delete;
+
+  // ----------------------------------------------------------------------------
+  // MARK: 狀態查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+  [[nodiscard]] size_t size() const noexcept { return size_; }
+  [[nodiscard]] size_t available() const noexcept { return Capacity - size_; }
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] bool full() const noexcept { return free_head_ == kNil; }
+
+  // ----------------------------------------------------------------------------
+  // MARK: 操作
+  // ----------------------------------------------------------------------------
+
+  /// @brief 取得一個物件並原地建構
+  ///
+  /// @return 物件指標，池已滿時為 nullptr
+  template <typename... Args>
+    requires std::constructible_from<T, Args...>
+  [[nodiscard]] T* acquire(Args&&... args) noexcept {
+    if (free_head_ == kNil) [[unlikely]] {
+      return nullptr;
+    }
+
+    uint32_t idx = free_head_;
+    free_head_ = next_[idx];
+    ++size_;
+
+    return ::new (static_cast<void*>(slots_[idx].bytes))
+        T(std::forward<Args>(args)...);
+  }
+
+  /// @brief 歸還物件 (會呼叫解構子)
+  ///
+  /// @param obj 必須為本池 acquire() 取得的指標
+  void release(T* obj) noexcept {
+    uint32_t idx = index_of(obj);
+    std::destroy_at(obj);
+
+    next_[idx] = free_head_;
+    free_head_ = idx;
+    --size_;
+  }
+
+  /// @brief 取得物件在池中的 index
+  [[nodiscard]] uint32_t index_of(const T* obj) const noexcept {
+    const auto* base = reinterpret_cast<const std::byte*>(slots_.data());
+    const auto* ptr = reinterpret_cast<const std::byte*>(obj);
+    assert(ptr >= base && ptr < base + sizeof(slots_));
+    return static_cast<uint32_t>(static_cast<size_t>(ptr - base) /
+                                 sizeof(Storage));
+  }
+
+  /// @brief 以 index 取得物件
+  /// @warning 呼叫端需確保該 index 上的物件仍在使用中
+  [[nodiscard]] T* at(uint32_t idx) noexcept {
+    assert(idx < Capacity);
+    return std::launder(reinterpret_cast<T*>(slots_[idx].bytes));
+  }
+
+  [[nodiscard]] const T* at(uint32_t idx) const noexcept {
+    assert(idx < Capacity);
+    return std::launder(reinterpret_cast<const T*>(slots_[idx].bytes));
+  }
+};
+
+}  // namespace tx::mem
+
+#endif
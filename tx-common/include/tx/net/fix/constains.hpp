@@ -1,6 +1,8 @@
 #ifndef TX_TRADING_ENGINE_NET_FIX_FIELD_HPP
 #define TX_TRADING_ENGINE_NET_FIX_FIELD_HPP
 
+#include <cstddef>
+
 namespace tx::net::fix {
 
 /// @brief SOH (Start of Header)
@@ -23,9 +25,32 @@ inline constexpr int Side = 54;
 inline constexpr int OrderQty = 38;
 inline constexpr int OrdType = 40;
 inline constexpr int Price = 44;
+inline constexpr int OrderID = 37;
+inline constexpr int ExecID = 17;
+inline constexpr int ExecType = 150;
+inline constexpr int OrdStatus = 39;
+inline constexpr int OrigClOrdID = 41;
+inline constexpr int LastQty = 32;
+inline constexpr int LastPx = 31;
+inline constexpr int LeavesQty = 151;
+inline constexpr int CumQty = 14;
+inline constexpr int AvgPx = 6;
+inline constexpr int TransactTime = 60;
+inline constexpr int Text = 58;
 
 }  // namespace tags
 
+namespace constraints {
+
+inline constexpr size_t kDefaultFieldCapacity = 32;
+inline constexpr size_t kMaxBodyLength = 99999;
+inline constexpr int kChecksumModulo = 256;
+inline constexpr size_t kBodyLengthMaxDigits = 5;  // "99999" = 5
+inline constexpr size_t kBodyLengthFieldReserve =
+    2 + kBodyLengthMaxDigits + 1;  // "9=" + 5 digits + SOH = 8
+
+}  // namespace constraints
+
 }  // namespace tx::net::fix
 
 #endif
@@ -8,19 +8,21 @@
 namespace tx::net::fix {
 
 enum class FixErrc : uint8_t {
-  InvalidFormat,       ///< 格式錯誤
-  InvalidCheckSum,     ///< Checksum 不正確
-  InvalidSeqSum,       ///< SeqSum 格式錯誤
-  MissingBeginString,  ///< 缺少 Tag 8
-  MissingBodyLength,   ///< 缺少 Tag 9
-  MissingMsgType,      ///< 缺少 Tag 35
-  MissingSender,       ///< 缺少 Tag 49
-  MissingTarget,       ///< 缺少 Tag 56
-  MissingSendingTime,  ///< 缺少 Tag 52
-  BodyLengthExceeded,  ///< 超過 Body 上限
-  MissingChecksum,     ///< 缺少 Tag 10
-  BodyLengthMismatch,  ///< BodyLength 與實際不符
-  EmptyMessage         ///< 空訊息
+  InvalidFormat = 1,    ///< 格式錯誤 (0 保留給「無錯誤」)
+  InvalidCheckSum,      ///< Checksum 不正確
+  InvalidSeqSum,        ///< SeqSum 格式錯誤
+  MissingBeginString,   ///< 缺少 Tag 8
+  MissingBodyLength,    ///< 缺少 Tag 9
+  MissingMsgType,       ///< 缺少 Tag 35
+  MissingSender,        ///< 缺少 Tag 49
+  MissingTarget,        ///< 缺少 Tag 56
+  MissingSendingTime,   ///< 缺少 Tag 52
+  BodyLengthExceeded,   ///< 超過 Body 上限
+  MissingChecksum,      ///< 缺少 Tag 10
+  BodyLengthMismatch,   ///< BodyLength 與實際不符
+  EmptyMessage,         ///< 空訊息
+  InvalidFieldValue,    ///< 欄位值無法轉為 schema 型別
+  MissingRequiredField  ///< 缺少 schema 的必要欄位
 };
 
 class FixCategory : public std::error_category {
@@ -31,6 +33,8 @@ class FixCategory : public std::error_category {
 
 const FixCategory& category();
 
+std::error_code make_error_code(FixErrc ec) noexcept;
+
 }  // namespace tx::net::fix
 
 template <>
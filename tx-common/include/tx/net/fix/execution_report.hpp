@@ -0,0 +1,58 @@
+#ifndef TX_TRADING_ENGINE_NET_FIX_EXECUTION_REPORT_HPP
+#define TX_TRADING_ENGINE_NET_FIX_EXECUTION_REPORT_HPP
+
+#include <optional>
+#include <string_view>
+
+#include "tx/core/type.hpp"
+#include "tx/net/fix/constains.hpp"
+#include "tx/net/fix/schema.hpp"
+
+namespace tx::net::fix {
+
+/// @brief ExecutionReport (MsgType = 8)
+/// @note string_view 欄位指向原始訊息
+struct ExecutionReport {
+  std::string_view order_id;                           ///< Tag 37
+  std::string_view cl_ord_id;                          ///< Tag 11
+  std::string_view orig_cl_ord_id;                     ///< Tag 41 (改單 / 刪單回報)
+  std::string_view exec_id;                            ///< Tag 17
+  char exec_type{};                                    ///< Tag 150
+  char ord_status{};                                   ///< Tag 39
+  std::string_view symbol;                             ///< Tag 55
+  core::Side side{};                                   ///< Tag 54
+  core::Quantity order_qty = core::Quantity::zero();   ///< Tag 38
+  std::optional<core::Price> price;                    ///< Tag 44 (市價單沒有)
+  std::optional<core::Quantity> last_qty;              ///< Tag 32 (成交回報)
+  std::optional<core::Price> last_px;                  ///< Tag 31 (成交回報)
+  core::Quantity leaves_qty = core::Quantity::zero();  ///< Tag 151
+  core::Quantity cum_qty = core::Quantity::zero();     ///< Tag 14
+  std::optional<core::Price> avg_px;                   ///< Tag 6
+  std::string_view transact_time;                      ///< Tag 60
+  std::string_view text;                               ///< Tag 58
+};
+
+/// @brief ExecutionReport 的 schema (必要欄位依 FIX 4.4)
+using ExecutionReportSchema = schema::Message<
+    ExecutionReport,
+    schema::Required<tags::OrderID, &ExecutionReport::order_id>,
+    schema::Optional<tags::ClOrdID, &ExecutionReport::cl_ord_id>,
+    schema::Optional<tags::OrigClOrdID, &ExecutionReport::orig_cl_ord_id>,
+    schema::Required<tags::ExecID, &ExecutionReport::exec_id>,
+    schema::Required<tags::ExecType, &ExecutionReport::exec_type>,
+    schema::Required<tags::OrdStatus, &ExecutionReport::ord_status>,
+    schema::Required<tags::Symbol, &ExecutionReport::symbol>,
+    schema::Required<tags::Side, &ExecutionReport::side>,
+    schema::Optional<tags::OrderQty, &ExecutionReport::order_qty>,
+    schema::Optional<tags::Price, &ExecutionReport::price>,
+    schema::Optional<tags::LastQty, &ExecutionReport::last_qty>,
+    schema::Optional<tags::LastPx, &ExecutionReport::last_px>,
+    schema::Required<tags::LeavesQty, &ExecutionReport::leaves_qty>,
+    schema::Required<tags::CumQty, &ExecutionReport::cum_qty>,
+    schema::Optional<tags::AvgPx, &ExecutionReport::avg_px>,
+    schema::Optional<tags::TransactTime, &ExecutionReport::transact_time>,
+    schema::Optional<tags::Text, &ExecutionReport::text>>;
+
+}  // namespace tx::net::fix
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef TX_TRADING_ENGINE_NET_FIX_FRAMER_HPP
+#define TX_TRADING_ENGINE_NET_FIX_FRAMER_HPP
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/net/fix/error.hpp"
+
+namespace tx::net::fix {
+
+/// @brief 從 TCP byte stream 切出完整 FIX 訊息 (零複製)
+///
+/// socket 直接 recv 進 framer 的接收緩衝區 (prepare()/commit())，
+/// next() 只檢查標頭：
+///
+///     8=FIX.4.4<SOH>9=<len><SOH> ... body (len bytes) ... 10=ddd<SOH>
+///
+/// 讀到 BodyLength 後直接跳到 trailer 位置驗證 `10=ddd<SOH>`，不逐 byte
+/// 掃描 body。交出的 string_view 指向緩衝區內部，不經過 std::string。
+///
+/// 緩衝區為線性配置：只有在尾端空間不足時，才把尚未處理完的 (不完整)
+/// 訊息搬回開頭；已全部處理完時只重設位置，不搬移。
+///
+/// @note next() 交出的 view 在下一次 prepare() / fill() 前有效
+/// @note 任何錯誤都表示 stream 已損毀 (無法重新同步)，呼叫端應斷線並
+///       reset()
+/// @note Thread Safety: 非執行緒安全
+///
+class Framer {
+ public:
+  static constexpr size_t kDefaultCapacity = 64 * 1024;
+  /// @brief 尾端可寫空間低於此值時才搬移 (避免每次只 recv 幾個 byte)
+  static constexpr size_t kMinReadSize = 4096;
+  /// @brief `10=ddd<SOH>`
+  static constexpr size_t kTrailerSize = 7;
+
+ private:
+  std::vector<char> buffer_;
+  size_t read_{0};   ///< 第一個尚未交出的 byte
+  size_t write_{0};  ///< 已收到資料的結尾
+  bool verify_checksum_;
+
+ public:
+  /// @param capacity 接收緩衝區大小 (需大於最大訊息)
+  /// @param verify_checksum 是否驗證 CheckSum (Tag 10)
+  explicit Framer(size_t capacity = kDefaultCapacity,
+                  bool verify_checksum = true) noexcept
+      : buffer_(capacity), verify_checksum_(verify_checksum) {}
+
+  // ----------------------------------------------------------------------------
+  // 接收
+  // ----------------------------------------------------------------------------
+
+  /// @brief 取得可寫入的區域 (必要時先搬移未完成的訊息)
+  /// @return 緩衝區已滿時為空
+  [[nodiscard]] std::span<std::byte> prepare() noexcept;
+
+  /// @brief 標記 prepare() 區域中已寫入 n bytes
+  void commit(size_t n) noexcept { write_ += n; }
+
+  /// @brief 從 reader (e.g. io::TcpSocket) 讀取一次
+  /// @return 讀到的 bytes (0 = 對方關閉)；EAGAIN 等錯誤原樣傳回
+  template <typename Reader>
+  Result<size_t> fill(Reader& reader) noexcept {
+    auto space = prepare();
+    if (space.empty()) [[unlikely]] {
+      return tx::fail(FixErrc::BodyLengthExceeded, "FIX framer buffer full");
+    }
+    auto n = TRY(reader.recv(space));
+    commit(n);
+    return n;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 切割
+  // ----------------------------------------------------------------------------
+
+  /// @brief 下一則完整訊息
+  /// @return 訊息 (含標頭與 trailer)；資料不足時為 nullopt
+  [[nodiscard]] Result<std::optional<std::string_view>> next() noexcept;
+
+  /// @brief 交出所有完整訊息
+  /// @param sink `sink(std::string_view message)`
+  /// @return 交出的訊息數或錯誤
+  template <typename Sink>
+  Result<size_t> drain(Sink&& sink) noexcept {
+    size_t count = 0;
+    while (true) {
+      auto msg = TRY(next());
+      if (!msg) return count;
+      sink(*msg);
+      ++count;
+    }
+  }
+
+  // ----------------------------------------------------------------------------
+  // 查詢
+  // ----------------------------------------------------------------------------
+
+  /// @brief 尚未交出的 bytes (不完整的訊息)
+  [[nodiscard]] size_t buffered() const noexcept { return write_ - read_; }
+  [[nodiscard]] size_t capacity() const noexcept { return buffer_.size(); }
+
+  /// @brief 捨棄所有資料 (重新連線時使用)
+  void reset() noexcept {
+    read_ = 0;
+    write_ = 0;
+  }
+};
+
+}  // namespace tx::net::fix
+
+#endif
@@ -7,20 +7,10 @@
 #include <vector>
 
 #include "tx/error.hpp"
+#include "tx/net/fix/constains.hpp"
 
 namespace tx::net::fix {
 
-namespace constraints {
-
-inline constexpr size_t kDefaultFieldCapacity = 32;
-inline constexpr size_t kMaxBodyLength = 99999;
-inline constexpr int kChecksumModulo = 256;
-inline constexpr size_t kBodyLengthMaxDigits = 5;  // "99999" = 5
-inline constexpr size_t kBodyLengthFieldReserve =
-    2 + kBodyLengthMaxDigits + 1;  // "9=" + 5 digits + SOH = 8
-
-}  // namespace constraints
-
 /// @brief FIX 訊息構造器
 class MessageBuilder {
  private:
@@ -69,7 +59,8 @@ class MessageBuilder {
     return *this;
   }
   /// @brief 設定發送時間（Tag 52）
-  /// @param time UTC 時間字串，格式：YYYYMMDD-HH:MM:SS
+  /// @param time UTC 時間字串，格式：YYYYMMDD-HH:MM:SS[.sss]
+  ///             (以 TimestampCache::format() 產生，不需每次格式化)
   MessageBuilder& set_sending_time(std::string_view time) {
     sending_time_ = time;
     return *this;
@@ -0,0 +1,188 @@
+#ifndef TX_TRADING_ENGINE_NET_FIX_PREPARED_MESSAGE_HPP
+#define TX_TRADING_ENGINE_NET_FIX_PREPARED_MESSAGE_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#include "tx/error.hpp"
+#include "tx/net/fix/constains.hpp"
+#include "tx/net/fix/error.hpp"
+#include "tx/net/fix/timestamp.hpp"
+
+namespace tx::net::fix {
+
+/// @brief Session 層的標頭欄位
+struct SessionHeader {
+  std::string_view begin_string = "FIX.4.4";  ///< Tag 8
+  std::string_view sender;                    ///< Tag 49
+  std::string_view target;                    ///< Tag 56
+  /// @brief SendingTime 的精度 (決定時間欄位的保留寬度)
+  TimePrecision precision = TimePrecision::Millis;
+};
+
+/// @brief 預先序列化的 FIX 訊息樣板
+///
+/// 建立時即寫好所有欄位、BodyLength 與 trailer 位置；送出前只需 stamp()
+/// 填入 MsgSeqNum 與時間 (固定寬度，不改變長度)，並以預先算好的 byte
+/// 總和加上變動部分得到 CheckSum：
+///
+///     PreparedMessage cancel(header, "F");
+///     cancel.add(tags::OrigClOrdID, orig).add(tags::ClOrdID, id)
+///           .add(tags::Symbol, "TXFA6").add(tags::Side, '1')
+///           .add_time(tags::TransactTime).add(tags::OrderQty, int64_t{2});
+///     CHECK(cancel.finish());
+///     ...
+///     socket.send(TRY(cancel.stamp(seq, time_cache.format(now_ns))));
+///
+/// MsgSeqNum 以固定 9 位 (補零) 寫入，FIX 的 int 型別允許前導零。
+///
+/// @note 物件可直接複製 (固定大小，無動態配置)
+///
+class PreparedMessage {
+ public:
+  static constexpr size_t kCapacity = 256;
+  static constexpr size_t kSeqDigits = 9;
+  /// @brief 除 SendingTime 外可再填入時間的欄位數 (e.g. TransactTime)
+  static constexpr size_t kMaxTimeFields = 2;
+
+ private:
+  /// @brief 為 `8=<BeginString><SOH>9=<len><SOH>` 保留的空間 (finish()
+  ///        時靠右寫入 body 前方)
+  static constexpr size_t kPrefixReserve = 32;
+  static constexpr size_t kTrailerSize = 7;  // 10=ddd<SOH>
+
+  std::array<char, kCapacity> data_{};
+  uint16_t begin_{kPrefixReserve};  ///< 訊息開頭 (finish() 後)
+  uint16_t end_{kPrefixReserve};    ///< 目前寫入位置 / 訊息結尾
+  uint16_t seq_offset_{0};
+  std::array<uint16_t, kMaxTimeFields + 1> time_offsets_{};
+  uint8_t time_count_{0};
+  uint8_t time_length_{0};
+  bool overflow_{false};
+  bool finished_{false};
+  uint32_t base_sum_{0};  ///< 固定部分 (不含 seq、時間) 的 byte 總和
+
+ public:
+  PreparedMessage() noexcept = default;
+
+  /// @brief 寫入標頭 (35, 49, 56, 34, 52)
+  PreparedMessage(const SessionHeader& header,
+                  std::string_view msg_type) noexcept;
+
+  // ----------------------------------------------------------------------------
+  // 建構
+  // ----------------------------------------------------------------------------
+
+  PreparedMessage& add(int tag, std::string_view value) noexcept;
+  PreparedMessage& add(int tag, int64_t value) noexcept;
+  PreparedMessage& add(int tag, char value) noexcept {
+    return add(tag, std::string_view(&value, 1));
+  }
+
+  /// @brief 保留一個由 stamp() 填入時間的欄位 (e.g. TransactTime)
+  PreparedMessage& add_time(int tag) noexcept;
+
+  /// @brief 寫入 BeginString / BodyLength / trailer，計算固定部分的總和
+  /// @return 超過 kCapacity 時為 BodyLengthExceeded
+  Result<> finish() noexcept;
+
+  // ----------------------------------------------------------------------------
+  // 送出
+  // ----------------------------------------------------------------------------
+
+  /// @brief 填入序號與時間並更新 CheckSum
+  /// @param seq MsgSeqNum (< 10^9)
+  /// @param time TimestampCache::format() 的結果
+  /// @return 完整訊息 (指向內部緩衝區，下一次 stamp() 前有效)；time 的
+  ///         長度與建立時的精度不符時為 InvalidFieldValue (不寫入)
+  /// @pre finish() 成功
+  Result<std::string_view> stamp(uint64_t seq,
+                                 std::string_view time) noexcept {
+    // 時間欄位寬度固定：精度不符會寫出欄位範圍外
+    if (time.size() != time_length_) [[unlikely]] {
+      return tx::fail(FixErrc::InvalidFieldValue,
+                      "SendingTime precision does not match template");
+    }
+    char* base = data_.data();
+
+    // 序號：三組三位數查表 (不逐位除法)
+    const auto group = [&](size_t index, uint64_t value) noexcept {
+      std::memcpy(base + seq_offset_ + index * 3,
+                  detail::kDigits3[value].data(), 3);
+      return kDigitSum3[value];
+    };
+    uint32_t sum = base_sum_;
+    sum += group(0, seq / 1'000'000 % 1'000);
+    sum += group(1, seq / 1'000 % 1'000);
+    sum += group(2, seq % 1'000);
+
+    // 時間：長度只有兩種，固定長度的 memcpy 會被展開
+    if (time.size() == kMillisLength) {
+      sum += write_time<kMillisLength>(time.data());
+    } else {
+      sum += write_time<kMicrosLength>(time.data());
+    }
+
+    char* checksum = base + end_ - kTrailerSize + 3;
+    std::memcpy(checksum,
+                detail::kDigits3[sum % constraints::kChecksumModulo].data(),
+                3);
+    return view();
+  }
+
+  /// @brief 目前的訊息內容
+  [[nodiscard]] std::string_view view() const noexcept {
+    return {data_.data() + begin_, static_cast<size_t>(end_ - begin_)};
+  }
+
+  [[nodiscard]] bool is_finished() const noexcept { return finished_; }
+
+ private:
+  static constexpr size_t kMillisLength = TimestampCache::kSecondsLength + 4;
+  static constexpr size_t kMicrosLength = TimestampCache::kMaxLength;
+
+  /// @brief 0 ~ 999 補零三位數的字元總和
+  static constexpr auto kDigitSum3 = [] {
+    std::array<uint16_t, 1000> table{};
+    for (size_t i = 0; i < table.size(); ++i) {
+      for (char c : detail::kDigits3[i]) {
+        table[i] = static_cast<uint16_t>(table[i] + c);
+      }
+    }
+    return table;
+  }();
+
+  [[nodiscard]] static uint32_t byte_sum(const char* data,
+                                         size_t size) noexcept {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < size; ++i) {
+      sum += static_cast<unsigned char>(data[i]);
+    }
+    return sum;
+  }
+
+  /// @brief 將時間寫入所有時間欄位
+  /// @return 寫入的 byte 總和
+  template <size_t Length>
+  uint32_t write_time(const char* time) noexcept {
+    uint32_t sum = 0;
+    for (size_t i = 0; i < Length; ++i) {
+      sum += static_cast<unsigned char>(time[i]);
+    }
+    for (size_t i = 0; i < time_count_; ++i) {
+      std::memcpy(data_.data() + time_offsets_[i], time, Length);
+    }
+    return sum * time_count_;
+  }
+
+  void append(std::string_view text) noexcept;
+  void append_tag(int tag) noexcept;
+};
+
+}  // namespace tx::net::fix
+
+#endif
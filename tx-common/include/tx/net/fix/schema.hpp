@@ -0,0 +1,372 @@
+#ifndef TX_TRADING_ENGINE_NET_FIX_SCHEMA_HPP
+#define TX_TRADING_ENGINE_NET_FIX_SCHEMA_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "tx/core/type.hpp"
+#include "tx/error.hpp"
+#include "tx/net/fix/constains.hpp"
+#include "tx/net/fix/error.hpp"
+
+/// @file
+/// @brief 編譯期 FIX 訊息 schema
+///
+/// 以模板宣告 tag 與 struct 成員的對應：
+///
+///     struct ExecutionReport {
+///       std::string_view cl_ord_id;
+///       core::Side side{};
+///       core::Price price = core::Price::invalid();
+///       std::optional<core::Quantity> last_qty;
+///     };
+///
+///     using ExecutionReportSchema = schema::Message<
+///         ExecutionReport,
+///         schema::Required<tags::ClOrdID, &ExecutionReport::cl_ord_id>,
+///         schema::Required<tags::Side, &ExecutionReport::side>,
+///         schema::Optional<tags::Price, &ExecutionReport::price>,
+///         schema::Optional<tags::LastQty, &ExecutionReport::last_qty>>;
+///
+///     auto report = ExecutionReportSchema::decode(message);
+///
+/// decode() 只掃描訊息一次：每個 `tag=value<SOH>` 以編譯期產生的 perfect
+/// hash 找到對應欄位 (一次乘法 + 一次比較)，再依成員型別就地轉換
+/// (core::Price / Quantity / Side、整數、char、bool、string_view)。
+/// 不在 schema 中的 tag (e.g. 標頭 8/9/35/49、trailer 10) 直接略過。
+///
+/// 成員型別為 std::optional<T> 時，只有出現該 tag 才會設定。
+///
+/// @note string_view 成員指向原始訊息 (零複製)，生命週期與訊息相同
+/// @note 不支援 repeating group；同一 tag 重複出現時以最後一次為準
+
+namespace tx::net::fix::schema {
+
+// ----------------------------------------------------------------------------
+// 值轉換
+// ----------------------------------------------------------------------------
+
+/// @brief core::Price 的小數位數 (1 tick = 0.01 point -> 2)
+inline constexpr int kPriceDecimals = [] {
+  int decimals = 0;
+  for (int64_t t = core::Price::from_points(1.0).to_ticks(); t > 1; t /= 10) {
+    ++decimals;
+  }
+  return decimals;
+}();
+
+/// @brief 整數 (整個值都必須是數字)
+template <std::integral T>
+  requires(!std::same_as<T, bool> && !std::same_as<T, char>)
+[[nodiscard]] inline bool parse_value(std::string_view s, T& out) noexcept {
+  const auto [ptr, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+  return ec == std::errc{} && ptr == s.data() + s.size();
+}
+
+/// @brief 單一字元 (e.g. ExecType, OrdStatus)
+[[nodiscard]] inline bool parse_value(std::string_view s, char& out) noexcept {
+  if (s.size() != 1) return false;
+  out = s[0];
+  return true;
+}
+
+/// @brief Boolean: 'Y' / 'N'
+[[nodiscard]] inline bool parse_value(std::string_view s, bool& out) noexcept {
+  if (s == "Y") {
+    out = true;
+  } else if (s == "N") {
+    out = false;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/// @brief 字串欄位 (指向原始訊息)
+[[nodiscard]] inline bool parse_value(std::string_view s,
+                                      std::string_view& out) noexcept {
+  out = s;
+  return true;
+}
+
+/// @brief Price: `[-]digits[.digits]`
+///
+/// 小數位數超過 kPriceDecimals 時，多出的位數必須為 0 (否則無法以
+/// ticks 精確表示)。
+[[nodiscard]] inline bool parse_value(std::string_view s,
+                                      core::Price& out) noexcept {
+  size_t i = 0;
+  const bool negative = !s.empty() && s[0] == '-';
+  if (negative) ++i;
+
+  constexpr size_t kMaxIntegerDigits = 15;
+  int64_t ticks = 0;
+  size_t digits = 0;
+  for (; i < s.size() && s[i] != '.'; ++i, ++digits) {
+    if (s[i] < '0' || s[i] > '9' || digits == kMaxIntegerDigits) return false;
+    ticks = ticks * 10 + (s[i] - '0');
+  }
+  if (digits == 0) return false;
+
+  int decimals = 0;
+  if (i < s.size()) {
+    ++i;  // '.'
+    for (; i < s.size(); ++i) {
+      if (s[i] < '0' || s[i] > '9') return false;
+      if (decimals < kPriceDecimals) {
+        ticks = ticks * 10 + (s[i] - '0');
+        ++decimals;
+      } else if (s[i] != '0') {
+        return false;
+      }
+    }
+  }
+  for (; decimals < kPriceDecimals; ++decimals) ticks *= 10;
+
+  out = core::Price::from_ticks(negative ? -ticks : ticks);
+  return true;
+}
+
+/// @brief Qty: 非負整數 (期貨口數)
+[[nodiscard]] inline bool parse_value(std::string_view s,
+                                      core::Quantity& out) noexcept {
+  int64_t value = 0;
+  if (!parse_value(s, value) || value < 0) return false;
+  out = core::Quantity::from_value(value);
+  return true;
+}
+
+/// @brief Side (Tag 54): '1' = Buy, '2' = Sell
+[[nodiscard]] inline bool parse_value(std::string_view s,
+                                      core::Side& out) noexcept {
+  if (s == "1") {
+    out = core::Side::Buy;
+  } else if (s == "2") {
+    out = core::Side::Sell;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/// @brief 選填欄位：出現時才建立值
+template <typename T>
+[[nodiscard]] inline bool parse_value(std::string_view s,
+                                      std::optional<T>& out) noexcept {
+  if (!out) {
+    if constexpr (std::is_default_constructible_v<T>) {
+      out.emplace();
+    } else {
+      out.emplace(T::zero());  // core::Price / core::Quantity
+    }
+  }
+  return parse_value(s, *out);
+}
+
+// ----------------------------------------------------------------------------
+// 欄位宣告
+// ----------------------------------------------------------------------------
+
+/// @brief tag 與 struct 成員的對應
+/// @tparam Tag FIX tag
+/// @tparam Member 成員指標 (e.g. `&ExecutionReport::price`)
+/// @tparam IsRequired 缺少時 decode() 失敗
+template <int Tag, auto Member, bool IsRequired>
+struct Field {
+  static_assert(Tag > 0, "FIX tags are positive");
+
+  static constexpr int kTag = Tag;
+  static constexpr bool kRequired = IsRequired;
+
+  template <typename Struct>
+  [[nodiscard]] static bool assign(Struct& out,
+                                   std::string_view value) noexcept {
+    return parse_value(value, out.*Member);
+  }
+};
+
+template <int Tag, auto Member>
+using Required = Field<Tag, Member, true>;
+
+template <int Tag, auto Member>
+using Optional = Field<Tag, Member, false>;
+
+// ----------------------------------------------------------------------------
+// Perfect Hash
+// ----------------------------------------------------------------------------
+
+/// @brief 編譯期產生的 tag -> 欄位索引表
+///
+/// `slot = (tag * multiplier) >> (32 - kBits)`；建表時搜尋使所有 tag
+/// 落在不同 slot 的 multiplier，查詢時只需一次乘法與一次比較。
+template <size_t N>
+struct PerfectHash {
+  /// @brief 表格大小 (負載 <= 25%，multiplier 很快就能找到)
+  static constexpr size_t kSize = std::bit_ceil(N == 0 ? size_t{1} : N) * 4;
+  static constexpr unsigned kBits =
+      static_cast<unsigned>(std::countr_zero(kSize));
+
+  uint32_t multiplier{0};              ///< 0 = 建表失敗
+  std::array<int, kSize> tags{};       ///< 各 slot 的 tag (0 = 空)
+  std::array<uint8_t, kSize> index{};  ///< 各 slot 的欄位索引
+
+  [[nodiscard]] constexpr size_t slot(int tag) const noexcept {
+    return (static_cast<uint32_t>(tag) * multiplier) >> (32 - kBits);
+  }
+
+  /// @return 欄位索引；不在 schema 中時為 nullopt
+  [[nodiscard]] constexpr std::optional<size_t> find(int tag) const noexcept {
+    const size_t s = slot(tag);
+    if (tag <= 0 || tags[s] != tag) return std::nullopt;
+    return index[s];
+  }
+};
+
+template <size_t N>
+[[nodiscard]] consteval PerfectHash<N> make_perfect_hash(
+    const std::array<int, N>& tags) {
+  PerfectHash<N> hash;
+  for (size_t i = 0; i < N; ++i) {
+    for (size_t j = i + 1; j < N; ++j) {
+      if (tags[i] == tags[j]) return hash;  // 重複 tag
+    }
+  }
+
+  // 候選 multiplier 以 LCG 產生 (相鄰的奇數只改變低位，對高位的 slot
+  // 幾乎沒有影響)
+  constexpr uint32_t kMaxAttempts = 1 << 12;
+  uint32_t candidate = 0x9E3779B1;  // 2^32 / golden ratio
+  for (uint32_t attempt = 0; attempt < kMaxAttempts; ++attempt) {
+    hash.multiplier = candidate;
+    candidate = (candidate * 1664525U + 1013904223U) | 1U;
+    hash.tags = {};
+    bool ok = true;
+    for (size_t i = 0; i < N && ok; ++i) {
+      const size_t s = hash.slot(tags[i]);
+      if (hash.tags[s] != 0) {
+        ok = false;
+      } else {
+        hash.tags[s] = tags[i];
+        hash.index[s] = static_cast<uint8_t>(i);
+      }
+    }
+    if (ok) return hash;
+  }
+  hash.multiplier = 0;
+  return hash;
+}
+
+// ----------------------------------------------------------------------------
+// Message
+// ----------------------------------------------------------------------------
+
+/// @brief 訊息 schema：以 Fields 解碼至 Struct
+/// @tparam Struct 平坦的結果 struct (需可預設建構)
+/// @tparam Fields Required<...> / Optional<...>
+template <typename Struct, typename... Fields>
+class Message {
+ public:
+  static constexpr size_t kFieldCount = sizeof...(Fields);
+  static_assert(kFieldCount <= 64, "required mask is 64-bit");
+
+  static constexpr std::array<int, kFieldCount> kTags{Fields::kTag...};
+
+ private:
+  static constexpr PerfectHash<kFieldCount> kHash =
+      make_perfect_hash(kTags);
+  static_assert(kHash.multiplier != 0, "duplicate tag in FIX schema");
+
+  static constexpr uint64_t kRequiredMask = [] {
+    uint64_t mask = 0;
+    size_t i = 0;
+    ((mask |= Fields::kRequired ? uint64_t{1} << i : 0, ++i), ...);
+    return mask;
+  }();
+
+  /// @brief 依索引呼叫對應欄位的轉換 (GCC/Clang 會編成 jump table)
+  template <size_t... Is>
+  [[nodiscard]] static bool assign(size_t index, Struct& out,
+                                   std::string_view value,
+                                   std::index_sequence<Is...>) noexcept {
+    bool ok = false;
+    (void)((index == Is && (ok = Fields::assign(out, value), true)) || ...);
+    return ok;
+  }
+
+ public:
+  /// @brief tag 對應的欄位索引 (Fields 中的位置)
+  [[nodiscard]] static constexpr std::optional<size_t> index_of(
+      int tag) noexcept {
+    return kHash.find(tag);
+  }
+
+  /// @brief 單次掃描解碼至既有的 struct (未出現的欄位保持原值)
+  /// @param message 完整訊息 (e.g. Framer::next()) 或只有 body
+  [[nodiscard]] static Result<> decode_into(std::string_view message,
+                                           Struct& out) noexcept {
+    constexpr size_t kMaxTagDigits = 9;
+    const char* p = message.data();
+    const size_t size = message.size();
+    uint64_t seen = 0;
+
+    size_t pos = 0;
+    while (pos < size) {
+      // tag=
+      // 位數於迴圈內檢查：超長的 tag 在溢位前即停止 (停在數字上而被拒)
+      int tag = 0;
+      const size_t tag_begin = pos;
+      const size_t tag_end = std::min(size, pos + kMaxTagDigits);
+      for (; pos < tag_end && p[pos] >= '0' && p[pos] <= '9'; ++pos) {
+        tag = tag * 10 + (p[pos] - '0');
+      }
+      if (pos == tag_begin || pos == size || p[pos] != '=') [[unlikely]] {
+        return tx::fail(FixErrc::InvalidFormat, "Invalid FIX tag");
+      }
+      ++pos;
+
+      // value<SOH>
+      const size_t soh = message.find(SOH, pos);
+      if (soh == std::string_view::npos) [[unlikely]] {
+        return tx::fail(FixErrc::InvalidFormat, "FIX field missing SOH");
+      }
+      const std::string_view value(p + pos, soh - pos);
+      pos = soh + 1;
+
+      if (const auto index = kHash.find(tag)) {
+        if (!assign(*index, out, value,
+                    std::make_index_sequence<kFieldCount>{})) [[unlikely]] {
+          return tx::fail(FixErrc::InvalidFieldValue,
+                          "FIX field value does not match schema type");
+        }
+        seen |= uint64_t{1} << *index;
+      }
+    }
+
+    if ((seen & kRequiredMask) != kRequiredMask) [[unlikely]] {
+      return tx::fail(FixErrc::MissingRequiredField,
+                      "FIX message missing required field");
+    }
+    return {};
+  }
+
+  /// @brief 單次掃描解碼
+  [[nodiscard]] static Result<Struct> decode(
+      std::string_view message) noexcept {
+    Struct out{};
+    CHECK(decode_into(message, out));
+    return out;
+  }
+};
+
+}  // namespace tx::net::fix::schema
+
+#endif
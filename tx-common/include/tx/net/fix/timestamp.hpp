@@ -0,0 +1,98 @@
+#ifndef TX_TRADING_ENGINE_NET_FIX_TIMESTAMP_HPP
+#define TX_TRADING_ENGINE_NET_FIX_TIMESTAMP_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace tx::net::fix {
+
+/// @brief UTCTimestamp 的小數精度
+enum class TimePrecision : uint8_t {
+  Millis,  ///< YYYYMMDD-HH:MM:SS.sss
+  Micros   ///< YYYYMMDD-HH:MM:SS.ssssss
+};
+
+namespace detail {
+
+/// @brief 0 ~ 999 的三位數字 (補零)
+inline constexpr auto kDigits3 = [] {
+  std::array<std::array<char, 3>, 1000> table{};
+  for (size_t i = 0; i < table.size(); ++i) {
+    table[i] = {static_cast<char>('0' + i / 100),
+                static_cast<char>('0' + i / 10 % 10),
+                static_cast<char>('0' + i % 10)};
+  }
+  return table;
+}();
+
+}  // namespace detail
+
+/// @brief FIX UTCTimestamp (SendingTime / TransactTime) 字串快取
+///
+/// `YYYYMMDD-HH:MM:SS` 的部分只在秒數改變時重新產生 (不經過 strftime /
+/// fmt)，同一秒內只以查表寫入 3 (或 6) 位小數：
+///
+///     TimestampCache cache;
+///     builder.set_sending_time(cache.format(sys::TscWallClock::now_ns()));
+///
+/// @note 回傳的 view 指向內部緩衝區，下一次 format() 前有效
+/// @note Thread Safety: 非執行緒安全 (每個 session 一個)
+///
+class TimestampCache {
+ public:
+  /// @brief "YYYYMMDD-HH:MM:SS"
+  static constexpr size_t kSecondsLength = 17;
+  static constexpr size_t kMaxLength = kSecondsLength + 7;
+
+ private:
+  static constexpr uint64_t kNsPerSecond = 1'000'000'000;
+
+  std::array<char, kMaxLength> buffer_{};
+  uint64_t second_{UINT64_MAX};  ///< buffer_ 目前對應的秒 (epoch)
+  TimePrecision precision_;
+
+ public:
+  explicit TimestampCache(
+      TimePrecision precision = TimePrecision::Millis) noexcept
+      : precision_(precision) {
+    buffer_[kSecondsLength] = '.';
+  }
+
+  /// @brief 格式化 UTC 時間
+  /// @param utc_ns 自 Unix epoch 起的奈秒 (e.g. TscWallClock::now_ns())
+  [[nodiscard]] std::string_view format(uint64_t utc_ns) noexcept {
+    const uint64_t second = utc_ns / kNsPerSecond;
+    if (second != second_) [[unlikely]] {
+      refresh(second);
+    }
+
+    const uint64_t sub = utc_ns % kNsPerSecond;
+    char* frac = buffer_.data() + kSecondsLength + 1;
+    if (precision_ == TimePrecision::Millis) {
+      std::memcpy(frac, detail::kDigits3[sub / 1'000'000].data(), 3);
+    } else {
+      const uint64_t us = sub / 1'000;
+      std::memcpy(frac, detail::kDigits3[us / 1'000].data(), 3);
+      std::memcpy(frac + 3, detail::kDigits3[us % 1'000].data(), 3);
+    }
+    return {buffer_.data(), size()};
+  }
+
+  /// @brief format() 產生的字串長度
+  [[nodiscard]] size_t size() const noexcept {
+    return kSecondsLength + (precision_ == TimePrecision::Millis ? 4 : 7);
+  }
+
+  [[nodiscard]] TimePrecision precision() const noexcept { return precision_; }
+
+ private:
+  /// @brief 重新產生日期與時分秒
+  void refresh(uint64_t second) noexcept;
+};
+
+}  // namespace tx::net::fix
+
+#endif
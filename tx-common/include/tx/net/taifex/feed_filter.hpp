@@ -0,0 +1,87 @@
+#ifndef TX_TRADING_ENGINE_NET_TAIFEX_FEED_FILTER_HPP
+#define TX_TRADING_ENGINE_NET_TAIFEX_FEED_FILTER_HPP
+
+#include <linux/filter.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <vector>
+
+#include "tx/error.hpp"
+
+namespace tx::net::taifex {
+
+/// @brief TAIFEX 行情 socket 的 kernel 過濾條件 (classic BPF 產生器)
+///
+/// 產生給 io::Socket::attach_filter() 的程式，不需要的頻道或訊息種類在
+/// kernel 內即被丟棄，不會喚醒收包執行緒也不會複製到 userspace。
+/// 所有條件為 AND；未設定的條件不檢查。
+/// - esc_code 必須為 0x1B (一律檢查，擋掉非 TAIFEX 的 datagram)
+/// - channel_id 屬於指定集合
+/// - 第一個訊息的 msg_kind / msg_type 等於指定值
+///
+/// @example
+///   auto prog = TRY(FeedFilter().channels({1, 2}).msg_type('6').build());
+///   CHECK(socket.attach_filter(prog));
+///
+class FeedFilter {
+ public:
+  /// @brief UDP socket 上 payload 的起始位移 (BPF 從 UDP 標頭開始)
+  static constexpr uint32_t kUdpPayloadOffset = 8;
+  /// @brief channel 集合上限 (classic BPF 跳躍距離只有 8 bits)
+  static constexpr size_t kMaxChannels = 128;
+
+ private:
+  uint32_t base_;
+  std::vector<uint16_t> channels_;
+  std::optional<char> msg_kind_;
+  std::optional<char> msg_type_;
+
+ public:
+  /// @param payload_offset TAIFEX 封包在 BPF 視角中的起始位移
+  explicit FeedFilter(uint32_t payload_offset = kUdpPayloadOffset) noexcept
+      : base_(payload_offset) {}
+
+  // ----------------------------------------------------------------------------
+  // 條件
+  // ----------------------------------------------------------------------------
+
+  /// @brief 只接受指定頻道 (可多次呼叫，累加集合)
+  FeedFilter& channel(uint16_t channel_id) {
+    channels_.push_back(channel_id);
+    return *this;
+  }
+
+  FeedFilter& channels(std::initializer_list<uint16_t> channel_ids) {
+    for (uint16_t id : channel_ids) {
+      channels_.push_back(id);
+    }
+    return *this;
+  }
+
+  /// @brief 第一個訊息的 msg_kind (e.g. 'R')
+  FeedFilter& msg_kind(char kind) noexcept {
+    msg_kind_ = kind;
+    return *this;
+  }
+
+  /// @brief 第一個訊息的 msg_type (e.g. '6' 只收 R06 五檔)
+  FeedFilter& msg_type(char type) noexcept {
+    msg_type_ = type;
+    return *this;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 產生
+  // ----------------------------------------------------------------------------
+
+  /// @brief 產生 BPF 程式
+  /// @return 指令序列或錯誤 (channel 過多)
+  [[nodiscard]] Result<std::vector<sock_filter>> build() const;
+};
+
+}  // namespace tx::net::taifex
+
+#endif
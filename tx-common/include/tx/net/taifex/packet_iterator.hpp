@@ -0,0 +1,99 @@
+#ifndef TX_TRADING_ENGINE_NET_TAIFEX_PACKET_ITERATOR_HPP
+#define TX_TRADING_ENGINE_NET_TAIFEX_PACKET_ITERATOR_HPP
+
+#include <arpa/inet.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "tx/error.hpp"
+#include "tx/net/taifex/error.hpp"
+#include "tx/net/taifex/parser.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+
+namespace tx::net::taifex {
+
+/// @brief 封包內單一訊息的零拷貝視圖
+struct MessageView {
+  char msg_kind;                     ///< 'R'
+  char msg_type;                     ///< '6', '2', ...
+  std::span<const std::byte> bytes;  ///< 含 MessageHeader 的完整訊息
+};
+
+/// @brief 走訪一個 UDP 封包中的所有訊息
+///
+/// 只解析 PacketHeader 與每個訊息的 MessageHeader，訊息本體以 span
+/// 交給呼叫端依 msg_type 決定是否解碼，未訂閱的訊息不需付出解碼成本。
+///
+/// @example
+///   auto it = TRY(PacketIterator::from(packet));
+///   while (auto msg = it.next()) {
+///     if (msg->msg_type == '6') { ... parse_r06_snapshot(msg->bytes) ... }
+///   }
+///
+class PacketIterator {
+ private:
+  ParsedPacketHeader header_;
+  std::span<const std::byte> remaining_;  ///< 尚未走訪的訊息區
+  uint16_t left_;                         ///< 剩餘訊息數量
+
+  PacketIterator(const ParsedPacketHeader& header,
+                 std::span<const std::byte> body) noexcept
+      : header_(header), remaining_(body), left_(header.msg_count) {}
+
+ public:
+  // ----------------------------------------------------------------------------
+  // Factory Methods
+  // ----------------------------------------------------------------------------
+
+  /// @brief 解析 PacketHeader 並建立 iterator
+  /// @param packet 完整 UDP payload
+  [[nodiscard]] static Result<PacketIterator> from(
+      std::span<const std::byte> packet) noexcept {
+    auto header = TRY(parse_packet_header(packet));
+    return PacketIterator(header,
+                          packet.subspan(sizeof(PacketHeader),
+                                         header.packet_length -
+                                             sizeof(PacketHeader)));
+  }
+
+  // ----------------------------------------------------------------------------
+  // Access
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] const ParsedPacketHeader& header() const noexcept {
+    return header_;
+  }
+
+  /// @brief 剩餘未走訪的訊息數
+  [[nodiscard]] uint16_t remaining() const noexcept { return left_; }
+
+  /// @brief 取得下一個訊息
+  /// @return 訊息視圖，走訪完畢或訊息長度不合法時為 nullopt
+  [[nodiscard]] std::optional<MessageView> next() noexcept {
+    if (left_ == 0 || remaining_.size() < sizeof(MessageHeader)) {
+      return std::nullopt;
+    }
+
+    const auto* hdr = reinterpret_cast<const MessageHeader*>(remaining_.data());
+    uint16_t len = ntohs(hdr->msg_length);
+
+    if (len < sizeof(MessageHeader) || len > remaining_.size()) [[unlikely]] {
+      left_ = 0;  // 長度錯誤之後的資料不可信
+      return std::nullopt;
+    }
+
+    MessageView view{.msg_kind = hdr->msg_kind,
+                     .msg_type = hdr->msg_type,
+                     .bytes = remaining_.first(len)};
+    remaining_ = remaining_.subspan(len);
+    --left_;
+    return view;
+  }
+};
+
+}  // namespace tx::net::taifex
+
+#endif
@@ -9,6 +9,7 @@
 #include <system_error>
 
 #include "tx/error.hpp"
+#include "tx/net/taifex/wire_format.hpp"
 
 namespace tx::net::taifex {
 
@@ -23,39 +24,8 @@ struct ParsedPacketHeader {
   uint32_t send_time;      ///< 送出時間 (HHMMSSuu)
 };
 
-/// @brief 解析後的 R06 Level
-struct ParsedR06Level {
-  int32_t price;
-  uint32_t quantity;
-  uint32_t order_count;
-};
-
-/// @brief 解析後的 R06 Snapshot
-struct ParsedR06Snapshot {
-  char prod_id[20];  ///< 商品代碼
-  uint8_t prod_status;
-  uint32_t update_time;
-
-  uint8_t bid_level_cnt;
-  ParsedR06Level bid_levels[5];
-
-  uint8_t ask_level_cnt;
-  ParsedR06Level ask_levels[5];
-
-  int32_t last_price;
-  uint32_t last_qty;
-  uint32_t total_volume;
-};
-
-/// @brief 解析後的 R02 Trade
-struct ParsedR02Trade {
-  char prod_id[20];
-  int32_t match_price;
-  uint32_t match_qty;
-  uint32_t total_volume;
-  uint64_t match_time;
-  uint8_t side;
-};
+// ParsedR06Level / ParsedR06Snapshot / ParsedR02Trade 由 wire_format.hpp
+// 的 schema 產生 (欄位與 wire struct 同名，host order)
 
 /// @brief 解析 Packet Header
 [[nodiscard]] Result<ParsedPacketHeader> parse_packet_header(
@@ -0,0 +1,320 @@
+#ifndef TX_TRADING_ENGINE_NET_TAIFEX_SCHEMA_HPP
+#define TX_TRADING_ENGINE_NET_TAIFEX_SCHEMA_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <system_error>
+
+#include "tx/error.hpp"
+#include "tx/net/taifex/error.hpp"
+
+/// @file
+/// @brief TAIFEX 訊息的宣告式 schema
+///
+/// 每個訊息只需以欄位清單 (X-macro) 宣告一次：
+///
+///     #define TX_TAIFEX_R02_TRADE_FIELDS(FIELD, ARRAY)
+///       ARRAY(char, prod_id, 20)
+///       FIELD(int32_t, match_price)
+///       ...
+///     TX_TAIFEX_MESSAGE(R02Trade, 'R', '2', 45, TX_TAIFEX_R02_TRADE_FIELDS)
+///
+/// (巨集各行以 `\` 續行，實際宣告見 wire_format.hpp)
+///
+/// 即產生：
+/// - `R02TradeWire`: packed wire struct (MessageHeader + 欄位，網路序)，
+///   並以 static_assert 檢查大小
+/// - `ParsedR02Trade`: 同名欄位的 host order struct
+/// - `R02TradeView`: 零複製 view，驗證標頭後直接從封包讀取單一欄位
+/// - `R02Trade`: schema tag，提供 decode()/encode()/visit()、欄位表
+///   kFields 與 kKind/kType，供 schema::parse<M>() 與 test_vector<M>()
+///   等泛型工具使用
+///
+/// 欄位型別為 wire 型別：整數 (big-endian)、char (原樣) 或以
+/// TX_TAIFEX_RECORD 宣告的巢狀結構 (e.g. R06LevelWire)。
+
+namespace tx::net::taifex::schema {
+
+// ----------------------------------------------------------------------------
+// 欄位與型別對應
+// ----------------------------------------------------------------------------
+
+/// @brief 欄位描述 (wire struct 內的位置)
+struct FieldInfo {
+  std::string_view name;  ///< 欄位名稱
+  size_t offset;          ///< 相對 wire struct 開頭的位移
+  size_t size;            ///< 欄位總長度 (bytes)
+  size_t count;           ///< 元素數 (純量為 1)
+};
+
+/// @brief wire 型別對應的 host 型別 (巢狀結構由 TX_TAIFEX_RECORD 特化)
+template <typename Wire>
+struct Host {
+  using type = Wire;
+};
+
+template <typename Wire>
+using host_t = typename Host<Wire>::type;
+
+/// @brief 網路序 -> host order (1 byte 型別原樣傳回)
+template <std::integral T>
+[[nodiscard]] constexpr T decode_value(T value) noexcept {
+  if constexpr (sizeof(T) == 1 || std::endian::native == std::endian::big) {
+    return value;
+  } else {
+    return std::byteswap(value);
+  }
+}
+
+/// @brief host order -> 網路序
+template <std::integral T>
+[[nodiscard]] constexpr T encode_value(T value) noexcept {
+  return decode_value(value);
+}
+
+// ----------------------------------------------------------------------------
+// 泛型工具
+// ----------------------------------------------------------------------------
+
+/// @brief 以 TX_TAIFEX_MESSAGE 宣告的訊息 tag
+template <typename M>
+concept Message = requires {
+  typename M::Wire;
+  typename M::Parsed;
+  typename M::View;
+  { M::kKind } -> std::convertible_to<char>;
+  { M::kType } -> std::convertible_to<char>;
+};
+
+/// @brief 驗證訊息的長度與標頭 (View::from 使用)
+/// @return 成功時為空的 error_code
+template <Message M>
+[[nodiscard]] inline std::error_code validate(
+    std::span<const std::byte> data) noexcept {
+  using Wire = typename M::Wire;
+  if (data.size() < sizeof(Wire)) [[unlikely]] {
+    return make_error_code(parse_errc::buffer_too_small);
+  }
+  const auto* wire = reinterpret_cast<const Wire*>(data.data());
+  if (wire->header.msg_kind != M::kKind) [[unlikely]] {
+    return make_error_code(parse_errc::invalid_msg_kind);
+  }
+  if (wire->header.msg_type != M::kType) [[unlikely]] {
+    return make_error_code(parse_errc::invalid_msg_type);
+  }
+  if (decode_value(wire->header.msg_length) != sizeof(Wire)) [[unlikely]] {
+    return make_error_code(parse_errc::invalid_msg_length);
+  }
+  return {};
+}
+
+/// @brief 驗證並解碼整則訊息
+template <Message M>
+[[nodiscard]] inline Result<typename M::Parsed> parse(
+    std::span<const std::byte> data) noexcept {
+  auto view = M::View::from(data);
+  if (!view) [[unlikely]] {
+    return std::unexpected(view.error());
+  }
+  return view->decode();
+}
+
+/// @brief 產生測試向量：標頭正確、其餘每個 byte 皆不同的 wire 訊息
+///
+/// 每個多 byte 欄位的各 byte 都不相同，byte order 錯誤 (或欄位位移錯誤)
+/// 的解碼必然得到不同的值。
+template <Message M>
+[[nodiscard]] inline typename M::Wire test_vector(uint8_t seed = 1) noexcept {
+  typename M::Wire wire;
+  auto* bytes = reinterpret_cast<std::byte*>(&wire);
+  for (size_t i = 0; i < sizeof(wire); ++i) {
+    bytes[i] = static_cast<std::byte>((seed + i * 7) & 0xFF);
+  }
+  wire.header = M::kHeader;
+  return wire;
+}
+
+}  // namespace tx::net::taifex::schema
+
+// ----------------------------------------------------------------------------
+// 產生器 (X-macro)
+// ----------------------------------------------------------------------------
+
+// wire struct 欄位
+#define TX_SCHEMA_WIRE_FIELD_(type, name) type name;
+#define TX_SCHEMA_WIRE_ARRAY_(type, name, n) type name[n];
+
+// host struct 欄位
+#define TX_SCHEMA_HOST_FIELD_(type, name) \
+  ::tx::net::taifex::schema::host_t<type> name;
+#define TX_SCHEMA_HOST_ARRAY_(type, name, n) \
+  ::tx::net::taifex::schema::host_t<type> name[n];
+
+// 欄位表
+#define TX_SCHEMA_INFO_FIELD_(type, name) \
+  ::tx::net::taifex::schema::FieldInfo{   \
+      #name, offsetof(Wire, name), sizeof(Wire::name), 1},
+#define TX_SCHEMA_INFO_ARRAY_(type, name, n) \
+  ::tx::net::taifex::schema::FieldInfo{      \
+      #name, offsetof(Wire, name), sizeof(Wire::name), n},
+
+// wire -> host
+#define TX_SCHEMA_DECODE_FIELD_(type, name) \
+  out.name = ::tx::net::taifex::schema::decode_value(in.name);
+#define TX_SCHEMA_DECODE_ARRAY_(type, name, n)                       \
+  for (size_t i = 0; i < (n); ++i) {                                 \
+    out.name[i] = ::tx::net::taifex::schema::decode_value(in.name[i]); \
+  }
+
+// host -> wire
+#define TX_SCHEMA_ENCODE_FIELD_(type, name) \
+  out.name = ::tx::net::taifex::schema::encode_value(in.name);
+#define TX_SCHEMA_ENCODE_ARRAY_(type, name, n)                       \
+  for (size_t i = 0; i < (n); ++i) {                                 \
+    out.name[i] = ::tx::net::taifex::schema::encode_value(in.name[i]); \
+  }
+
+// visit
+#define TX_SCHEMA_VISIT_FIELD_(type, name) fn(kFields[index++], parsed.name);
+#define TX_SCHEMA_VISIT_ARRAY_(type, name, n) \
+  fn(kFields[index++], parsed.name);
+
+// view 存取子
+#define TX_SCHEMA_VIEW_FIELD_(type, name)                             \
+  [[nodiscard]] ::tx::net::taifex::schema::host_t<type> name()        \
+      const noexcept {                                                \
+    return ::tx::net::taifex::schema::decode_value(wire_->name);      \
+  }
+#define TX_SCHEMA_VIEW_ARRAY_(type, name, n)                          \
+  [[nodiscard]] ::tx::net::taifex::schema::host_t<type> name(         \
+      size_t i) const noexcept {                                      \
+    return ::tx::net::taifex::schema::decode_value(wire_->name[i]);   \
+  }
+
+// wire/host struct 與欄位編解碼 (Codec)
+#define TX_SCHEMA_DEFINE_(Codec, WireName, ParsedName, HEADER, FIELDS)        \
+  struct Codec;                                                               \
+                                                                              \
+  _Pragma("pack(push, 1)") struct WireName {                                  \
+    HEADER FIELDS(TX_SCHEMA_WIRE_FIELD_, TX_SCHEMA_WIRE_ARRAY_)               \
+  };                                                                          \
+  _Pragma("pack(pop)")                                                        \
+                                                                              \
+  struct ParsedName {                                                         \
+    using Schema = Codec;                                                     \
+    FIELDS(TX_SCHEMA_HOST_FIELD_, TX_SCHEMA_HOST_ARRAY_)                      \
+  };                                                                          \
+                                                                              \
+  struct Codec {                                                              \
+    using Wire = WireName;                                                    \
+    using Parsed = ParsedName;                                                \
+                                                                              \
+    static constexpr ::tx::net::taifex::schema::FieldInfo kFields[] = {       \
+        FIELDS(TX_SCHEMA_INFO_FIELD_, TX_SCHEMA_INFO_ARRAY_)};                \
+                                                                              \
+    [[nodiscard]] static constexpr Parsed decode(const Wire& in) noexcept {   \
+      Parsed out{};                                                           \
+      FIELDS(TX_SCHEMA_DECODE_FIELD_, TX_SCHEMA_DECODE_ARRAY_)                \
+      return out;                                                             \
+    }                                                                         \
+                                                                              \
+    /** @brief 依 kFields 的順序以 fn(FieldInfo, value) 走訪欄位 */          \
+    template <typename Fn>                                                    \
+    static constexpr void visit(const Parsed& parsed, Fn&& fn) noexcept {     \
+      size_t index = 0;                                                       \
+      FIELDS(TX_SCHEMA_VISIT_FIELD_, TX_SCHEMA_VISIT_ARRAY_)                  \
+    }                                                                         \
+                                                                              \
+    [[nodiscard]] static constexpr Wire encode_fields(                        \
+        const Parsed& in) noexcept {                                          \
+      Wire out{};                                                             \
+      FIELDS(TX_SCHEMA_ENCODE_FIELD_, TX_SCHEMA_ENCODE_ARRAY_)                \
+      return out;                                                             \
+    }                                                                         \
+  };
+
+/// @brief 宣告巢狀結構 (無 MessageHeader，e.g. R06 的單一價位)
+///
+/// 產生 `WireName` (packed)、`Parsed##Name` 與 tag `Name`，並讓巢狀
+/// 欄位可直接用於其他 schema。
+#define TX_TAIFEX_RECORD(Name, WireName, size, FIELDS)                    \
+  TX_SCHEMA_DEFINE_(Name, WireName, Parsed##Name, , FIELDS)               \
+  static_assert(sizeof(WireName) == (size), #WireName " size mismatch");  \
+  static_assert(alignof(WireName) == 1, #WireName " must be packed");     \
+                                                                          \
+  namespace schema {                                                      \
+  template <>                                                             \
+  struct Host<WireName> {                                                 \
+    using type = Parsed##Name;                                            \
+  };                                                                      \
+  [[nodiscard]] constexpr Parsed##Name decode_value(                      \
+      const WireName& value) noexcept {                                   \
+    return Name::decode(value);                                           \
+  }                                                                       \
+  [[nodiscard]] constexpr WireName encode_value(                          \
+      const Parsed##Name& value) noexcept {                               \
+    return Name::encode_fields(value);                                    \
+  }                                                                       \
+  }
+
+/// @brief 宣告訊息 (MessageHeader + 欄位)
+///
+/// 產生 `Name##Wire`、`Parsed##Name`、零複製 `Name##View` 與 tag
+/// `Name` (kKind/kType/kHeader、decode()/encode()/visit()/kFields)。
+/// 須在 namespace tx::net::taifex 內、MessageHeader 之後使用。
+#define TX_TAIFEX_MESSAGE(Name, kind, type, size, FIELDS)                     \
+  TX_SCHEMA_DEFINE_(Name##Codec, Name##Wire, Parsed##Name,                   \
+                    MessageHeader header;, FIELDS)                            \
+  static_assert(sizeof(Name##Wire) == (size), #Name "Wire size mismatch");    \
+  static_assert(alignof(Name##Wire) == 1, #Name "Wire must be packed");       \
+                                                                              \
+  class Name##View;                                                           \
+                                                                              \
+  struct Name : Name##Codec {                                                 \
+    using View = Name##View;                                                  \
+    static constexpr char kKind = (kind);                                     \
+    static constexpr char kType = (type);                                     \
+    static constexpr MessageHeader kHeader{                                   \
+        .msg_length = ::tx::net::taifex::schema::encode_value(                \
+            static_cast<uint16_t>(sizeof(Name##Wire))),                       \
+        .msg_kind = (kind),                                                   \
+        .msg_type = (type)};                                                  \
+                                                                              \
+    /** @brief host order -> wire (含標頭) */                                 \
+    [[nodiscard]] static constexpr Wire encode(const Parsed& in) noexcept {   \
+      Wire out = encode_fields(in);                                           \
+      out.header = kHeader;                                                   \
+      return out;                                                             \
+    }                                                                         \
+  };                                                                          \
+                                                                              \
+  /** @brief 零複製 view：from() 驗證標頭，存取子只解碼單一欄位 */            \
+  class Name##View {                                                          \
+   private:                                                                   \
+    const Name##Wire* wire_;                                                  \
+                                                                              \
+    explicit Name##View(const Name##Wire* wire) noexcept : wire_(wire) {}     \
+                                                                              \
+   public:                                                                    \
+    [[nodiscard]] static ::tx::Result<Name##View> from(                       \
+        std::span<const std::byte> data) noexcept {                           \
+      if (auto ec = ::tx::net::taifex::schema::validate<Name>(data); ec)      \
+          [[unlikely]] {                                                      \
+        return std::unexpected(ec);                                           \
+      }                                                                       \
+      return Name##View(reinterpret_cast<const Name##Wire*>(data.data()));    \
+    }                                                                         \
+                                                                              \
+    [[nodiscard]] const Name##Wire& wire() const noexcept { return *wire_; }  \
+    [[nodiscard]] Parsed##Name decode() const noexcept {                      \
+      return Name::decode(*wire_);                                            \
+    }                                                                         \
+                                                                              \
+    FIELDS(TX_SCHEMA_VIEW_FIELD_, TX_SCHEMA_VIEW_ARRAY_)                      \
+  };
+
+#endif
@@ -3,6 +3,8 @@
 
 #include <cstdint>
 
+#include "tx/net/taifex/schema.hpp"
+
 namespace tx::net::taifex {
 
 // =====================================
@@ -29,67 +31,63 @@ static_assert(alignof(PacketHeader) == 1, "PacketHeader must be packet");
 #pragma pack(push, 1)
 struct MessageHeader {
   uint16_t msg_length;  ///< 單一訊息長度
-  char msg_kind;        ///< 'R' (Real-time)
-  char msg_type;        ///< '6' (R06) 或者 '2' (R02)
+  char msg_kind;        ///< 'R' (Real-time) 或 'I' (參考資料)
+  char msg_type;        ///< '6' (R06)、'2' (R02)、'1' (I01)
 };
 #pragma pack(pop)
 
 static_assert(sizeof(MessageHeader) == 4, "MessageHeader must be 4 bytes");
 
 // =====================================
-// R06 單檔價格資訊
+// 訊息 Schema
 // =====================================
-#pragma pack(push, 1)
-struct R06Level {
-  int32_t price;         ///< 委託價格 (單位一商品tick而異)
-  uint32_t quantity;     ///< 委託口數
-  uint32_t order_count;  ///< 該價位總委託口數
-};
-#pragma pack(pop)
+//
+// 以下訊息皆由 schema.hpp 的 X-macro 產生 wire struct、host struct、
+// 零複製 view 與解碼器；新增訊息只需加上欄位清單與一行宣告。欄位型別為
+// wire 型別 (多 byte 整數皆為網路序)。
 
-static_assert(sizeof(R06Level) == 12, "R06Level must be 12 bytes");
+/// @brief R06 單檔價格資訊 (12 bytes)
+#define TX_TAIFEX_R06_LEVEL_FIELDS(FIELD, ARRAY)                 \
+  FIELD(int32_t, price)        /* 委託價格 (單位依商品 tick 而異) */ \
+  FIELD(uint32_t, quantity)    /* 委託口數 */                       \
+  FIELD(uint32_t, order_count) /* 該價位總委託筆數 */
+TX_TAIFEX_RECORD(R06Level, R06LevelWire, 12, TX_TAIFEX_R06_LEVEL_FIELDS)
 
-// =====================================
-// R06 五檔行情
-// =====================================
-#pragma pack(push, 1)
-struct R06SnapshotWire {
-  MessageHeader header;  ///< 4 bytes
-  char prod_id[20];      ///< 商品代碼（左靠右補空白）
-  uint8_t prod_status;   ///< 狀態碼（0:正常, 1:暫停, 2:收盤）
-  uint32_t update_time;  ///< 交易所更新時間 (HHMMSSuu)
-  // Bid
-  uint8_t bid_level_cnt;    ///< 買進揭示檔數（通常 5）
-  R06Level bid_entries[5];  ///< 5 檔買進資訊 (60 bytes)
-  // Ask
-  uint8_t ask_level_cnt;    ///< 賣出揭示檔數（通常 5）
-  R06Level ask_entries[5];  ///< 5 檔賣出資訊 (60 bytes)
-  // Summary
-  int32_t last_price;     ///< 最新成交價
-  uint32_t last_qty;      ///< 最新成交量
-  uint32_t total_volume;  ///< 當日累積成交總量
-};
-#pragma pack(pop)
+/// @brief R06 五檔行情 (163 bytes)
+#define TX_TAIFEX_R06_SNAPSHOT_FIELDS(FIELD, ARRAY)                       \
+  ARRAY(char, prod_id, 20)            /* 商品代碼 (左靠右補空白) */      \
+  FIELD(uint8_t, prod_status)         /* 0:正常, 1:暫停, 2:收盤 */       \
+  FIELD(uint32_t, update_time)        /* 交易所更新時間 (HHMMSSuu) */    \
+  FIELD(uint8_t, bid_level_cnt)       /* 買進揭示檔數 (通常 5) */        \
+  ARRAY(R06LevelWire, bid_levels, 5)  /* 5 檔買進 */                     \
+  FIELD(uint8_t, ask_level_cnt)       /* 賣出揭示檔數 (通常 5) */        \
+  ARRAY(R06LevelWire, ask_levels, 5)  /* 5 檔賣出 */                     \
+  FIELD(int32_t, last_price)          /* 最新成交價 */                   \
+  FIELD(uint32_t, last_qty)           /* 最新成交量 */                   \
+  FIELD(uint32_t, total_volume)       /* 當日累積成交總量 */
+TX_TAIFEX_MESSAGE(R06Snapshot, 'R', '6', 163, TX_TAIFEX_R06_SNAPSHOT_FIELDS)
 
-static_assert(sizeof(R06SnapshotWire) == 163,
-              "R06SnapshotWire must be 163 bytes");
+/// @brief R02 成交 (45 bytes)
+#define TX_TAIFEX_R02_TRADE_FIELDS(FIELD, ARRAY)                          \
+  ARRAY(char, prod_id, 20)       /* 商品代碼 */                          \
+  FIELD(int32_t, match_price)    /* 成交價格 */                          \
+  FIELD(uint32_t, match_qty)     /* 成交數量 */                          \
+  FIELD(uint32_t, total_volume)  /* 當日累積成交總量 */                  \
+  FIELD(uint64_t, match_time)    /* HHMMSSuuuuuu (微秒精度) */           \
+  FIELD(uint8_t, side)           /* 1:買方主動, 2:賣方主動, 0:不詳 */
+TX_TAIFEX_MESSAGE(R02Trade, 'R', '2', 45, TX_TAIFEX_R02_TRADE_FIELDS)
 
-// =====================================
-// R02 成交訊息
-// =====================================
-#pragma pack(push, 1)
-struct R02TradeWire {
-  MessageHeader header;   ///< 4 bytes
-  char prod_id[20];       ///< 商品代碼
-  int32_t match_price;    ///< 成交價格
-  uint32_t match_qty;     ///< 成交數量
-  uint32_t total_volume;  ///< 當日累積成交總量
-  uint64_t match_time;    ///< HHMMSSuuuuuu（微秒精度時間戳）
-  uint8_t side;           ///< 1:買方主動, 2:賣方主動, 0:不詳
-};
-#pragma pack(pop)
+/// @brief I01 商品基本資料 (41 bytes，開盤前於參考資料頻道發送)
+#define TX_TAIFEX_I01_PRODUCT_INFO_FIELDS(FIELD, ARRAY)                   \
+  ARRAY(char, prod_id, 20)          /* 商品代碼 */                       \
+  FIELD(int32_t, reference_price)   /* 參考價 */                         \
+  FIELD(int32_t, upper_limit)       /* 漲停價 */                         \
+  FIELD(int32_t, lower_limit)       /* 跌停價 */                         \
+  FIELD(uint8_t, decimal_locator)   /* 價格小數位數 */                   \
+  FIELD(uint32_t, trade_date)       /* 交易日 (YYYYMMDD) */
+TX_TAIFEX_MESSAGE(I01ProductInfo, 'I', '1', 41,
+                  TX_TAIFEX_I01_PRODUCT_INFO_FIELDS)
 
-static_assert(sizeof(R02TradeWire) == 45, "R02TradeWire must be 45 bytes");
 }  // namespace tx::net::taifex
 
 #endif
@@ -0,0 +1,69 @@
+#ifndef TX_TRADING_ENGINE_SIMD_CPU_FEATURES_HPP
+#define TX_TRADING_ENGINE_SIMD_CPU_FEATURES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace tx::simd {
+
+/// @brief SIMD kernel 的指令集層級 (由低到高，高層級包含低層級)
+///
+/// 對應 x86-64 micro-architecture level：
+/// - Sse42: x86-64-v2 (SSSE3, SSE4.1/4.2, POPCNT)
+/// - Avx2: x86-64-v3 (AVX2, BMI1/2, FMA, LZCNT, MOVBE)
+/// - Avx512: x86-64-v4 (AVX-512 F/BW/CD/DQ/VL)
+enum class Isa : uint8_t { Scalar = 0, Sse42, Avx2, Avx512 };
+
+inline constexpr size_t kIsaCount = 4;
+
+/// @brief CPUID 偵測到的功能 (AVX 系列同時要求 OS 保存對應的暫存器狀態)
+struct CpuFeatures {
+  bool ssse3{false};
+  bool sse41{false};
+  bool sse42{false};
+  bool popcnt{false};
+  bool avx{false};
+  bool avx2{false};
+  bool bmi1{false};
+  bool bmi2{false};
+  bool fma{false};
+  bool lzcnt{false};
+  bool movbe{false};
+  bool avx512f{false};
+  bool avx512bw{false};
+  bool avx512cd{false};
+  bool avx512dq{false};
+  bool avx512vl{false};
+
+  /// @brief 硬體支援的最高層級
+  [[nodiscard]] Isa max_isa() const noexcept;
+};
+
+/// @brief 以 CPUID/XGETBV 偵測 (每次呼叫都重新執行；一般使用 cpu_features())
+[[nodiscard]] CpuFeatures detect_features() noexcept;
+
+/// @brief 行程內只偵測一次的結果
+[[nodiscard]] const CpuFeatures& cpu_features() noexcept;
+
+/// @brief kernel 實際使用的層級 (行程內決定一次)
+///
+/// 為硬體支援的最高層級，但可用環境變數 `TX_SIMD_ISA`
+/// (scalar / sse42 / avx2 / avx512) 往下限制，用於比對各實作或排除
+/// 降頻的 AVX-512。要求的層級高於硬體支援時以硬體為準。
+[[nodiscard]] Isa active_isa() noexcept;
+
+/// @brief 硬體是否支援 isa
+[[nodiscard]] inline bool is_supported(Isa isa) noexcept {
+  return isa <= cpu_features().max_isa();
+}
+
+/// @brief 名稱 -> 層級 ("scalar", "sse42", "avx2", "avx512")
+[[nodiscard]] std::optional<Isa> parse_isa(std::string_view name) noexcept;
+
+[[nodiscard]] std::string_view to_string(Isa isa) noexcept;
+
+}  // namespace tx::simd
+
+#endif
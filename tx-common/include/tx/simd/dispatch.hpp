@@ -0,0 +1,99 @@
+#ifndef TX_TRADING_ENGINE_SIMD_DISPATCH_HPP
+#define TX_TRADING_ENGINE_SIMD_DISPATCH_HPP
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "tx/simd/cpu_features.hpp"
+
+// ----------------------------------------------------------------------------
+// Target Attributes
+// ----------------------------------------------------------------------------
+
+// 以 target attribute 編譯單一函式的高層級版本，整個專案仍可用較低的
+// -march (見 ENABLE_PORTABLE_BUILD)。必須只在 Dispatch 確認硬體支援後
+// 才呼叫。
+#define TX_TARGET_SSE42 __attribute__((target("ssse3,sse4.1,sse4.2,popcnt")))
+#define TX_TARGET_AVX2 \
+  __attribute__((target("avx2,bmi,bmi2,fma,lzcnt,movbe,popcnt")))
+#define TX_TARGET_AVX512                                          \
+  __attribute__((target("avx512f,avx512bw,avx512cd,avx512dq,"    \
+                        "avx512vl,avx2,bmi,bmi2,fma,lzcnt,popcnt")))
+
+namespace tx::simd {
+
+/// @brief 依 CPU 功能選擇實作的 kernel
+///
+/// 每個層級可提供一個實作 (scalar 必須提供)。物件以 constinit 建構時
+/// 先指向 scalar 版本，因此在任何靜態初始化順序下呼叫都正確；kernel
+/// 所在的編譯單元於啟動時呼叫 resolve(active_isa()) 換成最佳版本，之後
+/// 每次呼叫只是一次間接呼叫 (無分支、無 guard)。
+///
+///     constinit Dispatch<size_t(const char*, size_t)> my_kernel{{
+///         .scalar = my_kernel_scalar, .avx2 = my_kernel_avx2}};
+///
+/// @tparam Fn 函式型別，e.g. `size_t(const char*, size_t)`
+///
+/// @note Thread Safety: 呼叫為執行緒安全；resolve() 只應在啟動階段
+///       (其他執行緒呼叫 kernel 之前) 使用
+///
+template <typename Fn>
+class Dispatch {
+ public:
+  using Ptr = Fn*;
+
+  /// @brief 各層級的實作 (未提供者為 nullptr，往下層級遞補)
+  struct Variants {
+    Ptr scalar;
+    Ptr sse42 = nullptr;
+    Ptr avx2 = nullptr;
+    Ptr avx512 = nullptr;
+  };
+
+ private:
+  std::array<Ptr, kIsaCount> variants_;
+  Ptr active_;
+
+ public:
+  constexpr explicit Dispatch(const Variants& v) noexcept
+      : variants_{v.scalar, v.sse42, v.avx2, v.avx512}, active_(v.scalar) {}
+
+  /// @brief 呼叫目前選用的實作
+  template <typename... Args>
+  decltype(auto) operator()(Args&&... args) const noexcept {
+    return active_(std::forward<Args>(args)...);
+  }
+
+  /// @brief 選用不高於 max 且硬體支援的最佳實作
+  /// @return 選用的層級
+  Isa resolve(Isa max) noexcept {
+    const Isa isa = best(max);
+    active_ = variants_[static_cast<size_t>(isa)];
+    return isa;
+  }
+
+  /// @brief 不高於 max 且硬體支援的最佳實作層級
+  [[nodiscard]] Isa best(Isa max) const noexcept {
+    for (auto level = static_cast<size_t>(max); level > 0; --level) {
+      const auto isa = static_cast<Isa>(level);
+      if (variants_[level] != nullptr && is_supported(isa)) {
+        return isa;
+      }
+    }
+    return Isa::Scalar;
+  }
+
+  /// @brief 指定層級的實作 (測試與比較用)
+  /// @return 未提供或硬體不支援時為 nullptr
+  [[nodiscard]] Ptr variant(Isa isa) const noexcept {
+    return is_supported(isa) ? variants_[static_cast<size_t>(isa)] : nullptr;
+  }
+
+  /// @brief 目前選用的實作
+  [[nodiscard]] Ptr active() const noexcept { return active_; }
+};
+
+}  // namespace tx::simd
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef TX_TRADING_ENGINE_SIMD_KERNELS_HPP
+#define TX_TRADING_ENGINE_SIMD_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "tx/simd/dispatch.hpp"
+
+namespace tx::simd {
+
+// ----------------------------------------------------------------------------
+// Dispatch Objects
+// ----------------------------------------------------------------------------
+
+/// @brief 各 kernel 的 dispatch 物件 (實作於 kernels.cpp)
+///
+/// 一般透過下方的包裝函式呼叫；測試可用 `variant(isa)` 取得特定層級的
+/// 實作直接比對。
+namespace kernels {
+
+/// @brief 第一個等於 value 的位置，找不到時為 size
+extern Dispatch<size_t(const std::byte* data, size_t size, std::byte value)>
+    find_byte;
+
+/// @brief 所有 byte (視為無號數) 的總和
+extern Dispatch<uint64_t(const std::byte* data, size_t size)> byte_sum;
+
+/// @brief 逐一反轉 32-bit 整數的 byte order (in 與 out 可相同)
+extern Dispatch<void(const uint32_t* in, uint32_t* out, size_t count)>
+    byteswap32;
+
+}  // namespace kernels
+
+/// @brief 重新選擇所有 kernel 的實作 (不高於 max)
+///
+/// kernels.cpp 於啟動時以 active_isa() 呼叫一次；之後只應在其他執行緒
+/// 使用 kernel 之前呼叫 (e.g. 依組態關閉 AVX-512)。
+void resolve_all(Isa max) noexcept;
+
+// ----------------------------------------------------------------------------
+// Kernels
+// ----------------------------------------------------------------------------
+
+/// @brief 搜尋分隔字元 (e.g. FIX 的 SOH / '=')
+/// @return 位置，找不到時為 data.size()
+[[nodiscard]] inline size_t find_byte(std::span<const std::byte> data,
+                                      std::byte value) noexcept {
+  return kernels::find_byte(data.data(), data.size(), value);
+}
+
+/// @brief byte 總和 (FIX checksum 為總和 mod 256)
+[[nodiscard]] inline uint64_t byte_sum(
+    std::span<const std::byte> data) noexcept {
+  return kernels::byte_sum(data.data(), data.size());
+}
+
+/// @brief 將 32-bit 整數陣列在網路序與 host order 之間轉換
+/// @pre out.size() >= in.size()
+inline void byteswap32(std::span<const uint32_t> in,
+                       std::span<uint32_t> out) noexcept {
+  kernels::byteswap32(in.data(), out.data(), in.size());
+}
+
+}  // namespace tx::simd
+
+#endif
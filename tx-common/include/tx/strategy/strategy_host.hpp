@@ -0,0 +1,271 @@
+#ifndef TX_TRADING_ENGINE_STRATEGY_STRATEGY_HOST_HPP
+#define TX_TRADING_ENGINE_STRATEGY_STRATEGY_HOST_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
+
+#include "tx/core/type.hpp"
+#include "tx/error.hpp"
+#include "tx/feed/feed.hpp"
+#include "tx/market/instrument_registry.hpp"
+#include "tx/market/order_book.hpp"
+#include "tx/market/prefetch.hpp"
+#include "tx/net/taifex/packet_iterator.hpp"
+#include "tx/net/taifex/parser.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+#include "tx/sys/clock.hpp"
+#include "tx/sys/timer_wheel.hpp"
+
+namespace tx::strategy {
+
+/// @brief 成交回報
+struct Fill {
+  core::OrderId order_id = core::OrderId::invalid();
+  market::InstrumentId instrument{0};
+  core::Side side = core::Side::Buy;
+  core::Price price = core::Price::invalid();
+  core::Quantity qty = core::Quantity::zero();
+};
+
+/// @brief 事件驅動策略宿主 (CRTP 靜態分派)
+///
+/// 統一持有行情來源、訂閱商品的 book、timer 與下單 gateway，並負責
+/// event loop 的所有 hot path 細節 (收包、拆訊息、解碼、更新 book、推進
+/// timer)。策略只需繼承並實作需要的 callback：
+///
+///   - `void on_book(market::InstrumentId, const market::OrderBook&)`
+///   - `void on_trade(market::InstrumentId,
+///                   const net::taifex::ParsedR02Trade&)`
+///   - `void on_fill(const Fill&)`
+///   - `void on_timer(sys::TimerHandle, uint64_t user_data)`
+///   - `void prefetch_state(market::InstrumentId)`: 解碼迴圈 look-ahead
+///     時預取策略自己的商品狀態 (見 market::for_each_prefetched)
+///
+/// callback 以 `if constexpr (requires ...)` 偵測，未實作者在編譯期即被移除，
+/// 沒有 virtual call 也沒有空函式呼叫。Feed 為 feed::PacketFeed，即時與
+/// 回放使用相同程式碼路徑。
+///
+/// 所有時間 (timer 到期、now()) 皆來自 Clock policy：即時交易使用
+/// sys::TscClock，回測使用 sys::SimulatedClock，由封包時間戳推動時間，
+/// 因此回放不需等待真實時間流逝且結果可重現。
+///
+/// @tparam Derived 策略本身 (callback 需為 public)
+/// @tparam Feed 行情來源
+/// @tparam Gateway 下單 gateway handle，若提供 `poll_fills(sink)` 則
+///         event loop 會一併收取成交回報
+/// @tparam Clock 時間來源 (sys::Clock)
+/// @tparam MaxInstruments 可訂閱商品數上限
+/// @tparam MaxTimers 同時存在的 timer 上限
+///
+/// @example
+///   class MyStrategy : public StrategyHost<MyStrategy, feed::UdpFeed, Gw> {
+///    public:
+///     MyStrategy(feed::UdpFeed feed, Gw gw)
+///         : StrategyHost(std::move(feed), std::move(gw)) {}
+///     void on_book(market::InstrumentId id, const market::OrderBook& b);
+///   };
+///
+template <typename Derived, feed::PacketFeed Feed, typename Gateway,
+          sys::Clock Clock = sys::TscClock, size_t MaxInstruments = 256,
+          size_t MaxTimers = 4096>
+class StrategyHost {
+ public:
+  using Registry = market::InstrumentRegistry<MaxInstruments>;
+  using Timers = sys::TimerWheel<MaxTimers>;
+
+  /// @brief 解碼迴圈預取的 look-ahead 訊息數
+  static constexpr size_t kPrefetchDistance = market::kDefaultPrefetchDistance;
+
+ private:
+  Feed feed_;
+  Gateway gateway_;
+  Registry registry_;
+  std::array<market::OrderBook, MaxInstruments> books_{};
+  std::unique_ptr<Timers> timers_;  ///< 體積大，啟動時配置一次
+  bool stop_requested_{false};
+
+ protected:
+  StrategyHost(Feed feed, Gateway gateway)
+      : feed_(std::move(feed)),
+        gateway_(std::move(gateway)),
+        timers_(std::make_unique<Timers>(Clock::now())) {}
+
+ public:
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+  ~StrategyHost() = default;
+  StrategyHost(const StrategyHost&) = delete;
+  StrategyHost& operator=(const StrategyHost&) = delete;
+  StrategyHost(StrategyHost&&) = delete;
+  StrategyHost& operator=(StrategyHost&&) = delete;
+
+  // ----------------------------------------------------------------------------
+  // 訂閱與查詢
+  // ----------------------------------------------------------------------------
+
+  /// @brief 訂閱商品，未訂閱商品的訊息會在解碼前被略過
+  /// @return 商品索引或錯誤
+  [[nodiscard]] Result<market::InstrumentId> subscribe(
+      std::string_view prod_id) noexcept {
+    return registry_.add(prod_id);
+  }
+
+  [[nodiscard]] const Registry& instruments() const noexcept {
+    return registry_;
+  }
+
+  [[nodiscard]] const market::OrderBook& book(
+      market::InstrumentId id) const noexcept {
+    return books_[id];
+  }
+
+  [[nodiscard]] Gateway& gateway() noexcept { return gateway_; }
+  [[nodiscard]] Feed& feed() noexcept { return feed_; }
+
+  // ----------------------------------------------------------------------------
+  // Timer
+  // ----------------------------------------------------------------------------
+
+  /// @brief 目前時間 (Clock tick)
+  [[nodiscard]] static uint64_t now() noexcept { return Clock::now(); }
+
+  /// @brief 排程 timer，到期時呼叫 Derived::on_timer()
+  /// @param deadline 到期時間 (Clock tick)
+  [[nodiscard]] Result<sys::TimerHandle> schedule_timer(
+      uint64_t deadline, uint64_t user_data = 0) noexcept {
+    return timers_->schedule(deadline, user_data);
+  }
+
+  /// @brief 排程相對時間的 timer
+  /// @param delay_ns 距今的延遲 (奈秒)
+  [[nodiscard]] Result<sys::TimerHandle> schedule_after(
+      uint64_t delay_ns, uint64_t user_data = 0) noexcept {
+    return timers_->schedule(Clock::now() + Clock::from_ns(delay_ns),
+                             user_data);
+  }
+
+  bool cancel_timer(sys::TimerHandle handle) noexcept {
+    return timers_->cancel(handle);
+  }
+
+  // ----------------------------------------------------------------------------
+  // Event Loop
+  // ----------------------------------------------------------------------------
+
+  /// @brief 執行一輪 event loop: 行情 -> 成交回報 -> timer
+  ///
+  /// 每個封包處理前先依其時間戳推進 Clock 並觸發已到期的 timer，
+  /// 回放時 timer 與行情的先後順序與即時交易一致。
+  /// @return 本輪處理的事件數或錯誤
+  Result<size_t> poll_once() noexcept {
+    size_t fired = 0;
+    size_t events = TRY(
+        feed_.poll([this, &fired](std::span<const std::byte> packet,
+                                  uint64_t ts) {
+          Clock::observe(ts);
+          fired += fire_timers();
+          on_packet(packet);
+        }));
+    events += fired;
+
+    if constexpr (requires { gateway_.poll_fills([](const Fill&) {}); }) {
+      events += gateway_.poll_fills([this](const Fill& fill) {
+        if constexpr (requires { derived().on_fill(fill); }) {
+          derived().on_fill(fill);
+        }
+      });
+    }
+
+    events += fire_timers();
+    return events;
+  }
+
+  /// @brief 持續執行直到 stop() 或回放來源讀完
+  Result<> run() noexcept {
+    stop_requested_ = false;
+    while (!stop_requested_) {
+      CHECK(poll_once());
+
+      if constexpr (requires { feed_.exhausted(); }) {
+        if (feed_.exhausted()) break;
+      }
+    }
+    return {};
+  }
+
+  /// @brief 要求 run() 在本輪結束後返回 (可於 callback 中呼叫)
+  void stop() noexcept { stop_requested_ = true; }
+
+ private:
+  [[nodiscard]] Derived& derived() noexcept {
+    return static_cast<Derived&>(*this);
+  }
+
+  size_t fire_timers() noexcept {
+    return timers_->advance(
+        Clock::now(), [this](sys::TimerHandle h, uint64_t data) {
+          if constexpr (requires { derived().on_timer(h, data); }) {
+            derived().on_timer(h, data);
+          }
+        });
+  }
+
+  void on_packet(std::span<const std::byte> packet) noexcept {
+    using namespace net::taifex;
+
+    auto it = PacketIterator::from(packet);
+    if (!it) [[unlikely]] {
+      return;
+    }
+
+    market::for_each_prefetched<kPrefetchDistance>(
+        *it,
+        [this](const MessageView& msg) {
+          return market::resolve_instrument(registry_, msg);
+        },
+        [this](market::InstrumentId id) {
+          market::prefetch_for_write(books_[id]);
+          if constexpr (requires { derived().prefetch_state(id); }) {
+            derived().prefetch_state(id);
+          }
+        },
+        [this](const MessageView& msg, market::InstrumentId id) {
+          on_message(msg, id);
+        });
+  }
+
+  void on_message(const net::taifex::MessageView& msg,
+                  market::InstrumentId id) noexcept {
+    using namespace net::taifex;
+
+    if (msg.msg_type == '6') {
+      auto snap = parse_r06_snapshot(msg.bytes);
+      if (!snap) [[unlikely]] {
+        return;
+      }
+      books_[id].apply(*snap);
+      if constexpr (requires { derived().on_book(id, books_[id]); }) {
+        derived().on_book(id, books_[id]);
+      }
+    } else if (msg.msg_type == '2') {
+      auto trade = parse_r02_trade(msg.bytes);
+      if (!trade) [[unlikely]] {
+        return;
+      }
+      books_[id].apply(*trade);
+      if constexpr (requires { derived().on_trade(id, *trade); }) {
+        derived().on_trade(id, *trade);
+      }
+    }
+  }
+};
+
+}  // namespace tx::strategy
+
+#endif
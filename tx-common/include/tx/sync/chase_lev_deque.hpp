@@ -0,0 +1,141 @@
+#ifndef TX_TRADING_ENGINE_SYNC_CHASE_LEV_DEQUE_HPP
+#define TX_TRADING_ENGINE_SYNC_CHASE_LEV_DEQUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+namespace tx::sync {
+
+/// @brief Chase-Lev work-stealing deque (固定容量)
+///
+/// 擁有者在底端 push()/pop() (LIFO)，其他執行緒從頂端 steal() (FIFO)。
+/// 擁有者的操作在無競爭時只有一般 load/store 與一個 fence，只有在搶最後
+/// 一個元素時才需要 CAS。記憶體順序依 Lê et al., "Correct and Efficient
+/// Work-Stealing for Weak Memory Models" (PPoPP'13)。
+/// - 容量固定 (不擴張)，push() 滿時回傳 false 由呼叫端改走其他路徑
+/// - T 需為 trivially copyable (通常為指標)
+/// - Thread Safety: push()/pop() 只能由擁有者呼叫，steal() 可由任意執行緒
+///
+template <typename T, size_t Capacity>
+  requires std::is_trivially_copyable_v<T> && (Capacity > 0) &&
+           ((Capacity & (Capacity - 1)) == 0)
+class ChaseLevDeque {
+ private:
+  static constexpr size_t kCacheLineSize = 64;
+  static constexpr size_t kMask = Capacity - 1;
+  static constexpr auto kCapacity = static_cast<int64_t>(Capacity);
+
+  alignas(kCacheLineSize) std::atomic<int64_t> top_{0};     ///< 被偷取端
+  alignas(kCacheLineSize) std::atomic<int64_t> bottom_{0};  ///< 擁有者端
+  alignas(kCacheLineSize) std::array<std::atomic<T>, Capacity> buffer_{};
+
+ public:
+  // ----------------------------------------------------------------------------
+  // MARK: 建構函數
+  // ----------------------------------------------------------------------------
+
+  ChaseLevDeque() = default;
+
+  // ----------------------------------------------------------------------------
+  // MARK: RAII
+  // ----------------------------------------------------------------------------
+
+  ChaseLevDeque(const ChaseLevDeque&) = delete;
+  ChaseLevDeque& operator=(const ChaseLevDeque&) = delete;
+  ChaseLevDeque(ChaseLevDeque&&) = delete;
+  ChaseLevDeque& operator=(ChaseLevDeque&&) = delete;
+
+  // ----------------------------------------------------------------------------
+  // MARK: 狀態查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] static constexpr size_t capacity() noexcept { return Capacity; }
+
+  /// @brief 目前元素數 (其他執行緒同時操作時僅為近似值)
+  [[nodiscard]] size_t size() const noexcept {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  // ----------------------------------------------------------------------------
+  // MARK: 擁有者操作
+  // ----------------------------------------------------------------------------
+
+  /// @brief 放入底端
+  /// @return false 表示已滿
+  bool push(T item) noexcept {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    if (b - t >= kCapacity) [[unlikely]] {
+      return false;
+    }
+
+    buffer_[static_cast<size_t>(b) & kMask].store(item,
+                                                  std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /// @brief 從底端取出 (最近放入者)
+  [[nodiscard]] std::optional<T> pop() noexcept {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      // 已空
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    T item = buffer_[static_cast<size_t>(b) & kMask].load(
+        std::memory_order_relaxed);
+    if (t == b) {
+      // 最後一個元素，與 steal() 競爭
+      bool won = top_.compare_exchange_strong(
+          t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      if (!won) {
+        return std::nullopt;
+      }
+    }
+    return item;
+  }
+
+  // ----------------------------------------------------------------------------
+  // MARK: 偷取
+  // ----------------------------------------------------------------------------
+
+  /// @brief 從頂端偷取 (最早放入者)
+  /// @return 元素；空的或與其他執行緒競爭失敗時為 nullopt
+  [[nodiscard]] std::optional<T> steal() noexcept {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+
+    if (t >= b) {
+      return std::nullopt;
+    }
+
+    T item = buffer_[static_cast<size_t>(t) & kMask].load(
+        std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return std::nullopt;
+    }
+    return item;
+  }
+};
+
+}  // namespace tx::sync
+
+#endif
@@ -0,0 +1,244 @@
+#ifndef TX_TRADING_ENGINE_SYNC_RCU_HPP
+#define TX_TRADING_ENGINE_SYNC_RCU_HPP
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "tx/error.hpp"
+
+namespace tx::sync {
+
+/// @brief 以 QSBR (quiescent-state-based reclamation) 發布的唯讀資料
+///
+/// 盤中會變動但讀取遠多於寫入的資料 (參考資料、風控額度)：
+/// - 寫入端複製目前版本、修改後以一次 atomic store 換上新版本，舊版本
+///   掛到待回收清單
+/// - 讀取端只有一次 acquire load (x86 上即一般的 mov)，不寫入任何共享
+///   狀態、不需要 lock 也沒有 reference count
+/// - 每個讀取執行緒在 event loop 的空檔呼叫 Reader::quiescent()，宣告
+///   「此後不再持有之前取得的指標」。所有 online 的讀取端都通過某次發布
+///   之後的 quiescent point，該次被換下的版本才會被釋放
+///
+/// 讀取端一次 quiescent() 只有一次 load 與一次寫入自己 cache line 的
+/// store；長時間阻塞 (e.g. 等待 epoll) 前呼叫 offline()，避免拖住回收。
+///
+///     sync::Rcu<Table> table(initial);
+///     auto reader = table.register_reader();   // 每個讀取執行緒一個
+///     while (running) {
+///       const Table& t = reader->read();
+///       ...
+///       reader->quiescent();                   // t 之後不可再使用
+///     }
+///
+///     table.update([](Table& next) { next.limit = 10; });  // 寫入端
+///
+/// @tparam T 資料型別 (需可複製，供 update() 建立新版本)
+/// @tparam MaxReaders 讀取端數量上限
+/// @note Thread Safety: 寫入端 (publish / update / reclaim) 以 mutex 序列化，
+///       可由任意執行緒呼叫；每個 Reader 只能由單一執行緒使用
+///
+template <typename T, size_t MaxReaders = 16>
+  requires(MaxReaders > 0)
+class Rcu {
+ private:
+  static constexpr size_t kCacheLineSize = 64;
+  static constexpr uint64_t kOffline = 0;  ///< 讀取端不持有任何版本
+
+  /// @brief 讀取端最後通過的 epoch (各自一條 cache line)
+  struct alignas(kCacheLineSize) ReaderSlot {
+    std::atomic<uint64_t> epoch{kOffline};
+    std::atomic<bool> used{false};
+  };
+
+  /// @brief 待回收的舊版本：所有讀取端 epoch >= retired_at 後可釋放
+  struct Retired {
+    uint64_t retired_at;
+    std::unique_ptr<const T> data;
+  };
+
+  alignas(kCacheLineSize) std::atomic<const T*> current_;
+  alignas(kCacheLineSize) std::atomic<uint64_t> epoch_{1};
+  std::array<ReaderSlot, MaxReaders> readers_{};
+
+  std::mutex writer_mutex_;
+  std::unique_ptr<const T> owner_;  ///< 目前版本的所有權
+  std::vector<Retired> retired_;
+
+ public:
+  /// @brief 讀取端 handle (RAII，解構時登出)
+  class Reader {
+   private:
+    Rcu* rcu_{nullptr};
+    ReaderSlot* slot_{nullptr};
+
+   public:
+    Reader() = default;
+    Reader(Rcu& rcu, ReaderSlot& slot) noexcept : rcu_(&rcu), slot_(&slot) {
+      online();
+    }
+
+    ~Reader() {
+      if (slot_ != nullptr) {
+        slot_->epoch.store(kOffline, std::memory_order_release);
+        slot_->used.store(false, std::memory_order_release);
+      }
+    }
+    Reader(const Reader&) = delete;
+    Reader& operator=(const Reader&) = delete;
+    Reader(Reader&& other) noexcept
+        : rcu_(std::exchange(other.rcu_, nullptr)),
+          slot_(std::exchange(other.slot_, nullptr)) {}
+    Reader& operator=(Reader&& other) noexcept {
+      if (this != &other) {
+        std::swap(rcu_, other.rcu_);
+        std::swap(slot_, other.slot_);
+      }
+      return *this;
+    }
+
+    /// @brief 目前版本 (有效至下一次 quiescent() / offline())
+    [[nodiscard]] const T& read() const noexcept {
+      assert(slot_->epoch.load(std::memory_order_relaxed) != kOffline);
+      return *rcu_->current_.load(std::memory_order_acquire);
+    }
+
+    /// @brief 宣告不再持有之前 read() 取得的參考
+    void quiescent() noexcept {
+      // release: 之前對舊版本的讀取必須在寫入端看到新 epoch 前完成
+      slot_->epoch.store(rcu_->epoch_.load(std::memory_order_acquire),
+                         std::memory_order_release);
+    }
+
+    /// @brief 長時間阻塞前呼叫：不再 read()，寫入端可不等待此讀取端
+    void offline() noexcept {
+      slot_->epoch.store(kOffline, std::memory_order_release);
+    }
+
+    /// @brief 結束 offline，之後可再 read()
+    void online() noexcept {
+      // 與寫入端的 fence 配對：寫入端若沒看到此 store，之後的 read()
+      // 必定看到新版本
+      slot_->epoch.store(rcu_->epoch_.load(std::memory_order_acquire),
+                         std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+  };
+
+  // ----------------------------------------------------------------------------
+  // 建構函數
+  // ----------------------------------------------------------------------------
+
+  explicit Rcu(T initial)
+      : owner_(std::make_unique<const T>(std::move(initial))) {
+    current_.store(owner_.get(), std::memory_order_release);
+  }
+
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+
+  /// @pre 所有 Reader 已解構
+  ~Rcu() {
+    for ([[maybe_unused]] const auto& slot : readers_) {
+      assert(!slot.used.load(std::memory_order_relaxed));
+    }
+  }
+  Rcu(const Rcu&) = delete;
+  Rcu& operator=(const Rcu&) = delete;
+  Rcu(Rcu&&) = delete;
+  Rcu& operator=(Rcu&&) = delete;
+
+  // ----------------------------------------------------------------------------
+  // 讀取端
+  // ----------------------------------------------------------------------------
+
+  /// @brief 註冊讀取端 (啟動時於讀取執行緒呼叫；回傳時即為 online)
+  [[nodiscard]] Result<Reader> register_reader() noexcept {
+    for (auto& slot : readers_) {
+      bool expected = false;
+      if (slot.used.compare_exchange_strong(expected, true,
+                                            std::memory_order_acq_rel)) {
+        return Reader(*this, slot);
+      }
+    }
+    return tx::fail(std::errc::no_buffer_space, "Too many RCU readers");
+  }
+
+  // ----------------------------------------------------------------------------
+  // 寫入端
+  // ----------------------------------------------------------------------------
+
+  /// @brief 換上新版本，舊版本待讀取端通過 quiescent point 後釋放
+  void publish(std::unique_ptr<const T> next) {
+    assert(next != nullptr);
+    std::lock_guard lock(writer_mutex_);
+    publish_locked(std::move(next));
+  }
+
+  /// @brief 以目前版本的複本為基礎修改後發布
+  /// @param mutate `void(T&)`
+  template <typename F>
+  void update(F&& mutate) {
+    std::lock_guard lock(writer_mutex_);
+    auto next = std::make_unique<T>(*owner_);
+    std::forward<F>(mutate)(*next);
+    publish_locked(std::move(next));
+  }
+
+  /// @brief 釋放所有讀取端都已不再持有的舊版本
+  /// @return 仍待回收的版本數
+  size_t reclaim() {
+    std::lock_guard lock(writer_mutex_);
+    return reclaim_locked();
+  }
+
+  /// @brief 目前版本 (寫入端查詢用；與 publish 並行時需自行同步)
+  [[nodiscard]] const T& current() const noexcept {
+    return *current_.load(std::memory_order_acquire);
+  }
+
+  /// @brief 已發布的次數 + 1
+  [[nodiscard]] uint64_t epoch() const noexcept {
+    return epoch_.load(std::memory_order_acquire);
+  }
+
+ private:
+  void publish_locked(std::unique_ptr<const T> next) {
+    current_.store(next.get(), std::memory_order_release);
+    const uint64_t retired_at =
+        epoch_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    retired_.push_back({retired_at, std::exchange(owner_, std::move(next))});
+    reclaim_locked();
+  }
+
+  size_t reclaim_locked() {
+    if (retired_.empty()) return 0;
+
+    // 與 Reader::online() 的 fence 配對 (store 新版本 -> 掃描讀取端)
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // 所有 online 讀取端中最舊的 epoch
+    uint64_t oldest = UINT64_MAX;
+    for (const auto& slot : readers_) {
+      const uint64_t epoch = slot.epoch.load(std::memory_order_acquire);
+      if (epoch != kOffline && epoch < oldest) oldest = epoch;
+    }
+
+    std::erase_if(retired_, [oldest](const Retired& r) {
+      return r.retired_at <= oldest;
+    });
+    return retired_.size();
+  }
+};
+
+}  // namespace tx::sync
+
+#endif
@@ -0,0 +1,250 @@
+#ifndef TX_TRADING_ENGINE_SYNC_THREAD_POOL_HPP
+#define TX_TRADING_ENGINE_SYNC_THREAD_POOL_HPP
+
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/sync/chase_lev_deque.hpp"
+#include "tx/sys/cpu_affinity.hpp"
+
+namespace tx::sync {
+
+/// @brief Work-stealing thread pool (離線與非關鍵路徑工作)
+///
+/// 用於回測、啟動載入、檔案轉換、盤後報表等工作，取代 std::async
+/// (無上限地建立執行緒並與交易核心搶 CPU)。
+/// - 每個 worker 擁有一個 ChaseLevDeque：自己從底端取 (LIFO)，閒置時從
+///   其他 worker 的頂端偷 (FIFO)
+/// - 非 worker 執行緒 submit() 的工作進入共用 inject queue
+/// - 工作物件 (TaskNode) 取自內部物件池，closure 直接建構在 node 內，
+///   不經過 std::function 也不逐一 new/delete
+/// - worker 預設綁定 sys::CPUAffinity::get_housekeeping_cpus() (online
+///   且不在 /sys/devices/system/cpu/isolated)，不會落到 isolcpus 保留給
+///   交易執行緒的核心
+/// - parallel_for()/parallel_reduce() 為 fork-join，呼叫端在等待期間
+///   會協助執行工作
+///
+/// @note Thread Safety: 所有 public 方法皆可由任意執行緒呼叫；
+///       wait_idle() 不可在 worker 內呼叫 (會等到自己)
+///
+class ThreadPool {
+ public:
+  /// @brief closure 可用的內嵌儲存空間
+  static constexpr size_t kTaskStorageSize = 96;
+  /// @brief 每個 worker deque 的容量
+  static constexpr size_t kDequeCapacity = 4096;
+
+ private:
+  /// @brief 型別抹除後的工作 (固定大小，取自物件池)
+  struct alignas(64) TaskNode {
+    void (*invoke)(TaskNode*){nullptr};  ///< 執行並解構 closure
+    TaskNode* next{nullptr};             ///< free-list 連結
+    alignas(std::max_align_t) std::byte storage[kTaskStorageSize];
+  };
+
+  struct Worker;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  std::vector<size_t> cpus_;
+
+  // inject queue (外部 submit 或 deque 已滿時)
+  std::mutex inject_mutex_;
+  std::deque<TaskNode*> inject_;
+  std::atomic<size_t> inject_size_{0};
+
+  // 物件池共用區 (各 worker 另有本地 free-list)
+  std::mutex free_mutex_;
+  TaskNode* free_list_{nullptr};
+  std::vector<std::unique_ptr<TaskNode[]>> slabs_;
+
+  // 睡眠/喚醒
+  std::mutex idle_mutex_;
+  std::condition_variable idle_cv_;  ///< 喚醒閒置 worker
+  std::condition_variable done_cv_;  ///< 通知 wait_idle()
+  std::atomic<size_t> sleepers_{0};
+  bool stop_{false};  ///< 受 idle_mutex_ 保護
+
+  std::atomic<int64_t> queued_{0};  ///< 已放入、尚未被取走的工作數
+  std::atomic<size_t> pending_{0};  ///< 已提交、尚未完成的工作數
+  std::atomic<size_t> steals_{0};
+  std::atomic<size_t> pin_failures_{0};
+
+  explicit ThreadPool(std::vector<size_t> cpus) noexcept;
+
+ public:
+  // ----------------------------------------------------------------------------
+  // Factory Methods
+  // ----------------------------------------------------------------------------
+
+  /// @brief 建立 thread pool
+  /// @param cpus worker 綁定的 CPU，每顆 CPU 一個 worker；自行指定時
+  ///        不會再過濾隔離的 CPU
+  /// @return ThreadPool 或錯誤 (CPU 列表為空或不合法)
+  [[nodiscard]] static Result<std::unique_ptr<ThreadPool>> create(
+      std::vector<size_t> cpus = sys::CPUAffinity::get_housekeeping_cpus());
+
+  // ----------------------------------------------------------------------------
+  // RAII
+  // ----------------------------------------------------------------------------
+
+  /// @brief 等待所有工作完成後結束 worker
+  ~ThreadPool() noexcept;
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  ThreadPool(ThreadPool&&) = delete;
+  ThreadPool& operator=(ThreadPool&&) = delete;
+
+  // ----------------------------------------------------------------------------
+  // 提交工作
+  // ----------------------------------------------------------------------------
+
+  /// @brief 提交工作
+  ///
+  /// @param fn 無參數 callable，大小需 <= kTaskStorageSize
+  ///           (大型狀態請以參考或指標捕捉)
+  /// @note 由 worker 內部呼叫時放入自己的 deque
+  template <typename Fn>
+    requires std::invocable<std::decay_t<Fn>&>
+  void submit(Fn&& fn) noexcept {
+    using F = std::decay_t<Fn>;
+    static_assert(sizeof(F) <= kTaskStorageSize,
+                  "closure too large for ThreadPool task storage");
+    static_assert(alignof(F) <= alignof(std::max_align_t),
+                  "closure over-aligned for ThreadPool task storage");
+
+    TaskNode* node = allocate_node();
+    ::new (static_cast<void*>(node->storage)) F(std::forward<Fn>(fn));
+    node->invoke = [](TaskNode* n) {
+      F* f = std::launder(reinterpret_cast<F*>(n->storage));
+      (*f)();
+      std::destroy_at(f);
+    };
+
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    push_node(node);
+  }
+
+  /// @brief 阻塞直到所有已提交的工作完成
+  void wait_idle() noexcept;
+
+  // ----------------------------------------------------------------------------
+  // Fork-Join
+  // ----------------------------------------------------------------------------
+
+  /// @brief 平行執行 [begin, end)
+  ///
+  /// 區間以二分方式遞迴切割直到不大於 grain，子區間交由其他 worker 偷取。
+  /// 呼叫端 (worker 或外部執行緒) 在等待期間會協助執行工作。
+  ///
+  /// @param fn `fn(size_t i)` 或 `fn(size_t begin, size_t end)`
+  template <typename Fn>
+  void parallel_for(size_t begin, size_t end, size_t grain, Fn&& fn) noexcept {
+    if (begin >= end) return;
+    if (grain == 0) grain = 1;
+
+    std::atomic<size_t> outstanding{0};
+    split_range(begin, end, grain, fn, outstanding);
+    help_until_zero(outstanding);
+  }
+
+  /// @brief 平行 map-reduce
+  ///
+  /// 以 grain 切成固定區塊，各區塊以 `map(begin, end)` 計算後依區塊順序
+  /// 以 `combine(acc, part)` 合併，結果與序列執行的合併順序一致。
+  ///
+  /// @param init 初始值 (也是空區間的結果)
+  /// @param map `T map(size_t begin, size_t end)`
+  /// @param combine `T combine(T, T)`
+  template <typename T, typename MapFn, typename CombineFn>
+    requires std::convertible_to<std::invoke_result_t<MapFn&, size_t, size_t>,
+                                 T>
+  [[nodiscard]] T parallel_reduce(size_t begin, size_t end, size_t grain,
+                                  T init, MapFn&& map, CombineFn&& combine) {
+    if (begin >= end) return init;
+    if (grain == 0) grain = 1;
+
+    const size_t chunks = (end - begin + grain - 1) / grain;
+    std::vector<T> partial(chunks, init);
+
+    parallel_for(0, chunks, 1, [&](size_t c) {
+      size_t b = begin + c * grain;
+      size_t e = b + grain < end ? b + grain : end;
+      partial[c] = map(b, e);
+    });
+
+    T acc = std::move(init);
+    for (auto& p : partial) {
+      acc = combine(std::move(acc), std::move(p));
+    }
+    return acc;
+  }
+
+  // ----------------------------------------------------------------------------
+  // 狀態查詢
+  // ----------------------------------------------------------------------------
+
+  [[nodiscard]] size_t size() const noexcept { return workers_.size(); }
+  [[nodiscard]] const std::vector<size_t>& cpus() const noexcept {
+    return cpus_;
+  }
+
+  /// @brief 累計成功偷取次數
+  [[nodiscard]] size_t steal_count() const noexcept {
+    return steals_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief 綁定 CPU 失敗的 worker 數 (失敗時仍會以未綁定狀態執行)
+  [[nodiscard]] size_t pin_failures() const noexcept {
+    return pin_failures_.load(std::memory_order_relaxed);
+  }
+
+  /// @brief 目前執行緒所屬 worker 的 index，非 worker 執行緒為 -1
+  [[nodiscard]] static int current_worker() noexcept;
+
+ private:
+  template <typename Fn>
+  void split_range(size_t begin, size_t end, size_t grain, Fn& fn,
+                   std::atomic<size_t>& outstanding) noexcept {
+    while (end - begin > grain) {
+      size_t mid = begin + (end - begin) / 2;
+      outstanding.fetch_add(1, std::memory_order_relaxed);
+      submit([this, mid, end, grain, &fn, &outstanding] {
+        split_range(mid, end, grain, fn, outstanding);
+        outstanding.fetch_sub(1, std::memory_order_release);
+      });
+      end = mid;
+    }
+
+    if constexpr (std::invocable<Fn&, size_t, size_t>) {
+      fn(begin, end);
+    } else {
+      for (size_t i = begin; i < end; ++i) fn(i);
+    }
+  }
+
+  // 以下實作於 thread_pool.cpp
+  [[nodiscard]] TaskNode* allocate_node() noexcept;
+  void release_node(TaskNode* node) noexcept;
+  void push_node(TaskNode* node) noexcept;
+  [[nodiscard]] TaskNode* find_task(int self) noexcept;
+  void execute(TaskNode* node) noexcept;
+  void help_until_zero(const std::atomic<size_t>& counter) noexcept;
+  void worker_loop(size_t index) noexcept;
+};
+
+}  // namespace tx::sync
+
+#endif
@@ -0,0 +1,169 @@
+#ifndef TX_TRADING_ENGINE_SYS_CLOCK_HPP
+#define TX_TRADING_ENGINE_SYS_CLOCK_HPP
+
+#include <time.h>
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::sys {
+
+/// @brief 時間來源 policy
+///
+/// 需要「現在時間」的元件 (TimerWheel 的驅動端、StrategyHost、限流、
+/// heartbeat ...) 以模板參數接收 Clock，而非直接呼叫 TSCTimer::now()，
+/// 讓同一份邏輯可以在即時 (TscClock) 與回放 (SimulatedClock) 下執行。
+/// 全部為 static 成員，編譯後與直接呼叫等價，沒有額外成本。
+///
+/// - now(): 目前時間 (單位由 Clock 自行定義，稱為 clock tick)
+/// - from_ns()/to_ns(): clock tick 與奈秒互轉，用於設定逾時、間隔
+/// - observe(ts): 回報事件時間戳 (e.g. 封包擷取時間)，回放時鐘據此前進，
+///   即時時鐘忽略
+///
+template <typename C>
+concept Clock = requires(uint64_t t) {
+  { C::now() } noexcept -> std::same_as<uint64_t>;
+  { C::from_ns(t) } noexcept -> std::same_as<uint64_t>;
+  { C::to_ns(t) } noexcept -> std::same_as<uint64_t>;
+  { C::observe(t) } noexcept;
+};
+
+/// @brief 即時時鐘 (TSC cycle)
+///
+/// @note from_ns()/to_ns() 需先呼叫 TSCTimer::calibrate()
+class TscClock {
+ public:
+  [[nodiscard]] static uint64_t now() noexcept { return TSCTimer::now(); }
+
+  [[nodiscard]] static uint64_t from_ns(uint64_t ns) noexcept {
+    return TSCTimer::ns_to_cycles(ns);
+  }
+
+  [[nodiscard]] static uint64_t to_ns(uint64_t cycles) noexcept {
+    return static_cast<uint64_t>(TSCTimer::cycles_to_ns(cycles));
+  }
+
+  static void observe(uint64_t /*ts*/) noexcept {}
+};
+
+/// @brief 回放時鐘 (奈秒)
+///
+/// 時間只會因 set()/advance()/observe() 而前進，不讀取任何硬體計時器，
+/// 回放速度只受限於 CPU，且結果完全可重現。
+/// - 狀態為 thread_local，平行回測時每個 worker 各自擁有獨立的時間軸
+///
+class SimulatedClock {
+ private:
+  inline static thread_local uint64_t now_{0};
+
+ public:
+  [[nodiscard]] static uint64_t now() noexcept { return now_; }
+
+  [[nodiscard]] static uint64_t from_ns(uint64_t ns) noexcept { return ns; }
+  [[nodiscard]] static uint64_t to_ns(uint64_t ts) noexcept { return ts; }
+
+  /// @brief 前進到事件時間 (不會倒退)
+  static void observe(uint64_t ts) noexcept {
+    if (ts > now_) now_ = ts;
+  }
+
+  /// @brief 直接設定時間 (可倒退，用於回放重新開始)
+  static void set(uint64_t ts) noexcept { now_ = ts; }
+
+  static void advance(uint64_t delta) noexcept { now_ += delta; }
+};
+
+/// @brief 以 TSC 推算的 UTC 牆上時間 (奈秒，自 Unix epoch)
+///
+/// sync() 同時讀取 CLOCK_REALTIME 與 TSC 作為錨點，之後 now_ns() 只讀
+/// TSC 換算 (不經過 vDSO / system call)，用於 FIX SendingTime 等需要
+/// 牆上時間的熱路徑。
+///
+/// 錨點 (tsc, ns) 以 seqlock 發布：讀取端不寫入共享狀態，只在與 sync()
+/// 重疊時重讀一次，不會讀到新舊混合的一對。
+///
+/// @note 需先呼叫 TSCTimer::calibrate()，再呼叫 sync()
+/// @note 校準誤差會累積 (e.g. 10 ppm = 每秒 10 µs)，應定期 (e.g. 每次
+///       heartbeat) 重新 sync()；NTP 調整也只在 sync() 時反映
+/// @note Thread Safety: now_ns()/from_tsc() 可與 sync() 並行；同時有多個
+///       sync() 時只有一個生效，其餘直接返回
+class TscWallClock {
+ private:
+  /// @brief 奇數表示 sync() 正在寫入錨點
+  alignas(64) inline static std::atomic<uint64_t> sequence_{0};
+  inline static std::atomic<uint64_t> anchor_tsc_{0};
+  inline static std::atomic<uint64_t> anchor_ns_{0};
+
+ public:
+  /// @brief 重新建立 TSC 與 CLOCK_REALTIME 的對應
+  ///
+  /// 取多次量測中 TSC 區間最短的一次 (clock_gettime 被中斷的量測誤差大)
+  static void sync() noexcept {
+    constexpr int kAttempts = 5;
+    uint64_t best_window = UINT64_MAX;
+    uint64_t tsc = 0;
+    uint64_t ns = 0;
+    for (int i = 0; i < kAttempts; ++i) {
+      timespec ts{};
+      const uint64_t before = TSCTimer::now();
+      clock_gettime(CLOCK_REALTIME, &ts);
+      const uint64_t after = TSCTimer::now();
+      if (after - before < best_window) {
+        best_window = after - before;
+        tsc = before + (after - before) / 2;
+        ns = static_cast<uint64_t>(ts.tv_sec) * 1'000'000'000ULL +
+             static_cast<uint64_t>(ts.tv_nsec);
+      }
+    }
+
+    // 偶數 -> 奇數 取得寫入權；失敗表示另一個 sync() 正在發布
+    uint64_t seq = sequence_.load(std::memory_order_relaxed);
+    if ((seq & 1) != 0 ||
+        !sequence_.compare_exchange_strong(seq, seq + 1,
+                                           std::memory_order_relaxed)) {
+      return;
+    }
+    // 奇數序號必須先於錨點被看見
+    std::atomic_thread_fence(std::memory_order_release);
+    anchor_tsc_.store(tsc, std::memory_order_relaxed);
+    anchor_ns_.store(ns, std::memory_order_relaxed);
+    sequence_.store(seq + 2, std::memory_order_release);
+  }
+
+  /// @brief 目前 UTC 時間 (奈秒)
+  [[nodiscard]] static uint64_t now_ns() noexcept {
+    return from_tsc(TSCTimer::now());
+  }
+
+  /// @brief 將 TSC 時間戳 (e.g. 封包接收時間) 換算為 UTC 奈秒
+  [[nodiscard]] static uint64_t from_tsc(uint64_t tsc) noexcept {
+    uint64_t anchor_tsc = 0;
+    uint64_t anchor_ns = 0;
+    uint64_t before = 0;
+    do {
+      before = sequence_.load(std::memory_order_acquire);
+      anchor_tsc = anchor_tsc_.load(std::memory_order_relaxed);
+      anchor_ns = anchor_ns_.load(std::memory_order_relaxed);
+      // 錨點的讀取必須先於序號的再次確認
+      std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((before & 1) != 0 ||
+             before != sequence_.load(std::memory_order_relaxed));
+
+    if (tsc >= anchor_tsc) {
+      return anchor_ns +
+             static_cast<uint64_t>(TSCTimer::cycles_to_ns(tsc - anchor_tsc));
+    }
+    return anchor_ns -
+           static_cast<uint64_t>(TSCTimer::cycles_to_ns(anchor_tsc - tsc));
+  }
+};
+
+static_assert(Clock<TscClock>);
+static_assert(Clock<SimulatedClock>);
+
+}  // namespace tx::sys
+
+#endif
@@ -60,15 +60,37 @@ class CPUAffinity {
   ///
   static size_t get_cpu_count() noexcept;
 
-  /// @brief 取得系統可用的 CPU 列表
+  /// @brief 取得系統可用 (online) 的 CPU 列表
   /// @return CPU ID 列表
   ///
   /// @note
-  /// - 某些 CPU 可能被 isolcpus 或 cpuset 隔離，不在此列表中
+  /// - 讀取 /sys/devices/system/cpu/online，**包含** isolcpus 隔離的 CPU
+  ///   (交易執行緒應綁定在這些核心上)；背景工作請用
+  ///   `get_housekeeping_cpus()`
   /// - 若無法讀取 sysfs，會 fallback 到所有 CPU [0, cpu_count)
   ///
   static std::vector<size_t> get_available_cpus() noexcept;
 
+  /// @brief 取得被 isolcpus 隔離的 CPU 列表
+  /// @return CPU ID 列表 (未設定或無法讀取 sysfs 時為空)
+  ///
+  static std::vector<size_t> get_isolated_cpus() noexcept;
+
+  /// @brief 取得背景工作可用的 CPU 列表 (online 且未被隔離)
+  /// @return CPU ID 列表；全部 CPU 都被隔離時 fallback 到 online 列表
+  ///
+  /// @note thread pool、回測等非關鍵路徑工作應綁定在這些 CPU，避免與
+  ///       isolcpus 上的交易執行緒搶核心
+  ///
+  static std::vector<size_t> get_housekeeping_cpus() noexcept;
+
+  /// @brief 從 CPU 列表移除指定的 CPU (保持原順序)
+  /// @param cpus 原始列表
+  /// @param excluded 要移除的 CPU (e.g. `get_isolated_cpus()`)
+  ///
+  static std::vector<size_t> exclude_cpus(
+      std::vector<size_t> cpus, std::span<const size_t> excluded) noexcept;
+
   // ----------------------------------------------------------------------------
   // 驗証
   // ----------------------------------------------------------------------------
@@ -81,7 +103,7 @@ class CPUAffinity {
 
   /// @brief 檢查 CPU 是否可用
   /// @param cpu_id CPU 編號
-  /// @return true 如果 CPU 是 online 且未被隔離
+  /// @return true 如果 CPU 是 online (可能被 isolcpus 隔離)
   ///
   static bool is_cpu_available(size_t cpu_id) noexcept;
 };
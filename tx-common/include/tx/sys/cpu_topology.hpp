@@ -0,0 +1,52 @@
+#ifndef TX_TRADING_ENGINE_SYS_CPU_TOPOLOGY_HPP
+#define TX_TRADING_ENGINE_SYS_CPU_TOPOLOGY_HPP
+
+#include <cstddef>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace tx::sys {
+
+/// @brief 單一邏輯 CPU 的拓樸位置
+struct CpuInfo {
+  size_t cpu{0};   ///< 邏輯 CPU 編號
+  int package{0};  ///< 實體插槽 (physical_package_id)
+  int core{0};     ///< 插槽內的實體核心 (core_id)，SMT sibling 相同
+  int node{0};     ///< NUMA node
+};
+
+/// @brief CPU 拓樸查詢與執行緒配置
+///
+/// 收包執行緒應各自獨佔一顆實體核心 (不與 SMT sibling 共用 L1/L2)，
+/// 並與網卡位於同一 NUMA node (DMA 寫入的封包在本地記憶體)。
+///
+/// 所有方法都是 static，不需要實例化
+class CpuTopology {
+ public:
+  CpuTopology() = delete;  // static class
+
+  /// @brief 讀取可用 CPU (CPUAffinity::get_available_cpus()) 的拓樸
+  /// @return 依 CPU 編號排序；sysfs 讀不到的欄位以 cpu 編號 / 0 代替
+  [[nodiscard]] static std::vector<CpuInfo> detect() noexcept;
+
+  /// @brief 網卡所在的 NUMA node
+  /// @param interface 網卡名稱 (e.g. "eth0")
+  /// @return node 編號，未知 (虛擬網卡、單 node 系統) 為 -1
+  [[nodiscard]] static int interface_node(std::string_view interface) noexcept;
+
+  /// @brief 挑選 count 顆 CPU 給獨佔執行緒 (e.g. 收包 shard)
+  ///
+  /// 優先順序:
+  /// 1. 位於 node 上 (node < 0 表示不限)
+  /// 2. 每顆實體核心只取一個邏輯 CPU，之後才使用 SMT sibling
+  /// 3. CPU 0 排最後 (通常負責中斷與系統工作)
+  ///
+  /// @return 最多 count 顆 CPU (可用 CPU 不足時較少)
+  [[nodiscard]] static std::vector<size_t> select(
+      std::span<const CpuInfo> cpus, size_t count, int node = -1) noexcept;
+};
+
+}  // namespace tx::sys
+
+#endif
@@ -70,6 +70,14 @@ class TSCTimer {
     }
     return static_cast<double>(cycles) * ns_per_cycle_;
   }
+
+  static inline uint64_t ns_to_cycles(uint64_t ns) noexcept {
+    if (!calibrated_) [[unlikely]] {
+      std::cerr << "[TSCTimer] won't call calibrate() first\n";
+      std::terminate();
+    }
+    return static_cast<uint64_t>(static_cast<double>(ns) / ns_per_cycle_);
+  }
 };
 
 }  // namespace tx::sys
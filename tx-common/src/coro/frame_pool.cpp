@@ -0,0 +1,94 @@
+#include "tx/coro/frame_pool.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace tx::coro {
+
+namespace {
+
+constexpr size_t kMinShift = std::bit_width(FramePool::kMinClass) - 1;
+constexpr size_t kMaxShift = std::bit_width(FramePool::kMaxClass) - 1;
+constexpr size_t kClassCount = kMaxShift - kMinShift + 1;
+
+struct FreeNode {
+  FreeNode* next;
+};
+
+/// @brief 單一執行緒的池狀態
+struct PoolState {
+  std::array<FreeNode*, kClassCount> free_lists{};
+  std::vector<std::unique_ptr<std::byte[]>> slabs;
+  size_t outstanding{0};
+
+  ~PoolState() = default;
+};
+
+PoolState& state() noexcept {
+  thread_local PoolState s;
+  return s;
+}
+
+/// @brief size 所屬的級距 index
+size_t class_of(size_t size) noexcept {
+  if (size <= FramePool::kMinClass) return 0;
+  return std::bit_width(size - 1) - kMinShift;
+}
+
+void refill(PoolState& s, size_t cls) noexcept {
+  const size_t block = FramePool::kMinClass << cls;
+  auto slab = std::make_unique<std::byte[]>(FramePool::kSlabSize);
+  for (size_t off = 0; off + block <= FramePool::kSlabSize; off += block) {
+    auto* node = reinterpret_cast<FreeNode*>(slab.get() + off);
+    node->next = s.free_lists[cls];
+    s.free_lists[cls] = node;
+  }
+  s.slabs.push_back(std::move(slab));
+}
+
+}  // namespace
+
+void* FramePool::allocate(size_t size) noexcept {
+  PoolState& s = state();
+  ++s.outstanding;
+
+  if (size > kMaxClass) [[unlikely]] {
+    return ::operator new(size);
+  }
+
+  size_t cls = class_of(size);
+  if (s.free_lists[cls] == nullptr) [[unlikely]] {
+    refill(s, cls);
+  }
+
+  FreeNode* node = s.free_lists[cls];
+  s.free_lists[cls] = node->next;
+  return node;
+}
+
+void FramePool::deallocate(void* ptr, size_t size) noexcept {
+  PoolState& s = state();
+  --s.outstanding;
+
+  if (size > kMaxClass) [[unlikely]] {
+    ::operator delete(ptr, size);
+    return;
+  }
+
+  size_t cls = class_of(size);
+  auto* node = static_cast<FreeNode*>(ptr);
+  node->next = s.free_lists[cls];
+  s.free_lists[cls] = node;
+}
+
+size_t FramePool::outstanding() noexcept { return state().outstanding; }
+
+size_t FramePool::reserved_bytes() noexcept {
+  return state().slabs.size() * kSlabSize;
+}
+
+}  // namespace tx::coro
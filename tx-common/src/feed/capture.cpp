@@ -0,0 +1,78 @@
+#include "tx/feed/capture.hpp"
+
+#include <fcntl.h>
+
+#include <cstring>
+#include <utility>
+
+#include "tx/error.hpp"
+#include "tx/io/file.hpp"
+
+namespace tx::feed {
+
+// ----------------------------------------------------------------------------
+// Factory Methods
+// ----------------------------------------------------------------------------
+
+Result<CaptureWriter> CaptureWriter::create(std::string path) noexcept {
+  auto file =
+      TRY(io::File::open(std::move(path), O_WRONLY | O_CREAT | O_TRUNC));
+
+  CaptureWriter writer(std::move(file));
+
+  CaptureFileHeader header{.magic = kCaptureMagic, .version = 1, .reserved = 0};
+  const auto* p = reinterpret_cast<const std::byte*>(&header);
+  writer.buffer_.insert(writer.buffer_.end(), p, p + sizeof(header));
+
+  return writer;
+}
+
+// ----------------------------------------------------------------------------
+// RAII
+// ----------------------------------------------------------------------------
+
+CaptureWriter::CaptureWriter(io::File file) noexcept : file_(std::move(file)) {
+  buffer_.reserve(kBufferSize);
+}
+
+CaptureWriter::~CaptureWriter() noexcept {
+  if (file_.is_open()) {
+    auto _ = flush();
+  }
+}
+
+// ----------------------------------------------------------------------------
+// 操作
+// ----------------------------------------------------------------------------
+
+Result<> CaptureWriter::append(uint64_t timestamp_ns,
+                               std::span<const std::byte> packet,
+                               uint32_t channel) noexcept {
+  if (packet.size() > UINT32_MAX) {
+    return tx::fail(std::errc::message_size, "Packet too large");
+  }
+
+  CaptureRecordHeader rec{.timestamp_ns = timestamp_ns,
+                          .length = static_cast<uint32_t>(packet.size()),
+                          .channel = channel};
+  const auto* p = reinterpret_cast<const std::byte*>(&rec);
+  buffer_.insert(buffer_.end(), p, p + sizeof(rec));
+  buffer_.insert(buffer_.end(), packet.begin(), packet.end());
+
+  if (buffer_.size() >= kBufferSize) {
+    return flush();
+  }
+  return {};
+}
+
+Result<> CaptureWriter::flush() noexcept {
+  std::span<const std::byte> pending(buffer_);
+  while (!pending.empty()) {
+    size_t n = TRY(file_.write(pending));
+    pending = pending.subspan(n);
+  }
+  buffer_.clear();
+  return {};
+}
+
+}  // namespace tx::feed
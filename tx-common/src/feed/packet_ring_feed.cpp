@@ -0,0 +1,236 @@
+#include "tx/feed/packet_ring_feed.hpp"
+
+#include <arpa/inet.h>
+#include <linux/if_ether.h>
+#include <linux/if_packet.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "tx/error.hpp"
+
+namespace tx::feed {
+
+namespace {
+
+[[nodiscard]] bool is_multicast(in_addr addr) noexcept {
+  return (ntohl(addr.s_addr) & 0xF0000000U) == 0xE0000000U;
+}
+
+/// @brief 讓網卡接收 group 的 multicast MAC (01:00:5e + IP 低 23 位元)
+Result<> add_packet_membership(int fd, unsigned int ifindex,
+                               in_addr group) noexcept {
+  const uint32_t ip = ntohl(group.s_addr);
+  packet_mreq mreq{};
+  mreq.mr_ifindex = static_cast<int>(ifindex);
+  mreq.mr_type = PACKET_MR_MULTICAST;
+  mreq.mr_alen = ETH_ALEN;
+  mreq.mr_address[0] = 0x01;
+  mreq.mr_address[1] = 0x00;
+  mreq.mr_address[2] = 0x5e;
+  mreq.mr_address[3] = static_cast<unsigned char>((ip >> 16) & 0x7F);
+  mreq.mr_address[4] = static_cast<unsigned char>((ip >> 8) & 0xFF);
+  mreq.mr_address[5] = static_cast<unsigned char>(ip & 0xFF);
+  if (::setsockopt(fd, SOL_PACKET, PACKET_ADD_MEMBERSHIP, &mreq,
+                   sizeof(mreq)) < 0) {
+    return tx::fail(errno, "setsockopt(PACKET_ADD_MEMBERSHIP) failed");
+  }
+  return {};
+}
+
+/// @brief 以 UDP socket 在網卡上加入 group (送出 IGMP report)
+///
+/// socket 不綁定 group 的埠號，kernel 不會把行情複製到它的接收緩衝區。
+Result<int> join_igmp(unsigned int ifindex, in_addr group) noexcept {
+  int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return tx::fail(errno, "socket(AF_INET) failed");
+  }
+  ip_mreqn mreq{};
+  mreq.imr_multiaddr = group;
+  mreq.imr_ifindex = static_cast<int>(ifindex);
+  if (::setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) <
+      0) {
+    int err = errno;
+    ::close(fd);
+    return tx::fail(err, "setsockopt(IP_ADD_MEMBERSHIP) failed");
+  }
+  return fd;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// Factory Methods
+// ----------------------------------------------------------------------------
+
+Result<PacketRingFeed> PacketRingFeed::create(
+    const PacketRingConfig& config) noexcept {
+  if (config.block_count == 0 || config.frame_size == 0 ||
+      config.block_size % static_cast<uint32_t>(::getpagesize()) != 0 ||
+      config.block_size % config.frame_size != 0) {
+    return tx::fail(std::errc::invalid_argument, "Invalid ring geometry");
+  }
+  const in_addr* group_ip = config.group.ipv4_addr();
+  if (group_ip == nullptr) {
+    return tx::fail(std::errc::address_family_not_supported,
+                    "PacketRingFeed supports IPv4 only");
+  }
+
+  // if_nametoindex 需要 NUL 結尾
+  const std::string ifname(config.interface);
+  const unsigned int ifindex = ::if_nametoindex(ifname.c_str());
+  if (ifindex == 0) {
+    return tx::fail(errno, "if_nametoindex() failed");
+  }
+
+  int fd = ::socket(AF_PACKET, SOCK_RAW, htons(ETH_P_IP));
+  if (fd < 0) {
+    return tx::fail(errno, "socket(AF_PACKET) failed");
+  }
+
+  int version = TPACKET_V3;
+  if (::setsockopt(fd, SOL_PACKET, PACKET_VERSION, &version,
+                   sizeof(version)) < 0) {
+    int err = errno;
+    ::close(fd);
+    return tx::fail(err, "setsockopt(PACKET_VERSION) failed");
+  }
+
+  // loopback 上每個封包會以送出與收到各出現一次，只保留收到的
+  int ignore_outgoing = 1;
+  (void)::setsockopt(fd, SOL_PACKET, PACKET_IGNORE_OUTGOING, &ignore_outgoing,
+                     sizeof(ignore_outgoing));
+
+  tpacket_req3 req{};
+  req.tp_block_size = config.block_size;
+  req.tp_block_nr = config.block_count;
+  req.tp_frame_size = config.frame_size;
+  req.tp_frame_nr =
+      (config.block_size / config.frame_size) * config.block_count;
+  req.tp_retire_blk_tov = config.block_timeout_ms;
+  req.tp_sizeof_priv = 0;
+  req.tp_feature_req_word = 0;
+  if (::setsockopt(fd, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0) {
+    int err = errno;
+    ::close(fd);
+    return tx::fail(err, "setsockopt(PACKET_RX_RING) failed");
+  }
+
+  const size_t ring_size = size_t{config.block_size} * config.block_count;
+  void* ring = ::mmap(nullptr, ring_size, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, fd, 0);
+  if (ring == MAP_FAILED) {
+    int err = errno;
+    ::close(fd);
+    return tx::fail(err, "mmap(PACKET_RX_RING) failed");
+  }
+
+  sockaddr_ll ll{};
+  ll.sll_family = AF_PACKET;
+  ll.sll_protocol = htons(ETH_P_IP);
+  ll.sll_ifindex = static_cast<int>(ifindex);
+  if (::bind(fd, reinterpret_cast<const sockaddr*>(&ll), sizeof(ll)) < 0) {
+    int err = errno;
+    ::munmap(ring, ring_size);
+    ::close(fd);
+    return tx::fail(err, "bind(AF_PACKET) failed");
+  }
+
+  // 由建構後的物件負責釋放，之後的失敗交給解構函數
+  PacketRingFeed feed(fd, -1, static_cast<std::byte*>(ring), config,
+                      group_ip->s_addr, htons(config.group.port()));
+  if (config.join_group && is_multicast(*group_ip)) {
+    CHECK(add_packet_membership(fd, ifindex, *group_ip));
+    feed.igmp_fd_ = TRY(join_igmp(ifindex, *group_ip));
+  }
+  return feed;
+}
+
+PacketRingFeed::PacketRingFeed(int fd, int igmp_fd, std::byte* ring,
+                               const PacketRingConfig& config, uint32_t dst_ip,
+                               uint16_t dst_port) noexcept
+    : fd_(fd),
+      igmp_fd_(igmp_fd),
+      ring_(ring),
+      ring_size_(size_t{config.block_size} * config.block_count),
+      block_size_(config.block_size),
+      block_count_(config.block_count),
+      burst_blocks_(config.burst_blocks),
+      dst_ip_(dst_ip),
+      dst_port_(dst_port) {}
+
+// ----------------------------------------------------------------------------
+// RAII
+// ----------------------------------------------------------------------------
+
+PacketRingFeed::~PacketRingFeed() noexcept { close(); }
+
+PacketRingFeed::PacketRingFeed(PacketRingFeed&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)),
+      igmp_fd_(std::exchange(other.igmp_fd_, -1)),
+      ring_(std::exchange(other.ring_, nullptr)),
+      ring_size_(std::exchange(other.ring_size_, 0)),
+      block_size_(other.block_size_),
+      block_count_(other.block_count_),
+      current_(other.current_),
+      burst_blocks_(other.burst_blocks_),
+      dst_ip_(other.dst_ip_),
+      dst_port_(other.dst_port_),
+      stats_(other.stats_) {}
+
+PacketRingFeed& PacketRingFeed::operator=(PacketRingFeed&& other) noexcept {
+  if (this != &other) {
+    close();
+    fd_ = std::exchange(other.fd_, -1);
+    igmp_fd_ = std::exchange(other.igmp_fd_, -1);
+    ring_ = std::exchange(other.ring_, nullptr);
+    ring_size_ = std::exchange(other.ring_size_, 0);
+    block_size_ = other.block_size_;
+    block_count_ = other.block_count_;
+    current_ = other.current_;
+    burst_blocks_ = other.burst_blocks_;
+    dst_ip_ = other.dst_ip_;
+    dst_port_ = other.dst_port_;
+    stats_ = other.stats_;
+  }
+  return *this;
+}
+
+void PacketRingFeed::close() noexcept {
+  if (ring_ != nullptr) {
+    ::munmap(ring_, ring_size_);
+    ring_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  // 關閉即離開 group (IGMP leave)
+  if (igmp_fd_ >= 0) {
+    ::close(igmp_fd_);
+    igmp_fd_ = -1;
+  }
+}
+
+// ----------------------------------------------------------------------------
+// 查詢
+// ----------------------------------------------------------------------------
+
+Result<uint64_t> PacketRingFeed::kernel_drops() noexcept {
+  tpacket_stats_v3 st{};
+  socklen_t len = sizeof(st);
+  if (::getsockopt(fd_, SOL_PACKET, PACKET_STATISTICS, &st, &len) < 0) {
+    return tx::fail(errno, "getsockopt(PACKET_STATISTICS) failed");
+  }
+  return st.tp_drops;
+}
+
+}  // namespace tx::feed
@@ -0,0 +1,184 @@
+#include "tx/feed/snapshot_service.hpp"
+
+#include <poll.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::feed {
+
+// ----------------------------------------------------------------------------
+// SnapshotClient
+// ----------------------------------------------------------------------------
+
+void SnapshotClient::request(uint16_t channel) noexcept {
+  if (std::find(outstanding_.begin(), outstanding_.end(), channel) !=
+      outstanding_.end()) {
+    return;
+  }
+  outstanding_.push_back(channel);
+
+  // 連線中的要求直接排入；未連線時於連線建立後一次重送
+  if (socket_) {
+    SnapshotRequest req{.channel = channel, .reserved = 0};
+    const auto* p = reinterpret_cast<const std::byte*>(&req);
+    for (size_t i = 0; i < sizeof(req); ++i) {
+      out_.push_back(p[i]);
+    }
+  }
+}
+
+Result<> SnapshotClient::progress() noexcept {
+  if (!socket_) {
+    if (outstanding_.empty() || sys::TSCTimer::now() < retry_at_) {
+      return {};
+    }
+    CHECK(start_connect());
+  }
+
+  if (connecting_) {
+    pollfd pfd{.fd = socket_->fd(), .events = POLLOUT, .revents = 0};
+    if (::poll(&pfd, 1, 0) == 0) {
+      return {};  // 尚未完成
+    }
+    if (auto r = socket_->connect_result(); !r) {
+      disconnect();
+      return std::unexpected(r.error());
+    }
+    connecting_ = false;
+  }
+
+  // 送出
+  while (out_pos_ < out_.size()) {
+    auto n = socket_->send(std::span(out_).subspan(out_pos_));
+    if (!n) {
+      if (n.error().value() == EAGAIN) break;
+      disconnect();
+      return std::unexpected(n.error());
+    }
+    out_pos_ += *n;
+  }
+  if (out_pos_ == out_.size()) {
+    out_.clear();
+    out_pos_ = 0;
+  }
+
+  // 接收
+  while (in_size_ < in_.size()) {
+    auto n = socket_->recv(std::span(in_).subspan(in_size_));
+    if (!n) {
+      if (n.error().value() == EAGAIN) break;
+      disconnect();
+      return std::unexpected(n.error());
+    }
+    if (*n == 0) {
+      disconnect();
+      return tx::fail(std::errc::connection_reset, "Snapshot server closed");
+    }
+    in_size_ += *n;
+  }
+  return {};
+}
+
+Result<> SnapshotClient::start_connect() noexcept {
+  auto socket = io::TcpSocket::start_connect(server_);
+  if (!socket) {
+    retry_at_ = sys::TSCTimer::now() +
+                sys::TSCTimer::ns_to_cycles(retry_interval_ns_);
+    return std::unexpected(socket.error());
+  }
+  socket_.emplace(std::move(*socket));
+  connecting_ = true;
+
+  // 重送所有尚未回應的要求
+  out_.clear();
+  out_pos_ = 0;
+  for (uint16_t channel : outstanding_) {
+    SnapshotRequest req{.channel = channel, .reserved = 0};
+    const auto* p = reinterpret_cast<const std::byte*>(&req);
+    for (size_t i = 0; i < sizeof(req); ++i) {
+      out_.push_back(p[i]);
+    }
+  }
+  return {};
+}
+
+void SnapshotClient::disconnect() noexcept {
+  socket_.reset();
+  connecting_ = false;
+  in_size_ = 0;
+  out_.clear();
+  out_pos_ = 0;
+  retry_at_ =
+      sys::TSCTimer::now() + sys::TSCTimer::ns_to_cycles(retry_interval_ns_);
+}
+
+// ----------------------------------------------------------------------------
+// SnapshotServer
+// ----------------------------------------------------------------------------
+
+Result<SnapshotServer> SnapshotServer::create(
+    const io::SocketAddress& address) noexcept {
+  auto listener = TRY(io::TcpSocket::serve(address));
+  CHECK(listener.set_nonblocking(true));
+  return SnapshotServer(std::move(listener));
+}
+
+Result<> SnapshotServer::accept_pending() noexcept {
+  while (true) {
+    auto client = listener_.accept();
+    if (!client) {
+      if (client.error().value() == EAGAIN) return {};
+      return std::unexpected(client.error());
+    }
+    CHECK(client->set_nonblocking(true));
+    clients_.push_back(std::move(*client));
+    pending_.emplace_back();
+  }
+}
+
+bool SnapshotServer::read_requests(size_t index,
+                                   std::vector<uint16_t>& channels) noexcept {
+  auto& buf = pending_[index];
+  std::array<std::byte, 256> chunk;
+  while (true) {
+    auto n = clients_[index].recv(chunk);
+    if (!n) {
+      if (n.error().value() == EAGAIN) break;
+      return false;
+    }
+    if (*n == 0) return false;
+    for (size_t i = 0; i < *n; ++i) {
+      buf.push_back(chunk[i]);
+    }
+  }
+
+  size_t pos = 0;
+  while (buf.size() - pos >= sizeof(SnapshotRequest)) {
+    SnapshotRequest req;
+    std::memcpy(&req, buf.data() + pos, sizeof(req));
+    channels.push_back(req.channel);
+    pos += sizeof(req);
+  }
+  buf.erase(buf.begin(), buf.begin() + static_cast<ptrdiff_t>(pos));
+  return true;
+}
+
+bool SnapshotServer::send_all(io::TcpSocket& socket,
+                              std::span<const std::byte> data) noexcept {
+  // 替代服務：client 讀取前暫時忙等 (只在測試/開發環境使用)
+  while (!data.empty()) {
+    auto n = socket.send(data);
+    if (!n) {
+      if (n.error().value() == EAGAIN) continue;
+      return false;
+    }
+    data = data.subspan(*n);
+  }
+  return true;
+}
+
+}  // namespace tx::feed
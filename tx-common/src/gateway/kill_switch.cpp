@@ -0,0 +1,135 @@
+#include "tx/gateway/kill_switch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <system_error>
+#include <utility>
+
+#include "tx/net/fix/constains.hpp"
+
+namespace tx::gateway {
+
+namespace {
+
+/// @brief OrderId 多為遞增序號，乘法混合後取高位分散到各格
+[[nodiscard]] size_t hash_order(core::OrderId id, size_t mask) noexcept {
+  return static_cast<size_t>((id.value() * 0x9E3779B97F4A7C15ULL) >> 32) &
+         mask;
+}
+
+}  // namespace
+
+KillSwitch::KillSwitch(size_t max_orders)
+    : slots_(std::bit_ceil(std::max<size_t>(max_orders, 1) * 2)),
+      slot_mask_(slots_.size() - 1),
+      iov_(kMaxBatch),
+      max_orders_(max_orders) {}
+
+KillSwitch::SessionId KillSwitch::add_session(
+    const net::fix::SessionHeader& header) {
+  Session session{.begin_string = std::string(header.begin_string),
+                  .sender = std::string(header.sender),
+                  .target = std::string(header.target),
+                  .precision = header.precision,
+                  .cancels = {},
+                  .ids = {}};
+  session.cancels.reserve(max_orders_);
+  session.ids.reserve(max_orders_);
+  sessions_.push_back(std::move(session));
+  return static_cast<SessionId>(sessions_.size() - 1);
+}
+
+// ----------------------------------------------------------------------------
+// 委託狀態
+// ----------------------------------------------------------------------------
+
+Result<> KillSwitch::track(core::OrderId id, SessionId session,
+                           const CancelFields& fields) noexcept {
+  namespace tags = net::fix::tags;
+
+  if (id == core::OrderId::invalid()) {
+    return tx::fail(std::errc::invalid_argument, "Invalid OrderId");
+  }
+  auto& target = sessions_[session];
+  net::fix::PreparedMessage cancel(target.header(), "F");
+  cancel.add(tags::OrigClOrdID, fields.orig_cl_ord_id)
+      .add(tags::ClOrdID, fields.cl_ord_id);
+  if (!fields.order_id.empty()) {
+    cancel.add(tags::OrderID, fields.order_id);
+  }
+  cancel.add(tags::Symbol, fields.symbol)
+      .add(tags::Side, fields.side == core::Side::Buy ? '1' : '2')
+      .add_time(tags::TransactTime)
+      .add(tags::OrderQty, fields.order_qty.value());
+  CHECK(cancel.finish());
+
+  // 改單 (或換 session)：先移除舊的
+  if (const size_t pos = find_slot(id); slots_[pos].key == id) {
+    if (slots_[pos].slot.session == session) {
+      target.cancels[slots_[pos].slot.index] = cancel;
+      return {};
+    }
+    untrack(id);
+  }
+  if (live_ == max_orders_) {
+    return tx::fail(std::errc::no_buffer_space, "Kill switch is full");
+  }
+
+  // untrack() 可能移動其他項目，重新探測空格
+  Entry& entry = slots_[find_slot(id)];
+  entry.key = id;
+  entry.slot = {session, static_cast<uint32_t>(target.ids.size())};
+  ++live_;
+  target.cancels.push_back(cancel);
+  target.ids.push_back(id);
+  return {};
+}
+
+void KillSwitch::untrack(core::OrderId id) noexcept {
+  const size_t pos = find_slot(id);
+  if (slots_[pos].key != id) return;
+  const Slot slot = slots_[pos].slot;
+  erase_slot(pos);
+
+  // 與最後一筆交換，保持連續
+  auto& session = sessions_[slot.session];
+  const size_t last = session.ids.size() - 1;
+  if (slot.index != last) {
+    session.cancels[slot.index] = session.cancels[last];
+    session.ids[slot.index] = session.ids[last];
+    slots_[find_slot(session.ids[slot.index])].slot.index = slot.index;
+  }
+  session.cancels.pop_back();
+  session.ids.pop_back();
+}
+
+// ----------------------------------------------------------------------------
+// 索引表
+// ----------------------------------------------------------------------------
+
+size_t KillSwitch::find_slot(core::OrderId id) const noexcept {
+  // 表至少保留一半空格，探測必定終止
+  size_t pos = hash_order(id, slot_mask_);
+  while (slots_[pos].key != id &&
+         slots_[pos].key != core::OrderId::invalid()) {
+    pos = (pos + 1) & slot_mask_;
+  }
+  return pos;
+}
+
+void KillSwitch::erase_slot(size_t pos) noexcept {
+  // backward shift：把後方探測鏈上可以前移的項目補進空格，不需墓碑
+  size_t next = (pos + 1) & slot_mask_;
+  while (slots_[next].key != core::OrderId::invalid()) {
+    const size_t home = hash_order(slots_[next].key, slot_mask_);
+    if (((next - home) & slot_mask_) >= ((next - pos) & slot_mask_)) {
+      slots_[pos] = slots_[next];
+      pos = next;
+    }
+    next = (next + 1) & slot_mask_;
+  }
+  slots_[pos] = Entry{};
+  --live_;
+}
+
+}  // namespace tx::gateway
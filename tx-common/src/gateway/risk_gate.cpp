@@ -0,0 +1,35 @@
+#include "tx/gateway/risk_gate.hpp"
+
+#include <system_error>
+#include <utility>
+
+namespace tx::gateway {
+
+RiskTable::RiskTable(size_t max_instruments) : limits_(max_instruments) {}
+
+Result<> RiskTable::set(market::InstrumentId id,
+                        const RiskLimits& limits) noexcept {
+  if (id >= limits_.size()) {
+    return tx::fail(std::errc::result_out_of_range,
+                    "InstrumentId exceeds risk table capacity");
+  }
+  if (limits.max_order_qty < 0 || limits.max_position < 0) {
+    return tx::fail(std::errc::invalid_argument,
+                    "Risk limits must be non-negative");
+  }
+  limits_[id] = limits;
+  return {};
+}
+
+RiskGate::RiskGate(market::ReferenceData::Reader reference,
+                   RiskData::Reader limits) noexcept
+    : reference_(std::move(reference)), limits_(std::move(limits)) {}
+
+Result<RiskGate> RiskGate::create(market::ReferenceData& reference,
+                                  RiskData& limits) noexcept {
+  auto reference_reader = TRY(reference.register_reader());
+  auto limits_reader = TRY(limits.register_reader());
+  return RiskGate(std::move(reference_reader), std::move(limits_reader));
+}
+
+}  // namespace tx::gateway
@@ -0,0 +1,223 @@
+#include "tx/io/reactor.hpp"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <system_error>
+#include <utility>
+
+#include "tx/error.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::io {
+
+// ----------------------------------------------------------------------------
+// Factory Methods
+// ----------------------------------------------------------------------------
+
+Result<Reactor> Reactor::create() noexcept {
+  int epfd = ::epoll_create1(EPOLL_CLOEXEC);
+  if (epfd < 0) {
+    return tx::fail(errno, "epoll_create1() failed");
+  }
+
+  return Reactor(epfd, std::make_unique<Timers>(sys::TSCTimer::now()));
+}
+
+// ----------------------------------------------------------------------------
+// RAII
+// ----------------------------------------------------------------------------
+
+Reactor::Reactor(int epfd, std::unique_ptr<Timers> timers) noexcept
+    : epfd_(epfd), timers_(std::move(timers)) {}
+
+Reactor::~Reactor() noexcept {
+  if (epfd_ >= 0) {
+    ::close(epfd_);
+  }
+}
+
+Reactor::Reactor(Reactor&& other) noexcept
+    : epfd_(std::exchange(other.epfd_, -1)),
+      fds_(std::move(other.fds_)),
+      timers_(std::move(other.timers_)) {}
+
+Reactor& Reactor::operator=(Reactor&& other) noexcept {
+  if (this != &other) {
+    if (epfd_ >= 0) {
+      ::close(epfd_);
+    }
+    epfd_ = std::exchange(other.epfd_, -1);
+    fds_ = std::move(other.fds_);
+    timers_ = std::move(other.timers_);
+  }
+  return *this;
+}
+
+// ----------------------------------------------------------------------------
+// fd 管理
+// ----------------------------------------------------------------------------
+
+Reactor::Registration& Reactor::slot(int fd) noexcept {
+  auto idx = static_cast<size_t>(fd);
+  if (idx >= fds_.size()) [[unlikely]] {
+    std::cerr << "[Reactor] wait on fd " << fd << " without add()\n";
+    std::terminate();
+  }
+  return fds_[idx];
+}
+
+Result<> Reactor::add(int fd) noexcept {
+  if (fd < 0) {
+    return tx::fail(std::errc::bad_file_descriptor, "Invalid fd");
+  }
+
+  // 只在註冊時擴充，等待路徑上不會配置記憶體
+  auto idx = static_cast<size_t>(fd);
+  if (idx >= fds_.size()) {
+    fds_.resize(idx + 1);
+  }
+
+  Registration& reg = fds_[idx];
+  if (reg.registered) {
+    return {};
+  }
+
+  epoll_event ev{};
+  ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+  ev.data.fd = fd;
+  if (::epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) < 0) {
+    return tx::fail(errno, "epoll_ctl(ADD) failed");
+  }
+
+  reg = Registration{.registered = true};
+  return {};
+}
+
+Result<> Reactor::remove(int fd) noexcept {
+  if (fd < 0 || static_cast<size_t>(fd) >= fds_.size()) {
+    return tx::fail(std::errc::bad_file_descriptor, "Unknown fd");
+  }
+
+  Registration& reg = fds_[static_cast<size_t>(fd)];
+  bool was_registered = reg.registered;
+  reg = Registration{};
+
+  if (was_registered && ::epoll_ctl(epfd_, EPOLL_CTL_DEL, fd, nullptr) < 0) {
+    return tx::fail(errno, "epoll_ctl(DEL) failed");
+  }
+  return {};
+}
+
+// ----------------------------------------------------------------------------
+// 等待
+// ----------------------------------------------------------------------------
+
+void Reactor::wait_readable(int fd, IoWaiter* waiter) noexcept {
+  slot(fd).reader = waiter;
+}
+
+void Reactor::wait_writable(int fd, IoWaiter* waiter) noexcept {
+  slot(fd).writer = waiter;
+}
+
+void Reactor::cancel_wait(int fd, IoWaiter* waiter) noexcept {
+  if (fd < 0 || static_cast<size_t>(fd) >= fds_.size()) {
+    return;
+  }
+  Registration& reg = fds_[static_cast<size_t>(fd)];
+  if (reg.reader == waiter) reg.reader = nullptr;
+  if (reg.writer == waiter) reg.writer = nullptr;
+}
+
+Result<sys::TimerHandle> Reactor::schedule(uint64_t deadline_tsc,
+                                           IoWaiter* waiter) noexcept {
+  return timers_->schedule(deadline_tsc, reinterpret_cast<uintptr_t>(waiter));
+}
+
+// ----------------------------------------------------------------------------
+// Event Loop
+// ----------------------------------------------------------------------------
+
+int Reactor::timer_timeout(int timeout_ms) const noexcept {
+  if (timeout_ms == 0 || timers_->empty()) {
+    return timeout_ms;
+  }
+
+  const uint64_t next = timers_->next_expiry();
+  const uint64_t now = sys::TSCTimer::now();
+  int until_next = 0;
+  if (next > now) {
+    // 無條件進位：提早醒來只會多一輪空的 poll，晚醒則會延遲 timer
+    double ms = std::ceil(sys::TSCTimer::cycles_to_ns(next - now) / 1e6);
+    until_next = ms < static_cast<double>(INT_MAX) ? static_cast<int>(ms)
+                                                   : INT_MAX;
+  }
+  return timeout_ms < 0 ? until_next : std::min(timeout_ms, until_next);
+}
+
+Result<size_t> Reactor::poll(int timeout_ms) noexcept {
+  timeout_ms = timer_timeout(timeout_ms);
+
+  std::array<epoll_event, kMaxEvents> events;
+  int n;
+  do {
+    n = ::epoll_wait(epfd_, events.data(), static_cast<int>(events.size()),
+                     timeout_ms);
+  } while (n < 0 && errno == EINTR);
+
+  if (n < 0) {
+    return tx::fail(errno, "epoll_wait() failed");
+  }
+
+  size_t fired = 0;
+  for (int i = 0; i < n; ++i) {
+    const epoll_event& ev = events[static_cast<size_t>(i)];
+    Registration& reg = fds_[static_cast<size_t>(ev.data.fd)];
+
+    // 錯誤與斷線同時喚醒讀寫兩端，由等待者自行取得錯誤
+    constexpr uint32_t kReadMask = EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR;
+    constexpr uint32_t kWriteMask = EPOLLOUT | EPOLLHUP | EPOLLERR;
+
+    if ((ev.events & kReadMask) != 0 && reg.reader != nullptr) {
+      IoWaiter* w = std::exchange(reg.reader, nullptr);
+      w->on_ready(w, ev.events);
+      ++fired;
+    }
+    // callback 可能已 remove() 此 fd，重新取得 slot
+    Registration& again = fds_[static_cast<size_t>(ev.data.fd)];
+    if ((ev.events & kWriteMask) != 0 && again.writer != nullptr) {
+      IoWaiter* w = std::exchange(again.writer, nullptr);
+      w->on_ready(w, ev.events);
+      ++fired;
+    }
+  }
+
+  fired += timers_->advance(sys::TSCTimer::now(),
+                            [](sys::TimerHandle, uint64_t data) {
+                              auto* w = reinterpret_cast<IoWaiter*>(data);
+                              w->on_ready(w, 0);
+                            });
+  return fired;
+}
+
+bool Reactor::has_pending() const noexcept {
+  if (!timers_->empty()) {
+    return true;
+  }
+  for (const auto& reg : fds_) {
+    if (reg.reader != nullptr || reg.writer != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace tx::io
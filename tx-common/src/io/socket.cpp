@@ -108,6 +108,41 @@ Result<> Socket::connect(const SocketAddress& addr) noexcept {
   return {};
 }
 
+Result<bool> Socket::connect_nonblocking(const SocketAddress& addr) noexcept {
+  if (!is_valid()) {
+    return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
+  }
+
+  int ret;
+  do {
+    ret = ::connect(fd_, addr.raw(), addr.length());
+  } while (ret < 0 && errno == EINTR);
+
+  if (ret == 0) {
+    return true;
+  }
+  if (errno == EINPROGRESS) {
+    return false;
+  }
+  return tx::fail(errno, "connect() failed");
+}
+
+Result<> Socket::connect_result() const noexcept {
+  if (!is_valid()) {
+    return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
+  }
+
+  int err = 0;
+  socklen_t len = sizeof(err);
+  if (::getsockopt(fd_, SOL_SOCKET, SO_ERROR, &err, &len) < 0) {
+    return tx::fail(errno, "getsockopt(SO_ERROR) failed");
+  }
+  if (err != 0) {
+    return tx::fail(err, "connect() failed");
+  }
+  return {};
+}
+
 Result<> Socket::set_nonblocking(bool enable) noexcept {
   if (!is_valid()) {
     return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
@@ -150,7 +185,7 @@ Result<size_t> Socket::send(std::span<const std::byte> data) noexcept {
   ssize_t n;
 
   do {
-    n = ::send(fd_, data.data(), data.size(), 0);
+    n = ::send(fd_, data.data(), data.size(), MSG_NOSIGNAL);
   } while (n < 0 && errno == EINTR);
 
   if (n < 0) {
@@ -160,6 +195,27 @@ Result<size_t> Socket::send(std::span<const std::byte> data) noexcept {
   return static_cast<size_t>(n);
 }
 
+Result<size_t> Socket::writev(std::span<const iovec> iov) noexcept {
+  if (!is_valid()) {
+    return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
+  }
+
+  msghdr msg{};
+  msg.msg_iov = const_cast<iovec*>(iov.data());
+  msg.msg_iovlen = iov.size();
+  ssize_t n;
+
+  do {
+    n = ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+  } while (n < 0 && errno == EINTR);
+
+  if (n < 0) {
+    return tx::fail(errno, "sendmsg() failed");
+  }
+
+  return static_cast<size_t>(n);
+}
+
 Result<size_t> Socket::recv(std::span<std::byte> buffer) noexcept {
   if (!is_valid()) {
     return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
@@ -224,6 +280,25 @@ Result<size_t> Socket::recvfrom(std::span<std::byte> buffer,
   return static_cast<size_t>(n);
 }
 
+Result<size_t> Socket::sendmmsg(std::span<mmsghdr> msgs) noexcept {
+  if (!is_valid()) {
+    return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
+  }
+
+  int n;
+
+  do {
+    n = ::sendmmsg(fd_, msgs.data(), static_cast<unsigned int>(msgs.size()),
+                   0);
+  } while (n < 0 && errno == EINTR);
+
+  if (n < 0) {
+    return tx::fail(errno, "sendmmsg() failed");
+  }
+
+  return static_cast<size_t>(n);
+}
+
 Result<> Socket::set_reuseaddr(bool enable) noexcept {
   if (!is_valid()) {
     return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
@@ -258,6 +333,36 @@ Result<> Socket::set_recv_buffer_size(int size) noexcept {
   return {};
 }
 
+Result<> Socket::attach_filter(std::span<const sock_filter> program) noexcept {
+  if (!is_valid()) {
+    return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
+  }
+  if (program.empty() || program.size() > BPF_MAXINSNS) {
+    return tx::fail(std::errc::invalid_argument, "Invalid BPF program size");
+  }
+
+  // kernel 只讀取 filter 內容，const_cast 僅為配合 sock_fprog 的型別
+  sock_fprog fprog{.len = static_cast<unsigned short>(program.size()),
+                   .filter = const_cast<sock_filter*>(program.data())};
+  if (::setsockopt(fd_, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) <
+      0) {
+    return tx::fail(errno, "setsockopt(SO_ATTACH_FILTER) failed");
+  }
+  return {};
+}
+
+Result<> Socket::detach_filter() noexcept {
+  if (!is_valid()) {
+    return tx::fail(std::errc::bad_file_descriptor, "Invalid socket");
+  }
+  int dummy = 0;
+  if (::setsockopt(fd_, SOL_SOCKET, SO_DETACH_FILTER, &dummy, sizeof(dummy)) <
+      0) {
+    return tx::fail(errno, "setsockopt(SO_DETACH_FILTER) failed");
+  }
+  return {};
+}
+
 Result<> Socket::join_multicast_group(
     const SocketAddress& multicast_addr,
     const SocketAddress& interface_addr) noexcept {
@@ -1,5 +1,12 @@
 #include "tx/io/tcp_socket.hpp"
 
+#include <poll.h>
+
+#include <cerrno>
+#include <chrono>
+#include <system_error>
+#include <utility>
+
 #include "tx/error.hpp"
 #include "tx/io/socket.hpp"
 
@@ -21,6 +28,52 @@ Result<TcpSocket> TcpSocket::connect(const SocketAddress& remote_addr,
   return TcpSocket(std::move(socket));
 }
 
+Result<TcpSocket> TcpSocket::connect(const SocketAddress& remote_addr,
+                                     std::chrono::nanoseconds timeout,
+                                     bool nodelay) noexcept {
+  using Clock = std::chrono::steady_clock;
+  const auto deadline = Clock::now() + timeout;
+
+  auto socket = TRY(start_connect(remote_addr, nodelay));
+
+  pollfd pfd{.fd = socket.fd(), .events = POLLOUT, .revents = 0};
+  while (true) {
+    auto left = std::chrono::ceil<std::chrono::milliseconds>(deadline -
+                                                             Clock::now());
+    if (left.count() <= 0) {
+      return tx::fail(std::errc::timed_out, "connect() timed out");
+    }
+
+    int ret = ::poll(&pfd, 1, static_cast<int>(left.count()));
+    if (ret > 0) {
+      break;
+    }
+    if (ret < 0 && errno != EINTR) {
+      return tx::fail(errno, "poll() failed");
+    }
+  }
+
+  CHECK(socket.connect_result());
+  CHECK(socket.set_nonblocking(false));
+
+  return socket;
+}
+
+Result<TcpSocket> TcpSocket::start_connect(const SocketAddress& remote_addr,
+                                           bool nodelay) noexcept {
+  auto socket = TRY(Socket::create_tcp());
+
+  if (nodelay) {
+    // 失敗只影響延遲，連線仍可使用，與阻塞式 connect() 相同不視為錯誤
+    (void)socket.set_tcp_nodelay(true);
+  }
+
+  CHECK(socket.set_nonblocking(true));
+  CHECK(socket.connect_nonblocking(remote_addr));
+
+  return TcpSocket(std::move(socket));
+}
+
 Result<TcpSocket> TcpSocket::serve(const SocketAddress& local_addr,
                                    int backlog) noexcept {
   auto socket = TRY(Socket::create_tcp());
@@ -1,11 +1,14 @@
 #include "tx/io/udp_socket.hpp"
 
 #include <system_error>
+#include <utility>
 
 #include "tx/error.hpp"
 
 namespace tx::io {
 
+UdpSocket::UdpSocket(Socket socket) noexcept : socket_(std::move(socket)) {}
+
 Result<UdpSocket> UdpSocket::create() noexcept {
   auto socket = TRY(Socket::create_udp());
 
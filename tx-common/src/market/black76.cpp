@@ -0,0 +1,498 @@
+#include "tx/market/black76.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <numbers>
+
+namespace tx::market {
+
+namespace {
+
+// ----------------------------------------------------------------------------
+// 常數
+// ----------------------------------------------------------------------------
+
+constexpr double kInvSqrt2Pi = std::numbers::inv_sqrtpi / std::numbers::sqrt2;
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+/// @brief 隱含波動率的搜尋區間與收斂條件
+constexpr double kMinVol = 1e-4;
+constexpr double kMaxVol = 5.0;
+constexpr double kVolTolerance = 1e-10;
+constexpr int kMaxIterations = 64;
+
+/// @brief call 為 +1、put 為 -1：price = s * df * (F N(s d1) - K N(s d2))
+[[nodiscard]] double sign_of(OptionType type) noexcept {
+  return type == OptionType::Call ? 1.0 : -1.0;
+}
+
+/// @brief 隱含波動率的起點：前一次的結果，或 Manaster-Koehler 的反曲點
+[[nodiscard]] double initial_vol(double previous, double log_fk,
+                                 double expiry) noexcept {
+  if (previous > kMinVol && previous < kMaxVol) return previous;
+  return std::clamp(std::sqrt(2.0 * std::abs(log_fk) / expiry), kMinVol,
+                    kMaxVol);
+}
+
+// ----------------------------------------------------------------------------
+// Scalar (參考實作)
+// ----------------------------------------------------------------------------
+
+struct Greeks {
+  double price;
+  double delta;
+  double gamma;
+  double vega;
+};
+
+[[nodiscard]] double norm_cdf(double x) noexcept {
+  return 0.5 * std::erfc(-x / std::numbers::sqrt2);
+}
+
+[[nodiscard]] Greeks greeks_scalar(const BlackParams& p, double strike,
+                                   double vol) noexcept {
+  const double s = sign_of(p.type);
+  const double sqrt_t = std::sqrt(p.expiry);
+  const double sd = vol * sqrt_t;
+  const double d1 = (std::log(p.forward / strike) + 0.5 * sd * sd) / sd;
+  const double d2 = d1 - sd;
+  const double n1 = norm_cdf(s * d1);
+  const double n2 = norm_cdf(s * d2);
+  const double density = kInvSqrt2Pi * std::exp(-0.5 * d1 * d1);
+  return {.price = s * p.discount * (p.forward * n1 - strike * n2),
+          .delta = s * p.discount * n1,
+          .gamma = p.discount * density / (p.forward * sd),
+          .vega = p.discount * p.forward * density * sqrt_t};
+}
+
+void black76_greeks_scalar(const BlackParams& params, const int32_t* strike,
+                           const double* vol, const GreeksOut& out,
+                           size_t count) noexcept {
+  for (size_t i = 0; i < count; ++i) {
+    const Greeks g =
+        greeks_scalar(params, static_cast<double>(strike[i]), vol[i]);
+    if (out.price != nullptr) out.price[i] = g.price;
+    if (out.delta != nullptr) out.delta[i] = g.delta;
+    if (out.gamma != nullptr) out.gamma[i] = g.gamma;
+    if (out.vega != nullptr) out.vega[i] = g.vega;
+  }
+}
+
+[[nodiscard]] double implied_vol_scalar(const BlackParams& p, double strike,
+                                        double target,
+                                        double previous) noexcept {
+  double s = sign_of(p.type);
+  const double forward_value = s * p.discount * (p.forward - strike);
+  const double upper =
+      p.discount * (p.type == OptionType::Call ? p.forward : strike);
+  if (!(target > std::max(forward_value, 0.0) && target < upper)) return kNaN;
+
+  // 價內：以 put-call parity 換成價外的另一邊 (只剩時間價值)
+  if (forward_value > 0) {
+    target -= forward_value;
+    s = -s;
+  }
+  BlackParams otm = p;
+  otm.type = s > 0 ? OptionType::Call : OptionType::Put;
+  const double log_target = std::log(target);
+
+  double lo = kMinVol;
+  double hi = kMaxVol;
+  double vol = initial_vol(previous, std::log(p.forward / strike), p.expiry);
+  for (int iter = 0; iter < kMaxIterations; ++iter) {
+    const Greeks g = greeks_scalar(otm, strike, vol);
+    if (g.price > target) {
+      hi = vol;
+    } else {
+      lo = vol;
+    }
+    double next = vol - (std::log(g.price) - log_target) * g.price / g.vega;
+    if (!(next > lo && next < hi)) next = 0.5 * (lo + hi);
+    const bool converged = std::abs(next - vol) < kVolTolerance;
+    vol = next;
+    if (converged) break;
+  }
+  return vol;
+}
+
+void black76_implied_vol_scalar(const BlackParams& params,
+                                const int32_t* strike, const double* price,
+                                double* vol, size_t count) noexcept {
+  for (size_t i = 0; i < count; ++i) {
+    vol[i] = implied_vol_scalar(params, static_cast<double>(strike[i]),
+                                price[i], vol[i]);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// SIMD
+// ----------------------------------------------------------------------------
+//
+// 以 GCC vector extension 撰寫一次，再由 AVX2 (4 lanes) 與 AVX-512
+// (8 lanes) 的 target 函式展開。輔助函式一律 always_inline 並以參考傳遞
+// 向量 (不以值傳遞/回傳)，避免跨 target 的 vector ABI 問題；向量間的
+// 位元轉換用 reinterpret_cast (std::bit_cast 是以值回傳的函式)。
+
+template <size_t W>
+struct Lanes {
+  using D [[gnu::vector_size(W * sizeof(double))]] = double;
+  using I [[gnu::vector_size(W * sizeof(int64_t))]] = int64_t;
+  using S [[gnu::vector_size(W * sizeof(int32_t))]] = int32_t;
+};
+
+/// @brief 1 / k!，k = 0..12 (|r| <= ln2 / 2 時截斷誤差 < 1e-16)
+constexpr auto kExpTaylor = [] {
+  std::array<double, 13> c{};
+  c[0] = 1.0;
+  for (size_t k = 1; k < c.size(); ++k) {
+    c[k] = c[k - 1] / static_cast<double>(k);
+  }
+  return c;
+}();
+
+/// @brief 1 / (2k + 1)，k = 0..9 (|s| <= 0.1716 時截斷誤差 < 1e-16)
+constexpr auto kLogAtanh = [] {
+  std::array<double, 10> c{};
+  for (size_t k = 0; k < c.size(); ++k) {
+    c[k] = 1.0 / static_cast<double>(2 * k + 1);
+  }
+  return c;
+}();
+
+/// @brief 常態分配 (Hart 1968 / West 2005) 的有理近似係數
+constexpr std::array<double, 7> kCdfNum = {
+    220.206867912376, 221.213596169931, 112.079291497871, 33.912866078383,
+    6.37396220353165, 0.700383064443688, 3.52624965998911e-02};
+constexpr std::array<double, 8> kCdfDen = {
+    440.413735824752, 793.826512519948, 637.333633378831, 296.564248779674,
+    86.7807322029461, 16.064177579207,  1.75566716318264, 8.83883476483184e-02};
+
+constexpr double kLn2Hi = 0x1.62e42fefa39efp-1;
+constexpr double kLn2Lo = 0x1.abc9e3b39803fp-56;
+/// @brief 1.5 * 2^52：加上後尾數的低位即為四捨五入的整數
+constexpr double kRoundShift = 0x1.8p52;
+
+template <typename D, size_t N>
+[[gnu::always_inline]] inline void horner(D& acc, const D& x,
+                                          const std::array<double, N>& c) {
+  acc = D{} + c[N - 1];
+  for (size_t i = N - 1; i-- > 0;) acc = acc * x + c[i];
+}
+
+/// @brief x = e^x (x 限制在 [-708, 708])
+template <typename D>
+[[gnu::always_inline]] inline void exp_inplace(D& x) noexcept {
+  using I = decltype(x < x);
+  x = x < -708.0 ? D{} - 708.0 : x;
+  x = x > 708.0 ? D{} + 708.0 : x;
+
+  const D shift = D{} + kRoundShift;
+  const D t = x * std::numbers::log2e + shift;
+  const D n = t - shift;
+  const D r = (x - n * kLn2Hi) - n * kLn2Lo;
+  D poly;
+  horner(poly, r, kExpTaylor);
+
+  // 2^n：直接組出 exponent 欄位
+  const I n_int = reinterpret_cast<I>(t) - reinterpret_cast<I>(shift);
+  const I scale = (n_int + 1023) << 52;
+  x = poly * reinterpret_cast<D>(scale);
+}
+
+/// @brief x = ln(x) (x 為正規化的正數)
+template <typename D>
+[[gnu::always_inline]] inline void log_inplace(D& x) noexcept {
+  using I = decltype(x < x);
+  constexpr int64_t kMantissa = (int64_t{1} << 52) - 1;
+  const I bits = reinterpret_cast<I>(x);
+
+  // x = m * 2^e，m 調整到 [sqrt(2)/2, sqrt(2))
+  I e = ((bits >> 52) & 0x7FF) - 1023;
+  constexpr int64_t kOne = std::bit_cast<int64_t>(1.0);
+  D m = reinterpret_cast<D>((bits & kMantissa) | kOne);
+  const I big = m > std::numbers::sqrt2;
+  m = big ? m * 0.5 : m;
+  e -= big;
+
+  // ln(m) = 2 atanh(s)，s = (m - 1) / (m + 1)
+  const D s = (m - 1.0) / (m + 1.0);
+  D poly;
+  horner(poly, s * s, kLogAtanh);
+
+  // int64 -> double：AVX2 沒有對應指令，以 kRoundShift 轉換
+  const D shift = D{} + kRoundShift;
+  const D ed = reinterpret_cast<D>(e + reinterpret_cast<I>(shift)) - shift;
+  x = ed * kLn2Hi + (ed * kLn2Lo + 2.0 * s * poly);
+}
+
+/// @brief 常態分配的 CDF 與 density
+template <typename D>
+[[gnu::always_inline]] inline void norm_cdf_inplace(const D& x, D& cdf,
+                                                    D& density) noexcept {
+  const D ax = x < 0.0 ? -x : x;
+  D e = -0.5 * ax * ax;
+  exp_inplace(e);
+  density = e * kInvSqrt2Pi;
+
+  // |x| < 5 sqrt(2)：有理近似
+  D num;
+  D den;
+  horner(num, ax, kCdfNum);
+  horner(den, ax, kCdfDen);
+  const D near = e * num / den;
+
+  // 其餘：連分數 (極少出現，全部 lane 都在範圍內時跳過)
+  constexpr double kNearLimit = 7.07106781186547;
+  const auto is_far = ax >= kNearLimit;
+  bool any_far = false;
+  for (size_t j = 0; j < sizeof(D) / sizeof(double); ++j) {
+    any_far |= is_far[j] != 0;
+  }
+  D tail = near;
+  if (any_far) [[unlikely]] {
+    D build = ax + 0.65;
+    build = ax + 4.0 / build;
+    build = ax + 3.0 / build;
+    build = ax + 2.0 / build;
+    build = ax + 1.0 / build;
+    tail = is_far ? density / build : near;
+  }
+  cdf = x > 0.0 ? 1.0 - tail : tail;
+}
+
+/// @brief 同一到期月份的向量化常數
+template <typename D>
+struct Context {
+  D forward;
+  double discount;
+  double sqrt_t;
+};
+
+/// @brief 價格與 Greeks (未使用的輸出由編譯器刪除)
+/// @param sign call 為 +1、put 為 -1 (可逐 lane 不同)
+template <typename D>
+[[gnu::always_inline]] inline void black_core(const Context<D>& ctx,
+                                              const D& sign, const D& strike,
+                                              const D& log_fk, const D& vol,
+                                              D& price, D& delta, D& gamma,
+                                              D& vega) noexcept {
+  const D sd = vol * ctx.sqrt_t;
+  const D inv_sd = 1.0 / sd;
+  const D d1 = log_fk * inv_sd + 0.5 * sd;
+  const D d2 = d1 - sd;
+  D n1;
+  D n2;
+  D density;
+  D unused;
+  norm_cdf_inplace(sign * d1, n1, density);
+  norm_cdf_inplace(sign * d2, n2, unused);
+
+  const D sdf = sign * ctx.discount;
+  price = sdf * (ctx.forward * n1 - strike * n2);
+  delta = sdf * n1;
+  gamma = ctx.discount * density * inv_sd / ctx.forward;
+  vega = ctx.discount * ctx.sqrt_t * ctx.forward * density;
+}
+
+/// @brief 讀取 lanes 個元素，其餘補 pad
+template <typename V, typename T>
+[[gnu::always_inline]] inline void load(V& v, const T* src, size_t lanes,
+                                        T pad) noexcept {
+  constexpr size_t kWidth = sizeof(V) / sizeof(T);
+  if (lanes == kWidth) [[likely]] {
+    std::memcpy(&v, src, sizeof(V));
+    return;
+  }
+  std::array<T, kWidth> tmp;
+  tmp.fill(pad);
+  std::memcpy(tmp.data(), src, lanes * sizeof(T));
+  std::memcpy(&v, tmp.data(), sizeof(V));
+}
+
+template <typename D>
+[[gnu::always_inline]] inline void store(double* dst, const D& v,
+                                         size_t lanes) noexcept {
+  if (dst != nullptr) std::memcpy(dst, &v, lanes * sizeof(double));
+}
+
+template <size_t W>
+[[gnu::always_inline]] inline void greeks_simd(const BlackParams& params,
+                                               const int32_t* strike,
+                                               const double* vol,
+                                               const GreeksOut& out,
+                                               size_t count) noexcept {
+  using D = typename Lanes<W>::D;
+  using S = typename Lanes<W>::S;
+  const Context<D> ctx{.forward = D{} + params.forward,
+                       .discount = params.discount,
+                       .sqrt_t = std::sqrt(params.expiry)};
+  const D sign = D{} + sign_of(params.type);
+
+  for (size_t i = 0; i < count; i += W) {
+    const size_t lanes = std::min(W, count - i);
+    S ks;
+    D v;
+    load(ks, strike + i, lanes, 1);
+    load(v, vol + i, lanes, 1.0);
+    const D k = __builtin_convertvector(ks, D);
+    D log_fk = ctx.forward / k;
+    log_inplace(log_fk);
+
+    D price;
+    D delta;
+    D gamma;
+    D vega;
+    black_core(ctx, sign, k, log_fk, v, price, delta, gamma, vega);
+    store(out.price == nullptr ? nullptr : out.price + i, price, lanes);
+    store(out.delta == nullptr ? nullptr : out.delta + i, delta, lanes);
+    store(out.gamma == nullptr ? nullptr : out.gamma + i, gamma, lanes);
+    store(out.vega == nullptr ? nullptr : out.vega + i, vega, lanes);
+  }
+}
+
+template <size_t W>
+[[gnu::always_inline]] inline void implied_vol_simd(const BlackParams& params,
+                                                    const int32_t* strike,
+                                                    const double* price,
+                                                    double* vol,
+                                                    size_t count) noexcept {
+  using D = typename Lanes<W>::D;
+  using I = typename Lanes<W>::I;
+  using S = typename Lanes<W>::S;
+  const Context<D> ctx{.forward = D{} + params.forward,
+                       .discount = params.discount,
+                       .sqrt_t = std::sqrt(params.expiry)};
+  const double s = sign_of(params.type);
+  const bool is_call = params.type == OptionType::Call;
+
+  for (size_t i = 0; i < count; i += W) {
+    const size_t lanes = std::min(W, count - i);
+    S ks;
+    D target;
+    load(ks, strike + i, lanes, 1);
+    load(target, price + i, lanes, kNaN);
+    const D k = __builtin_convertvector(ks, D);
+    D log_fk = ctx.forward / k;
+    log_inplace(log_fk);
+
+    // 無套利區間外 (含 NaN) 的 lane 一開始即視為完成
+    const D forward_value = s * ctx.discount * (ctx.forward - k);
+    const D intrinsic = forward_value > 0.0 ? forward_value : D{};
+    const D upper = ctx.discount * (is_call ? ctx.forward : k);
+    const I valid = (target > intrinsic) & (target < upper);
+    I done = ~valid;
+
+    // 價內的 lane 換成價外的另一邊
+    const I itm = forward_value > 0.0;
+    const D sign = itm ? D{} - s : D{} + s;
+    target = itm ? target - forward_value : target;
+    D log_target = target;
+    log_inplace(log_target);
+
+    D v;
+    load(v, vol + i, lanes, 0.0);
+    for (size_t j = 0; j < W; ++j) {
+      v[j] = initial_vol(v[j], log_fk[j], params.expiry);
+    }
+    D lo = D{} + kMinVol;
+    D hi = D{} + kMaxVol;
+    for (int iter = 0; iter < kMaxIterations; ++iter) {
+      D model;
+      D delta;
+      D gamma;
+      D vega;
+      black_core(ctx, sign, k, log_fk, v, model, delta, gamma, vega);
+      const I above = model > target;
+      hi = above ? v : hi;
+      lo = above ? lo : v;
+
+      D log_model = model;
+      log_inplace(log_model);
+      D next = v - (log_model - log_target) * model / vega;
+      const I inside = (next > lo) & (next < hi) & (model > 0.0);
+      next = inside ? next : 0.5 * (lo + hi);
+      const D step = next - v;
+      const I converged = (step < kVolTolerance) & (step > -kVolTolerance);
+      v = done != 0 ? v : next;
+      done |= converged;
+
+      bool all_done = true;
+      for (size_t j = 0; j < W; ++j) all_done &= done[j] != 0;
+      if (all_done) break;
+    }
+    const D result = valid != 0 ? v : D{} + kNaN;
+    store(vol + i, result, lanes);
+  }
+}
+
+TX_TARGET_AVX2 void black76_greeks_avx2(const BlackParams& params,
+                                        const int32_t* strike,
+                                        const double* vol,
+                                        const GreeksOut& out,
+                                        size_t count) noexcept {
+  greeks_simd<4>(params, strike, vol, out, count);
+}
+
+TX_TARGET_AVX512 void black76_greeks_avx512(const BlackParams& params,
+                                            const int32_t* strike,
+                                            const double* vol,
+                                            const GreeksOut& out,
+                                            size_t count) noexcept {
+  greeks_simd<8>(params, strike, vol, out, count);
+}
+
+TX_TARGET_AVX2 void black76_implied_vol_avx2(const BlackParams& params,
+                                             const int32_t* strike,
+                                             const double* price, double* vol,
+                                             size_t count) noexcept {
+  implied_vol_simd<4>(params, strike, price, vol, count);
+}
+
+TX_TARGET_AVX512 void black76_implied_vol_avx512(const BlackParams& params,
+                                                 const int32_t* strike,
+                                                 const double* price,
+                                                 double* vol,
+                                                 size_t count) noexcept {
+  implied_vol_simd<8>(params, strike, price, vol, count);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// Dispatch Objects
+// ----------------------------------------------------------------------------
+
+namespace kernels {
+
+constinit simd::Dispatch<void(const BlackParams&, const int32_t*,
+                              const double*, const GreeksOut&, size_t)>
+    black76_greeks{{.scalar = black76_greeks_scalar,
+                    .avx2 = black76_greeks_avx2,
+                    .avx512 = black76_greeks_avx512}};
+
+constinit simd::Dispatch<void(const BlackParams&, const int32_t*,
+                              const double*, double*, size_t)>
+    black76_implied_vol{{.scalar = black76_implied_vol_scalar,
+                         .avx2 = black76_implied_vol_avx2,
+                         .avx512 = black76_implied_vol_avx512}};
+
+}  // namespace kernels
+
+void resolve_black76(simd::Isa max) noexcept {
+  kernels::black76_greeks.resolve(max);
+  kernels::black76_implied_vol.resolve(max);
+}
+
+namespace {
+
+// 啟動時換成最佳實作 (在此之前的呼叫使用 scalar 版本)
+[[maybe_unused]] const bool kResolved =
+    (resolve_black76(simd::active_isa()), true);
+
+}  // namespace
+
+}  // namespace tx::market
@@ -0,0 +1,112 @@
+#include "tx/market/options_chain.hpp"
+
+#include <bit>
+#include <system_error>
+
+namespace tx::market {
+
+OptionsChain::OptionsChain(size_t max_instruments)
+    : legs_(max_instruments, kUnbound) {}
+
+// ----------------------------------------------------------------------------
+// 建立
+// ----------------------------------------------------------------------------
+
+Result<ExpiryId> OptionsChain::add_expiry(
+    uint32_t contract_month, std::span<const core::Price> strikes) {
+  if (expiries_.size() > UINT16_MAX) {
+    return tx::fail(std::errc::no_buffer_space, "Too many expiries");
+  }
+  if (strikes.empty()) {
+    return tx::fail(std::errc::invalid_argument, "Expiry without strikes");
+  }
+  for (size_t i = 1; i < strikes.size(); ++i) {
+    if (strikes[i] <= strikes[i - 1]) {
+      return tx::fail(std::errc::invalid_argument,
+                      "Strikes must be strictly increasing");
+    }
+  }
+
+  const auto begin = static_cast<uint32_t>(strikes_.size());
+  const size_t total = strikes_.size() + strikes.size();
+  for (const auto strike : strikes) {
+    strikes_.push_back(static_cast<int32_t>(strike.to_ticks()));
+  }
+  for (Quotes* q : {&calls_, &puts_}) {
+    q->bid_px.resize(total, 0);
+    q->ask_px.resize(total, 0);
+    q->bid_qty.resize(total, 0);
+    q->ask_qty.resize(total, 0);
+  }
+  call_cold_.resize(total);
+  put_cold_.resize(total);
+
+  expiries_.push_back({.contract_month = contract_month,
+                       .begin = begin,
+                       .size = static_cast<uint32_t>(strikes.size())});
+  return static_cast<ExpiryId>(expiries_.size() - 1);
+}
+
+Result<> OptionsChain::bind(InstrumentId id, const OptionKey& key) noexcept {
+  if (id >= legs_.size()) {
+    return tx::fail(std::errc::result_out_of_range,
+                    "InstrumentId exceeds chain capacity");
+  }
+  if (key.expiry >= expiries_.size() ||
+      key.strike >= expiries_[key.expiry].size) {
+    return tx::fail(std::errc::invalid_argument, "Unknown option key");
+  }
+  const uint32_t slot = expiries_[key.expiry].begin + key.strike;
+  legs_[id] = slot | (key.type == OptionType::Put ? kPutBit : 0);
+  return {};
+}
+
+// ----------------------------------------------------------------------------
+// 查詢
+// ----------------------------------------------------------------------------
+
+std::optional<OptionKey> OptionsChain::key_of(
+    InstrumentId id) const noexcept {
+  if (id >= legs_.size() || legs_[id] == kUnbound) return std::nullopt;
+  const uint32_t slot = legs_[id] & ~kPutBit;
+
+  // 到期月份依 begin 遞增：找最後一個 begin <= slot 者 (非 hot path)
+  size_t expiry = 0;
+  while (expiry + 1 < expiries_.size() && expiries_[expiry + 1].begin <= slot) {
+    ++expiry;
+  }
+  return OptionKey{
+      .expiry = static_cast<ExpiryId>(expiry),
+      .strike = slot - expiries_[expiry].begin,
+      .type = (legs_[id] & kPutBit) != 0 ? OptionType::Put : OptionType::Call};
+}
+
+// ----------------------------------------------------------------------------
+// 掃描
+// ----------------------------------------------------------------------------
+
+void OptionsChain::mid_prices(OptionType type, ExpiryId expiry,
+                              std::span<double> out) const noexcept {
+  const Quotes& q = quotes(type);
+  const uint32_t begin = expiries_[expiry].begin;
+  const uint32_t size = expiries_[expiry].size;
+
+  const int32_t* __restrict bid = q.bid_px.data() + begin;
+  const int32_t* __restrict ask = q.ask_px.data() + begin;
+  const uint32_t* __restrict bid_qty = q.bid_qty.data() + begin;
+  const uint32_t* __restrict ask_qty = q.ask_qty.data() + begin;
+  double* __restrict dst = out.data();
+
+  // 以位元遮罩選擇 NaN：三元運算子在 GCC 中會留下分支，無法向量化
+  constexpr uint64_t kNaNBits = 0x7FF8'0000'0000'0000ULL;
+  for (uint32_t i = 0; i < size; ++i) {
+    const double mid =
+        0.5 * (static_cast<double>(bid[i]) + static_cast<double>(ask[i]));
+    const uint64_t keep =
+        0 - static_cast<uint64_t>((bid_qty[i] != 0) & (ask_qty[i] != 0));
+    dst[i] = std::bit_cast<double>((std::bit_cast<uint64_t>(mid) & keep) |
+                                   (kNaNBits & ~keep));
+  }
+}
+
+}  // namespace tx::market
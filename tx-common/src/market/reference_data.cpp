@@ -0,0 +1,40 @@
+#include "tx/market/reference_data.hpp"
+
+#include <system_error>
+
+namespace tx::market {
+
+ReferenceTable::ReferenceTable(size_t max_instruments)
+    : specs_(max_instruments) {}
+
+Result<> ReferenceTable::set(InstrumentId id,
+                             const InstrumentSpec& spec) noexcept {
+  if (id >= specs_.size()) {
+    return tx::fail(std::errc::result_out_of_range,
+                    "InstrumentId exceeds reference table capacity");
+  }
+  if (spec.tick_size <= 0) {
+    return tx::fail(std::errc::invalid_argument, "tick_size must be positive");
+  }
+  specs_[id] = spec;
+  specs_[id].listed = true;
+  return {};
+}
+
+Result<> ReferenceTable::apply(
+    InstrumentId id, const net::taifex::ParsedI01ProductInfo& info) noexcept {
+  if (id >= specs_.size()) {
+    return tx::fail(std::errc::result_out_of_range,
+                    "InstrumentId exceeds reference table capacity");
+  }
+  InstrumentSpec& spec = specs_[id];
+  spec.reference_price = info.reference_price;
+  spec.upper_limit = info.upper_limit;
+  spec.lower_limit = info.lower_limit;
+  spec.decimal_locator = info.decimal_locator;
+  spec.trade_date = info.trade_date;
+  spec.listed = true;
+  return {};
+}
+
+}  // namespace tx::market
@@ -0,0 +1,40 @@
+#include "tx/market/spread_book.hpp"
+
+#include <algorithm>
+#include <system_error>
+
+namespace tx::market {
+
+SpreadBook::SpreadBook(size_t max_instruments)
+    : subscribers_(max_instruments) {}
+
+Result<SpreadId> SpreadBook::add_spread(std::span<const SpreadLeg> legs) {
+  if (legs.size() < 2 || legs.size() > kMaxLegs) {
+    return tx::fail(std::errc::invalid_argument,
+                    "Spread must have 2 to kMaxLegs legs");
+  }
+  for (const auto& leg : legs) {
+    if (leg.instrument >= subscribers_.size()) {
+      return tx::fail(std::errc::result_out_of_range,
+                      "InstrumentId exceeds spread book capacity");
+    }
+    if (leg.price_ratio == 0 || leg.qty_ratio == 0) {
+      return tx::fail(std::errc::invalid_argument,
+                      "Leg ratios must be non-zero");
+    }
+  }
+  if (spreads_.size() >= UINT32_MAX) {
+    return tx::fail(std::errc::no_buffer_space, "Too many spreads");
+  }
+
+  const auto id = static_cast<SpreadId>(spreads_.size());
+  Spread& spread = spreads_.emplace_back();
+  std::ranges::copy(legs, spread.legs.begin());
+  spread.leg_count = static_cast<uint32_t>(legs.size());
+  for (uint32_t i = 0; i < spread.leg_count; ++i) {
+    subscribers_[legs[i].instrument].push_back({.spread = id, .leg = i});
+  }
+  return id;
+}
+
+}  // namespace tx::market
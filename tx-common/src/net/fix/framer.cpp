@@ -0,0 +1,128 @@
+#include "tx/net/fix/framer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "tx/net/fix/constains.hpp"
+#include "tx/simd/kernels.hpp"
+
+namespace tx::net::fix {
+
+// ----------------------------------------------------------------------------
+// Helper Functions
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// @brief BeginString 欄位的長度上限 ("8=FIXT.1.1<SOH>" 為 12)
+constexpr size_t kMaxBeginStringField = 32;
+
+[[nodiscard]] bool is_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// Framer
+// ----------------------------------------------------------------------------
+
+std::span<std::byte> Framer::prepare() noexcept {
+  if (read_ == write_) {
+    // 全部處理完：只重設位置
+    read_ = 0;
+    write_ = 0;
+  } else if (buffer_.size() - write_ < kMinReadSize && read_ > 0) {
+    // 尾端空間不足：把不完整的訊息搬回開頭
+    std::memmove(buffer_.data(), buffer_.data() + read_, write_ - read_);
+    write_ -= read_;
+    read_ = 0;
+  }
+  return std::as_writable_bytes(
+      std::span(buffer_.data() + write_, buffer_.size() - write_));
+}
+
+Result<std::optional<std::string_view>> Framer::next() noexcept {
+  const char* p = buffer_.data() + read_;
+  const size_t avail = write_ - read_;
+  const std::optional<std::string_view> need_more;
+
+  // 8=<BeginString><SOH>
+  if (avail < 2) {
+    if (avail == 1 && p[0] != '8') [[unlikely]] {
+      return tx::fail(FixErrc::MissingBeginString, "FIX stream out of sync");
+    }
+    return need_more;
+  }
+  if (p[0] != '8' || p[1] != '=') [[unlikely]] {
+    return tx::fail(FixErrc::MissingBeginString, "FIX stream out of sync");
+  }
+  const size_t scan = std::min(avail, kMaxBeginStringField);
+  const size_t soh1 =
+      simd::find_byte(std::as_bytes(std::span(p, scan)), std::byte{SOH});
+  if (soh1 == scan) {
+    if (scan == kMaxBeginStringField) [[unlikely]] {
+      return tx::fail(FixErrc::InvalidFormat, "BeginString too long");
+    }
+    return need_more;
+  }
+
+  // 9=<BodyLength><SOH>
+  size_t pos = soh1 + 1;
+  if (avail < pos + 2) return need_more;
+  if (p[pos] != '9' || p[pos + 1] != '=') [[unlikely]] {
+    return tx::fail(FixErrc::MissingBodyLength, "BodyLength must follow 8=");
+  }
+  pos += 2;
+
+  size_t body_length = 0;
+  size_t digits = 0;
+  for (;; ++pos, ++digits) {
+    if (pos == avail) return need_more;
+    const char c = p[pos];
+    if (c == SOH) break;
+    if (!is_digit(c)) [[unlikely]] {
+      return tx::fail(FixErrc::InvalidFormat, "Invalid BodyLength");
+    }
+    if (digits == constraints::kBodyLengthMaxDigits) [[unlikely]] {
+      return tx::fail(FixErrc::BodyLengthExceeded, "BodyLength too large");
+    }
+    body_length = body_length * 10 + static_cast<size_t>(c - '0');
+  }
+  if (digits == 0) [[unlikely]] {
+    return tx::fail(FixErrc::InvalidFormat, "Empty BodyLength");
+  }
+
+  // 直接跳到 trailer
+  const size_t body_end = pos + 1 + body_length;
+  const size_t total = body_end + kTrailerSize;
+  if (total > buffer_.size()) [[unlikely]] {
+    return tx::fail(FixErrc::BodyLengthExceeded,
+                    "FIX message larger than framer buffer");
+  }
+  if (avail < total) return need_more;
+
+  const char* trailer = p + body_end;
+  if (std::memcmp(trailer, "10=", 3) != 0) [[unlikely]] {
+    return tx::fail(FixErrc::BodyLengthMismatch,
+                    "CheckSum not at BodyLength offset");
+  }
+  if (!is_digit(trailer[3]) || !is_digit(trailer[4]) || !is_digit(trailer[5]) ||
+      trailer[6] != SOH) [[unlikely]] {
+    return tx::fail(FixErrc::InvalidFormat, "Invalid CheckSum field");
+  }
+
+  if (verify_checksum_) {
+    const auto expected =
+        (trailer[3] - '0') * 100 + (trailer[4] - '0') * 10 + (trailer[5] - '0');
+    const uint64_t sum =
+        simd::byte_sum(std::as_bytes(std::span(p, body_end))) %
+        static_cast<uint64_t>(constraints::kChecksumModulo);
+    if (sum != static_cast<uint64_t>(expected)) [[unlikely]] {
+      return tx::fail(FixErrc::InvalidCheckSum, "FIX checksum mismatch");
+    }
+  }
+
+  read_ += total;
+  return std::optional<std::string_view>(std::string_view(p, total));
+}
+
+}  // namespace tx::net::fix
@@ -0,0 +1,126 @@
+#include "tx/net/fix/prepared_message.hpp"
+
+#include <charconv>
+
+namespace tx::net::fix {
+
+// ----------------------------------------------------------------------------
+// 建構
+// ----------------------------------------------------------------------------
+
+PreparedMessage::PreparedMessage(const SessionHeader& header,
+                                 std::string_view msg_type) noexcept {
+  TimestampCache probe(header.precision);
+  time_length_ = static_cast<uint8_t>(probe.size());
+
+  (void)add(tags::MsgType, msg_type);
+  (void)add(tags::SenderCompId, header.sender);
+  (void)add(tags::TargetCompId, header.target);
+
+  append_tag(tags::MsgSeqSum);
+  seq_offset_ = end_;
+  append(std::string_view("000000000", kSeqDigits));
+  append(std::string_view(&SOH, 1));
+
+  (void)add_time(tags::SendingTime);
+
+  // BeginString 先暫存在保留區開頭，finish() 時搬到 body 前方
+  if (header.begin_string.size() + 2 + constraints::kBodyLengthFieldReserve +
+          2 >
+      kPrefixReserve) [[unlikely]] {
+    overflow_ = true;
+    return;
+  }
+  data_[0] = static_cast<char>(header.begin_string.size());
+  std::memcpy(data_.data() + 1, header.begin_string.data(),
+              header.begin_string.size());
+}
+
+PreparedMessage& PreparedMessage::add(int tag,
+                                      std::string_view value) noexcept {
+  append_tag(tag);
+  append(value);
+  append(std::string_view(&SOH, 1));
+  return *this;
+}
+
+PreparedMessage& PreparedMessage::add(int tag, int64_t value) noexcept {
+  char buf[24];
+  const auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+  return add(tag, std::string_view(buf, static_cast<size_t>(ptr - buf)));
+}
+
+PreparedMessage& PreparedMessage::add_time(int tag) noexcept {
+  if (time_count_ == time_offsets_.size()) [[unlikely]] {
+    overflow_ = true;
+    return *this;
+  }
+  append_tag(tag);
+  time_offsets_[time_count_++] = end_;
+  // 佔位，stamp() 時覆寫 (不計入 base_sum_)
+  for (size_t i = 0; i < time_length_; ++i) append("0");
+  append(std::string_view(&SOH, 1));
+  return *this;
+}
+
+Result<> PreparedMessage::finish() noexcept {
+  if (overflow_ || end_ + kTrailerSize > kCapacity) [[unlikely]] {
+    return tx::fail(FixErrc::BodyLengthExceeded,
+                    "FIX message exceeds PreparedMessage capacity");
+  }
+  const size_t body_length = end_ - kPrefixReserve;
+
+  // 8=<BeginString><SOH>9=<len><SOH>，靠右寫在 body 前方
+  char prefix[kPrefixReserve];
+  size_t n = 0;
+  const auto begin_length = static_cast<size_t>(data_[0]);
+  std::memcpy(prefix, "8=", 2);
+  n += 2;
+  std::memcpy(prefix + n, data_.data() + 1, begin_length);
+  n += begin_length;
+  prefix[n++] = SOH;
+  std::memcpy(prefix + n, "9=", 2);
+  n += 2;
+  const auto [ptr, ec] =
+      std::to_chars(prefix + n, prefix + sizeof(prefix), body_length);
+  n = static_cast<size_t>(ptr - prefix);
+  prefix[n++] = SOH;
+
+  begin_ = static_cast<uint16_t>(kPrefixReserve - n);
+  std::memcpy(data_.data() + begin_, prefix, n);
+
+  // 固定部分的總和 (佔位的 seq / 時間除外)
+  uint32_t sum = byte_sum(data_.data() + begin_, end_ - begin_);
+  sum -= byte_sum(data_.data() + seq_offset_, kSeqDigits);
+  for (size_t i = 0; i < time_count_; ++i) {
+    sum -= byte_sum(data_.data() + time_offsets_[i], time_length_);
+  }
+  base_sum_ = sum;
+
+  append("10=000");
+  append(std::string_view(&SOH, 1));
+  finished_ = true;
+  return {};
+}
+
+// ----------------------------------------------------------------------------
+// Helper Functions
+// ----------------------------------------------------------------------------
+
+void PreparedMessage::append(std::string_view text) noexcept {
+  if (end_ + text.size() > kCapacity) [[unlikely]] {
+    overflow_ = true;
+    return;
+  }
+  std::memcpy(data_.data() + end_, text.data(), text.size());
+  end_ = static_cast<uint16_t>(end_ + text.size());
+}
+
+void PreparedMessage::append_tag(int tag) noexcept {
+  char buf[16];
+  auto [ptr, ec] = std::to_chars(buf, buf + sizeof(buf) - 1, tag);
+  *ptr++ = '=';
+  append(std::string_view(buf, static_cast<size_t>(ptr - buf)));
+}
+
+}  // namespace tx::net::fix
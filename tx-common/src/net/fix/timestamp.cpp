@@ -0,0 +1,49 @@
+#include "tx/net/fix/timestamp.hpp"
+
+#include <chrono>
+
+namespace tx::net::fix {
+
+// ----------------------------------------------------------------------------
+// Helper Functions
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void put2(char* out, unsigned value) noexcept {
+  out[0] = static_cast<char>('0' + value / 10);
+  out[1] = static_cast<char>('0' + value % 10);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// TimestampCache
+// ----------------------------------------------------------------------------
+
+void TimestampCache::refresh(uint64_t second) noexcept {
+  using namespace std::chrono;
+
+  const sys_seconds tp{seconds{static_cast<int64_t>(second)}};
+  const auto day = floor<days>(tp);
+  const year_month_day ymd{day};
+  const hh_mm_ss hms{tp - day};
+
+  // YYYYMMDD-HH:MM:SS
+  char* out = buffer_.data();
+  const auto year = static_cast<unsigned>(static_cast<int>(ymd.year()));
+  put2(out, year / 100 % 100);
+  put2(out + 2, year % 100);
+  put2(out + 4, static_cast<unsigned>(ymd.month()));
+  put2(out + 6, static_cast<unsigned>(ymd.day()));
+  out[8] = '-';
+  put2(out + 9, static_cast<unsigned>(hms.hours().count()));
+  out[11] = ':';
+  put2(out + 12, static_cast<unsigned>(hms.minutes().count()));
+  out[14] = ':';
+  put2(out + 15, static_cast<unsigned>(hms.seconds().count()));
+
+  second_ = second;
+}
+
+}  // namespace tx::net::fix
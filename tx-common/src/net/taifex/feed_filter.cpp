@@ -0,0 +1,99 @@
+#include "tx/net/taifex/feed_filter.hpp"
+
+#include <linux/filter.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include "tx/error.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+
+namespace tx::net::taifex {
+
+namespace {
+
+constexpr uint32_t kEscCode = 0x1B;
+constexpr uint32_t kAccept = 0xFFFFFFFF;  ///< 保留整個 datagram
+constexpr uint32_t kReject = 0;
+
+constexpr uint32_t kEscOffset = offsetof(PacketHeader, esc_code);
+constexpr uint32_t kChannelOffset = offsetof(PacketHeader, channel_id);
+constexpr uint32_t kMsgKindOffset =
+    sizeof(PacketHeader) + offsetof(MessageHeader, msg_kind);
+constexpr uint32_t kMsgTypeOffset =
+    sizeof(PacketHeader) + offsetof(MessageHeader, msg_type);
+
+/// @brief 條件不成立時跳到 reject 的位置 (最後再回填)
+constexpr uint8_t kToReject = 0xFF;
+
+sock_filter stmt(uint16_t code, uint32_t k) noexcept {
+  return sock_filter{.code = code, .jt = 0, .jf = 0, .k = k};
+}
+
+sock_filter jump(uint16_t code, uint32_t k, uint8_t jt, uint8_t jf) noexcept {
+  return sock_filter{.code = code, .jt = jt, .jf = jf, .k = k};
+}
+
+/// @brief 載入 1 byte 後要求等於 value
+void emit_byte_eq(std::vector<sock_filter>& prog, uint32_t offset,
+                  uint32_t value) {
+  prog.push_back(stmt(BPF_LD | BPF_B | BPF_ABS, offset));
+  prog.push_back(jump(BPF_JMP | BPF_JEQ | BPF_K, value, 0, kToReject));
+}
+
+}  // namespace
+
+Result<std::vector<sock_filter>> FeedFilter::build() const {
+  if (channels_.size() > kMaxChannels) {
+    return tx::fail(std::errc::value_too_large, "Too many channels in filter");
+  }
+
+  std::vector<sock_filter> prog;
+  prog.reserve(8 + channels_.size());
+
+  // 超出封包長度的載入會使程式直接回傳 0，因此不需額外檢查長度
+  emit_byte_eq(prog, base_ + kEscOffset, kEscCode);
+
+  if (!channels_.empty()) {
+    // BPF_H 以 big-endian 載入，與 wire 上的 network byte order 一致
+    prog.push_back(stmt(BPF_LD | BPF_H | BPF_ABS, base_ + kChannelOffset));
+    const size_t n = channels_.size();
+    for (size_t i = 0; i < n; ++i) {
+      // 命中: 跳過其餘比較；最後一個未命中: reject
+      const auto skip = static_cast<uint8_t>(n - 1 - i);
+      const uint8_t miss = i + 1 == n ? kToReject : 0;
+      prog.push_back(
+          jump(BPF_JMP | BPF_JEQ | BPF_K, channels_[i], skip, miss));
+    }
+  }
+
+  if (msg_kind_) {
+    emit_byte_eq(prog, base_ + kMsgKindOffset,
+                 static_cast<uint8_t>(*msg_kind_));
+  }
+  if (msg_type_) {
+    emit_byte_eq(prog, base_ + kMsgTypeOffset,
+                 static_cast<uint8_t>(*msg_type_));
+  }
+
+  prog.push_back(stmt(BPF_RET | BPF_K, kAccept));
+  prog.push_back(stmt(BPF_RET | BPF_K, kReject));
+
+  // 回填跳到 reject 的相對位移
+  const size_t reject = prog.size() - 1;
+  for (size_t pc = 0; pc < reject; ++pc) {
+    if (BPF_CLASS(prog[pc].code) == BPF_JMP && prog[pc].jf == kToReject) {
+      const size_t distance = reject - (pc + 1);
+      if (distance >= kToReject) {
+        return tx::fail(std::errc::value_too_large, "BPF jump out of range");
+      }
+      prog[pc].jf = static_cast<uint8_t>(distance);
+    }
+  }
+
+  return prog;
+}
+
+}  // namespace tx::net::taifex
@@ -0,0 +1,123 @@
+#include "tx/simd/cpu_features.hpp"
+
+#include <cpuid.h>
+
+#include <array>
+#include <cstdlib>
+
+namespace tx::simd {
+
+// ----------------------------------------------------------------------------
+// Helper Functions
+// ----------------------------------------------------------------------------
+
+namespace {
+
+constexpr bool bit(uint32_t reg, unsigned n) noexcept {
+  return ((reg >> n) & 1U) != 0;
+}
+
+/// @brief XCR0：OS 於 context switch 時保存的暫存器狀態
+uint64_t xgetbv0() noexcept {
+  uint32_t lo = 0;
+  uint32_t hi = 0;
+  __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+  return (static_cast<uint64_t>(hi) << 32) | lo;
+}
+
+constexpr std::array<std::string_view, kIsaCount> kIsaNames = {
+    "scalar", "sse42", "avx2", "avx512"};
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// CpuFeatures
+// ----------------------------------------------------------------------------
+
+Isa CpuFeatures::max_isa() const noexcept {
+  const bool v2 = ssse3 && sse41 && sse42 && popcnt;
+  const bool v3 = v2 && avx && avx2 && bmi1 && bmi2 && fma && lzcnt && movbe;
+  const bool v4 = v3 && avx512f && avx512bw && avx512cd && avx512dq && avx512vl;
+  if (v4) return Isa::Avx512;
+  if (v3) return Isa::Avx2;
+  if (v2) return Isa::Sse42;
+  return Isa::Scalar;
+}
+
+CpuFeatures detect_features() noexcept {
+  CpuFeatures f;
+  unsigned eax = 0;
+  unsigned ebx = 0;
+  unsigned ecx = 0;
+  unsigned edx = 0;
+
+  if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+    return f;
+  }
+  f.ssse3 = bit(ecx, 9);
+  f.fma = bit(ecx, 12);
+  f.sse41 = bit(ecx, 19);
+  f.sse42 = bit(ecx, 20);
+  f.movbe = bit(ecx, 22);
+  f.popcnt = bit(ecx, 23);
+
+  // AVX 系列需 OS 啟用 XSAVE 並保存 YMM (XCR0 bit 1, 2) /
+  // opmask + ZMM (bit 5, 6, 7)
+  const bool osxsave = bit(ecx, 27);
+  const uint64_t xcr0 = osxsave ? xgetbv0() : 0;
+  const bool os_ymm = (xcr0 & 0x6) == 0x6;
+  const bool os_zmm = os_ymm && (xcr0 & 0xE0) == 0xE0;
+
+  f.avx = os_ymm && bit(ecx, 28);
+  f.fma = f.fma && os_ymm;
+
+  if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) {
+    f.bmi1 = bit(ebx, 3);
+    f.avx2 = os_ymm && bit(ebx, 5);
+    f.bmi2 = bit(ebx, 8);
+    f.avx512f = os_zmm && bit(ebx, 16);
+    f.avx512dq = os_zmm && bit(ebx, 17);
+    f.avx512cd = os_zmm && bit(ebx, 28);
+    f.avx512bw = os_zmm && bit(ebx, 30);
+    f.avx512vl = os_zmm && bit(ebx, 31);
+  }
+
+  if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) != 0) {
+    f.lzcnt = bit(ecx, 5);
+  }
+  return f;
+}
+
+const CpuFeatures& cpu_features() noexcept {
+  static const CpuFeatures features = detect_features();
+  return features;
+}
+
+Isa active_isa() noexcept {
+  static const Isa isa = [] {
+    Isa max = cpu_features().max_isa();
+    if (const char* env = std::getenv("TX_SIMD_ISA")) {
+      if (auto requested = parse_isa(env); requested && *requested < max) {
+        max = *requested;
+      }
+    }
+    return max;
+  }();
+  return isa;
+}
+
+std::optional<Isa> parse_isa(std::string_view name) noexcept {
+  for (size_t i = 0; i < kIsaNames.size(); ++i) {
+    if (kIsaNames[i] == name) {
+      return static_cast<Isa>(i);
+    }
+  }
+  return std::nullopt;
+}
+
+std::string_view to_string(Isa isa) noexcept {
+  const auto index = static_cast<size_t>(isa);
+  return index < kIsaNames.size() ? kIsaNames[index] : "unknown";
+}
+
+}  // namespace tx::simd
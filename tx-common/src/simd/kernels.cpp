@@ -0,0 +1,243 @@
+#include "tx/simd/kernels.hpp"
+
+#include <immintrin.h>
+
+#include <bit>
+
+namespace tx::simd {
+
+// ----------------------------------------------------------------------------
+// find_byte
+// ----------------------------------------------------------------------------
+
+namespace {
+
+size_t find_byte_scalar(const std::byte* data, size_t size,
+                        std::byte value) noexcept {
+  for (size_t i = 0; i < size; ++i) {
+    if (data[i] == value) return i;
+  }
+  return size;
+}
+
+TX_TARGET_SSE42 size_t find_byte_sse42(const std::byte* data, size_t size,
+                                       std::byte value) noexcept {
+  const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    const auto mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+    if (mask != 0) {
+      return i + static_cast<size_t>(std::countr_zero(mask));
+    }
+  }
+  return i + find_byte_scalar(data + i, size - i, value);
+}
+
+TX_TARGET_AVX2 size_t find_byte_avx2(const std::byte* data, size_t size,
+                                     std::byte value) noexcept {
+  const __m256i needle = _mm256_set1_epi8(static_cast<char>(value));
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    const auto mask = static_cast<uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+    if (mask != 0) {
+      return i + static_cast<size_t>(std::countr_zero(mask));
+    }
+  }
+  return i + find_byte_sse42(data + i, size - i, value);
+}
+
+TX_TARGET_AVX512 size_t find_byte_avx512(const std::byte* data, size_t size,
+                                         std::byte value) noexcept {
+  const __m512i needle = _mm512_set1_epi8(static_cast<char>(value));
+  for (size_t i = 0; i < size; i += 64) {
+    // 尾端以 masked load 讀取 (不會存取範圍外的記憶體)
+    const size_t remain = size - i;
+    const __mmask64 valid =
+        remain >= 64 ? ~__mmask64{0} : (__mmask64{1} << remain) - 1;
+    const __m512i v = _mm512_maskz_loadu_epi8(valid, data + i);
+    const __mmask64 hit = _mm512_mask_cmpeq_epi8_mask(valid, v, needle);
+    if (hit != 0) {
+      return i + static_cast<size_t>(std::countr_zero(hit));
+    }
+  }
+  return size;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// byte_sum
+// ----------------------------------------------------------------------------
+
+namespace {
+
+uint64_t byte_sum_scalar(const std::byte* data, size_t size) noexcept {
+  uint64_t sum = 0;
+  for (size_t i = 0; i < size; ++i) {
+    sum += std::to_integer<uint8_t>(data[i]);
+  }
+  return sum;
+}
+
+// psadbw 對 0 取絕對差和 = 每 8 bytes 的總和 (放在 64-bit lane)
+
+TX_TARGET_SSE42 uint64_t byte_sum_sse42(const std::byte* data,
+                                        size_t size) noexcept {
+  const __m128i zero = _mm_setzero_si128();
+  __m128i acc = zero;
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+    acc = _mm_add_epi64(acc, _mm_sad_epu8(v, zero));
+  }
+  const auto sum = static_cast<uint64_t>(_mm_cvtsi128_si64(acc)) +
+                   static_cast<uint64_t>(_mm_extract_epi64(acc, 1));
+  return sum + byte_sum_scalar(data + i, size - i);
+}
+
+TX_TARGET_AVX2 uint64_t byte_sum_avx2(const std::byte* data,
+                                      size_t size) noexcept {
+  const __m256i zero = _mm256_setzero_si256();
+  __m256i acc = zero;
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+    acc = _mm256_add_epi64(acc, _mm256_sad_epu8(v, zero));
+  }
+  const __m128i half = _mm_add_epi64(_mm256_castsi256_si128(acc),
+                                     _mm256_extracti128_si256(acc, 1));
+  const auto sum = static_cast<uint64_t>(_mm_cvtsi128_si64(half)) +
+                   static_cast<uint64_t>(_mm_extract_epi64(half, 1));
+  return sum + byte_sum_sse42(data + i, size - i);
+}
+
+TX_TARGET_AVX512 uint64_t byte_sum_avx512(const std::byte* data,
+                                          size_t size) noexcept {
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i acc = zero;
+  for (size_t i = 0; i < size; i += 64) {
+    const size_t remain = size - i;
+    const __mmask64 valid =
+        remain >= 64 ? ~__mmask64{0} : (__mmask64{1} << remain) - 1;
+    const __m512i v = _mm512_maskz_loadu_epi8(valid, data + i);
+    acc = _mm512_add_epi64(acc, _mm512_sad_epu8(v, zero));
+  }
+  // 不用 _mm512_reduce_add_epi64 (GCC 12 的實作會觸發 -Wuninitialized)
+  alignas(64) uint64_t lanes[8];
+  _mm512_store_si512(lanes, acc);
+  uint64_t sum = 0;
+  for (uint64_t lane : lanes) sum += lane;
+  return sum;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// byteswap32
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void byteswap32_scalar(const uint32_t* in, uint32_t* out,
+                       size_t count) noexcept {
+  for (size_t i = 0; i < count; ++i) {
+    out[i] = std::byteswap(in[i]);
+  }
+}
+
+TX_TARGET_SSE42 void byteswap32_sse42(const uint32_t* in, uint32_t* out,
+                                      size_t count) noexcept {
+  const __m128i shuffle =
+      _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                     _mm_shuffle_epi8(v, shuffle));
+  }
+  byteswap32_scalar(in + i, out + i, count - i);
+}
+
+TX_TARGET_AVX2 void byteswap32_avx2(const uint32_t* in, uint32_t* out,
+                                    size_t count) noexcept {
+  const __m256i shuffle = _mm256_setr_epi8(
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,  //
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256i v =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_shuffle_epi8(v, shuffle));
+  }
+  byteswap32_sse42(in + i, out + i, count - i);
+}
+
+TX_TARGET_AVX512 void byteswap32_avx512(const uint32_t* in, uint32_t* out,
+                                        size_t count) noexcept {
+  alignas(64) static constexpr uint8_t kShuffle[64] = {
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,  //
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,  //
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,  //
+      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12};
+  const __m512i shuffle = _mm512_load_si512(kShuffle);
+  for (size_t i = 0; i < count; i += 16) {
+    const size_t remain = count - i;
+    const __mmask16 valid =
+        remain >= 16 ? __mmask16{0xFFFF}
+                     : static_cast<__mmask16>((1U << remain) - 1);
+    const __m512i v = _mm512_maskz_loadu_epi32(valid, in + i);
+    _mm512_mask_storeu_epi32(out + i, valid, _mm512_shuffle_epi8(v, shuffle));
+  }
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// Dispatch Objects
+// ----------------------------------------------------------------------------
+
+namespace kernels {
+
+constinit Dispatch<size_t(const std::byte*, size_t, std::byte)> find_byte{
+    {.scalar = find_byte_scalar,
+     .sse42 = find_byte_sse42,
+     .avx2 = find_byte_avx2,
+     .avx512 = find_byte_avx512}};
+
+constinit Dispatch<uint64_t(const std::byte*, size_t)> byte_sum{
+    {.scalar = byte_sum_scalar,
+     .sse42 = byte_sum_sse42,
+     .avx2 = byte_sum_avx2,
+     .avx512 = byte_sum_avx512}};
+
+constinit Dispatch<void(const uint32_t*, uint32_t*, size_t)> byteswap32{
+    {.scalar = byteswap32_scalar,
+     .sse42 = byteswap32_sse42,
+     .avx2 = byteswap32_avx2,
+     .avx512 = byteswap32_avx512}};
+
+}  // namespace kernels
+
+void resolve_all(Isa max) noexcept {
+  kernels::find_byte.resolve(max);
+  kernels::byte_sum.resolve(max);
+  kernels::byteswap32.resolve(max);
+}
+
+namespace {
+
+// 啟動時換成最佳實作 (在此之前的呼叫使用 scalar 版本，結果相同)
+[[maybe_unused]] const bool kResolved = (resolve_all(active_isa()), true);
+
+}  // namespace
+
+}  // namespace tx::simd
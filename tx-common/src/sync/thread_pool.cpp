@@ -0,0 +1,284 @@
+#include "tx/sync/thread_pool.hpp"
+
+#include <immintrin.h>
+
+#include <system_error>
+#include <utility>
+
+#include "tx/error.hpp"
+#include "tx/sys/cpu_affinity.hpp"
+
+namespace tx::sync {
+
+/// @brief worker 私有狀態
+struct alignas(64) ThreadPool::Worker {
+  ChaseLevDeque<TaskNode*, kDequeCapacity> deque;
+  TaskNode* free_list{nullptr};  ///< 本地 free-list (只有自己存取)
+  size_t free_count{0};
+};
+
+namespace {
+
+/// @brief 每次向共用池補充/歸還的 node 數
+constexpr size_t kFreeBatch = 64;
+/// @brief 共用池不足時一次配置的 node 數
+constexpr size_t kSlabSize = 256;
+/// @brief 進入睡眠前的空轉次數
+constexpr int kSpinLimit = 128;
+
+struct WorkerContext {
+  const ThreadPool* pool{nullptr};
+  int index{-1};
+};
+
+thread_local WorkerContext tls_worker{};
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// Factory Methods
+// ----------------------------------------------------------------------------
+
+Result<std::unique_ptr<ThreadPool>> ThreadPool::create(
+    std::vector<size_t> cpus) {
+  if (cpus.empty()) {
+    return tx::fail(std::errc::invalid_argument, "Empty CPU list");
+  }
+  for (size_t cpu : cpus) {
+    if (!sys::CPUAffinity::is_valid_cpu(cpu)) {
+      return tx::fail(std::errc::invalid_argument, "Invalid CPU id");
+    }
+  }
+
+  return std::unique_ptr<ThreadPool>(new ThreadPool(std::move(cpus)));
+}
+
+ThreadPool::ThreadPool(std::vector<size_t> cpus) noexcept
+    : cpus_(std::move(cpus)) {
+  workers_.reserve(cpus_.size());
+  for (size_t i = 0; i < cpus_.size(); ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+
+  threads_.reserve(cpus_.size());
+  for (size_t i = 0; i < cpus_.size(); ++i) {
+    threads_.emplace_back([this, i] { worker_loop(i); });
+  }
+}
+
+// ----------------------------------------------------------------------------
+// RAII
+// ----------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool() noexcept {
+  wait_idle();
+  {
+    std::lock_guard lock(idle_mutex_);
+    stop_ = true;
+  }
+  idle_cv_.notify_all();
+
+  for (auto& t : threads_) {
+    t.join();
+  }
+  // TaskNode 記憶體由 slabs_ 統一釋放
+}
+
+// ----------------------------------------------------------------------------
+// 操作
+// ----------------------------------------------------------------------------
+
+void ThreadPool::wait_idle() noexcept {
+  std::unique_lock lock(idle_mutex_);
+  done_cv_.wait(lock, [this] {
+    return pending_.load(std::memory_order_acquire) == 0;
+  });
+}
+
+int ThreadPool::current_worker() noexcept { return tls_worker.index; }
+
+// ----------------------------------------------------------------------------
+// TaskNode 物件池
+// ----------------------------------------------------------------------------
+
+ThreadPool::TaskNode* ThreadPool::allocate_node() noexcept {
+  Worker* w = tls_worker.pool == this
+                  ? workers_[static_cast<size_t>(tls_worker.index)].get()
+                  : nullptr;
+
+  if (w != nullptr && w->free_list != nullptr) [[likely]] {
+    TaskNode* node = w->free_list;
+    w->free_list = node->next;
+    --w->free_count;
+    return node;
+  }
+
+  std::lock_guard lock(free_mutex_);
+  if (free_list_ == nullptr) {
+    auto slab = std::make_unique<TaskNode[]>(kSlabSize);
+    for (size_t i = 0; i < kSlabSize; ++i) {
+      slab[i].next = free_list_;
+      free_list_ = &slab[i];
+    }
+    slabs_.push_back(std::move(slab));
+  }
+
+  TaskNode* node = free_list_;
+  free_list_ = node->next;
+
+  // worker 順便批次搬一些到本地，減少之後的鎖競爭
+  if (w != nullptr) {
+    while (free_list_ != nullptr && w->free_count < kFreeBatch) {
+      TaskNode* extra = free_list_;
+      free_list_ = extra->next;
+      extra->next = w->free_list;
+      w->free_list = extra;
+      ++w->free_count;
+    }
+  }
+  return node;
+}
+
+void ThreadPool::release_node(TaskNode* node) noexcept {
+  Worker* w = tls_worker.pool == this
+                  ? workers_[static_cast<size_t>(tls_worker.index)].get()
+                  : nullptr;
+
+  if (w != nullptr) [[likely]] {
+    node->next = w->free_list;
+    w->free_list = node;
+    if (++w->free_count < 2 * kFreeBatch) {
+      return;
+    }
+
+    // 本地累積過多 (生產者與消費者不同執行緒)，歸還一批到共用池
+    std::lock_guard lock(free_mutex_);
+    for (size_t i = 0; i < kFreeBatch; ++i) {
+      TaskNode* n = w->free_list;
+      w->free_list = n->next;
+      n->next = free_list_;
+      free_list_ = n;
+    }
+    w->free_count -= kFreeBatch;
+    return;
+  }
+
+  std::lock_guard lock(free_mutex_);
+  node->next = free_list_;
+  free_list_ = node;
+}
+
+// ----------------------------------------------------------------------------
+// 排程
+// ----------------------------------------------------------------------------
+
+void ThreadPool::push_node(TaskNode* node) noexcept {
+  // 先遞增再放入: 醒來的 worker 最多空轉一下，不會錯過工作
+  queued_.fetch_add(1, std::memory_order_seq_cst);
+
+  bool pushed = false;
+  if (tls_worker.pool == this) {
+    pushed = workers_[static_cast<size_t>(tls_worker.index)]->deque.push(node);
+  }
+  if (!pushed) {
+    std::lock_guard lock(inject_mutex_);
+    inject_.push_back(node);
+    inject_size_.fetch_add(1, std::memory_order_release);
+  }
+
+  if (sleepers_.load(std::memory_order_seq_cst) > 0) {
+    { std::lock_guard lock(idle_mutex_); }
+    idle_cv_.notify_one();
+  }
+}
+
+ThreadPool::TaskNode* ThreadPool::find_task(int self) noexcept {
+  // 1. 自己的 deque
+  if (self >= 0) {
+    if (auto node = workers_[static_cast<size_t>(self)]->deque.pop()) {
+      return *node;
+    }
+  }
+
+  // 2. inject queue
+  if (inject_size_.load(std::memory_order_acquire) > 0) {
+    std::lock_guard lock(inject_mutex_);
+    if (!inject_.empty()) {
+      TaskNode* node = inject_.front();
+      inject_.pop_front();
+      inject_size_.fetch_sub(1, std::memory_order_relaxed);
+      return node;
+    }
+  }
+
+  // 3. 偷取其他 worker
+  const size_t n = workers_.size();
+  const size_t start = self >= 0 ? static_cast<size_t>(self) + 1 : 0;
+  for (size_t k = 0; k < n; ++k) {
+    size_t victim = (start + k) % n;
+    if (static_cast<int>(victim) == self) continue;
+    if (auto node = workers_[victim]->deque.steal()) {
+      steals_.fetch_add(1, std::memory_order_relaxed);
+      return *node;
+    }
+  }
+  return nullptr;
+}
+
+void ThreadPool::execute(TaskNode* node) noexcept {
+  queued_.fetch_sub(1, std::memory_order_relaxed);
+  node->invoke(node);
+  release_node(node);
+
+  if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    std::lock_guard lock(idle_mutex_);
+    done_cv_.notify_all();
+  }
+}
+
+void ThreadPool::help_until_zero(const std::atomic<size_t>& counter) noexcept {
+  const int self = tls_worker.pool == this ? tls_worker.index : -1;
+  while (counter.load(std::memory_order_acquire) != 0) {
+    if (TaskNode* node = find_task(self)) {
+      execute(node);
+    } else {
+      _mm_pause();
+    }
+  }
+}
+
+void ThreadPool::worker_loop(size_t index) noexcept {
+  const int self = static_cast<int>(index);
+  tls_worker = WorkerContext{.pool = this, .index = self};
+
+  if (!sys::CPUAffinity::pin_to_cpu(cpus_[index])) {
+    pin_failures_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  int spins = 0;
+  while (true) {
+    if (TaskNode* node = find_task(self)) {
+      execute(node);
+      spins = 0;
+      continue;
+    }
+
+    if (++spins < kSpinLimit) {
+      _mm_pause();
+      continue;
+    }
+
+    std::unique_lock lock(idle_mutex_);
+    sleepers_.fetch_add(1, std::memory_order_seq_cst);
+    idle_cv_.wait(lock, [this] {
+      return stop_ || queued_.load(std::memory_order_seq_cst) > 0;
+    });
+    sleepers_.fetch_sub(1, std::memory_order_relaxed);
+    if (stop_ && queued_.load(std::memory_order_relaxed) <= 0) {
+      return;
+    }
+    spins = 0;
+  }
+}
+
+}  // namespace tx::sync
@@ -64,13 +64,12 @@ std::vector<size_t> parse_cpu_range(std::string_view range_str) {
   return cpus;
 }
 
-Result<std::vector<size_t>> read_available_cpus_from_sysfs() {
-  std::vector<std::byte> bytes =
-      TRY(io::File::open("/sys/devices/system/cpu/online", O_RDONLY)
-              .and_then([](io::File f) {
-                return io::BufReader::from_file(std::move(f));
-              })
-              .and_then([](io::BufReader r) { return r.read_to_end(); }));
+/// @brief 讀取 sysfs 的 CPU 列表檔案 (e.g. online、isolated)
+Result<std::vector<size_t>> read_cpu_list_from_sysfs(const char* path) {
+  // libstdc++ 12 的 std::expected 尚無 and_then()，逐步以 TRY 展開
+  io::File file = TRY(io::File::open(path, O_RDONLY));
+  io::BufReader reader = TRY(io::BufReader::from_file(std::move(file)));
+  std::vector<std::byte> bytes = TRY(reader.read_to_end());
 
   if (bytes.empty()) return {};
 
@@ -178,7 +177,7 @@ size_t CPUAffinity::get_cpu_count() noexcept {
 
 std::vector<size_t> CPUAffinity::get_available_cpus() noexcept {
   // 嘗試從 sysfs 讀取
-  auto cpus = read_available_cpus_from_sysfs();
+  auto cpus = read_cpu_list_from_sysfs("/sys/devices/system/cpu/online");
 
   if (cpus && !cpus->empty()) {
     return std::move(*cpus);
@@ -194,6 +193,28 @@ std::vector<size_t> CPUAffinity::get_available_cpus() noexcept {
   return res;
 }
 
+std::vector<size_t> CPUAffinity::get_isolated_cpus() noexcept {
+  auto cpus = read_cpu_list_from_sysfs("/sys/devices/system/cpu/isolated");
+  return cpus ? std::move(*cpus) : std::vector<size_t>{};
+}
+
+std::vector<size_t> CPUAffinity::get_housekeeping_cpus() noexcept {
+  std::vector<size_t> online = get_available_cpus();
+  std::vector<size_t> isolated = get_isolated_cpus();
+  std::vector<size_t> res = exclude_cpus(online, isolated);
+
+  // 全部被隔離時沒有背景核心可用，退回 online 列表
+  return res.empty() ? online : res;
+}
+
+std::vector<size_t> CPUAffinity::exclude_cpus(
+    std::vector<size_t> cpus, std::span<const size_t> excluded) noexcept {
+  std::erase_if(cpus, [excluded](size_t cpu) {
+    return std::find(excluded.begin(), excluded.end(), cpu) != excluded.end();
+  });
+  return cpus;
+}
+
 // ----------------------------------------------------------------------------
 // 驗證
 // ----------------------------------------------------------------------------
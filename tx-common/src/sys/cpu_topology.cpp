@@ -0,0 +1,127 @@
+#include "tx/sys/cpu_topology.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#include "tx/io/file.hpp"
+#include "tx/sys/cpu_affinity.hpp"
+
+namespace tx::sys {
+
+// ----------------------------------------------------------------------------
+// Helper Functions
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// @brief 讀取 sysfs 中只有一個整數的檔案 (e.g. ".../core_id")
+std::optional<int> read_int(const std::string& path) {
+  auto file = io::File::open(path, O_RDONLY);
+  if (!file) return std::nullopt;
+
+  std::array<std::byte, 32> buf{};
+  auto n = file->read(buf);
+  if (!n || *n == 0) return std::nullopt;
+
+  const auto* begin = reinterpret_cast<const char*>(buf.data());
+  int value = 0;
+  auto res = std::from_chars(begin, begin + *n, value);
+  if (res.ec != std::errc{}) return std::nullopt;
+  return value;
+}
+
+/// @brief 由 /sys/devices/system/cpu/cpuN/nodeK 連結取得 NUMA node
+std::optional<int> read_cpu_node(size_t cpu) {
+  const std::string dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+  DIR* d = ::opendir(dir.c_str());
+  if (d == nullptr) return std::nullopt;
+
+  std::optional<int> node;
+  while (const dirent* entry = ::readdir(d)) {
+    if (std::strncmp(entry->d_name, "node", 4) != 0) continue;
+    const char* digits = entry->d_name + 4;
+    int value = 0;
+    auto res = std::from_chars(digits, digits + std::strlen(digits), value);
+    if (res.ec == std::errc{} && res.ptr != digits) {
+      node = value;
+      break;
+    }
+  }
+  ::closedir(d);
+  return node;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// 查詢
+// ----------------------------------------------------------------------------
+
+std::vector<CpuInfo> CpuTopology::detect() noexcept {
+  std::vector<CpuInfo> result;
+  for (size_t cpu : CPUAffinity::get_available_cpus()) {
+    const std::string base =
+        "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+    result.push_back(CpuInfo{
+        .cpu = cpu,
+        .package = read_int(base + "physical_package_id").value_or(0),
+        .core = read_int(base + "core_id").value_or(static_cast<int>(cpu)),
+        .node = read_cpu_node(cpu).value_or(0)});
+  }
+  return result;
+}
+
+int CpuTopology::interface_node(std::string_view interface) noexcept {
+  const std::string path =
+      "/sys/class/net/" + std::string(interface) + "/device/numa_node";
+  return read_int(path).value_or(-1);
+}
+
+// ----------------------------------------------------------------------------
+// 配置
+// ----------------------------------------------------------------------------
+
+std::vector<size_t> CpuTopology::select(std::span<const CpuInfo> cpus,
+                                        size_t count, int node) noexcept {
+  std::vector<CpuInfo> candidates(cpus.begin(), cpus.end());
+
+  // 同一實體核心的 sibling 中，編號最小者為 primary
+  std::vector<bool> primary(candidates.size(), true);
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    for (size_t j = 0; j < candidates.size(); ++j) {
+      if (candidates[j].package == candidates[i].package &&
+          candidates[j].core == candidates[i].core &&
+          candidates[j].cpu < candidates[i].cpu) {
+        primary[i] = false;
+        break;
+      }
+    }
+  }
+
+  auto rank = [&](size_t i) {
+    const CpuInfo& c = candidates[i];
+    const bool off_node = node >= 0 && c.node != node;
+    return std::array<size_t, 4>{off_node ? 1U : 0U, primary[i] ? 0U : 1U,
+                                 c.cpu == 0 ? 1U : 0U, c.cpu};
+  };
+
+  std::vector<size_t> order(candidates.size());
+  for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+  std::sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return rank(a) < rank(b); });
+
+  std::vector<size_t> result;
+  for (size_t i = 0; i < order.size() && result.size() < count; ++i) {
+    result.push_back(candidates[order[i]].cpu);
+  }
+  return result;
+}
+
+}  // namespace tx::sys
@@ -0,0 +1,177 @@
+#include "tx/backtest/backtest_runner.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "../io/test_util.hpp"
+#include "../net/taifex/test_util.hpp"
+#include "tx/feed/capture.hpp"
+#include "tx/strategy/strategy_host.hpp"
+#include "tx/sys/cpu_affinity.hpp"
+
+namespace tx::backtest::test {
+
+using net::taifex::test::make_r02;
+using net::taifex::test::PacketBuilder;
+
+// ----------------------------------------------------------------------------
+// 測試策略: 價格低於門檻買進、高於門檻賣出 (最多 1 口部位)
+// ----------------------------------------------------------------------------
+
+struct Params {
+  int32_t threshold;
+};
+
+struct NoGateway {};
+
+class ThresholdStrategy
+    : public strategy::StrategyHost<ThresholdStrategy, feed::CaptureFeed,
+                                    NoGateway, sys::SimulatedClock, 4, 16> {
+ public:
+  ThresholdStrategy(feed::CaptureFeed feed, int32_t threshold)
+      : StrategyHost(std::move(feed), NoGateway{}), threshold_(threshold) {}
+
+  BacktestStats stats;
+
+  void on_trade(market::InstrumentId,
+                const net::taifex::ParsedR02Trade& trade) {
+    ++stats.packets;
+    auto price = core::Price::from_ticks(trade.match_price);
+    auto one = core::Quantity::from_value(1);
+    if (trade.match_price < threshold_ && stats.position <= 0) {
+      stats.on_fill(core::Side::Buy, price, one);
+    } else if (trade.match_price > threshold_ && stats.position >= 0) {
+      stats.on_fill(core::Side::Sell, price, one);
+    }
+    last_ = price;
+  }
+
+  core::Price last() const { return last_; }
+
+ private:
+  int32_t threshold_;
+  core::Price last_ = core::Price::from_ticks(0);
+};
+
+BacktestStats run_job(const BacktestJob<Params>& job) {
+  auto feed = feed::CaptureFeed::from(job.capture);
+  EXPECT_TRUE(feed);
+  auto strategy =
+      std::make_unique<ThresholdStrategy>(*feed, job.params->threshold);
+  EXPECT_TRUE(strategy->subscribe("TXFC6"));
+  EXPECT_TRUE(strategy->run());
+  strategy->stats.mark_to_market(strategy->last());
+  return strategy->stats;
+}
+
+/// @brief 寫入一天的擷取檔 (價格依 seed 擺盪)
+void write_day(const std::string& path, uint32_t seed) {
+  auto writer = feed::CaptureWriter::create(path);
+  ASSERT_TRUE(writer);
+  for (uint32_t i = 0; i < 500; ++i) {
+    auto offset = static_cast<int32_t>((i * 7 + seed) % 41);
+    int32_t price = 19980 + offset;
+    auto packet = PacketBuilder(i + 1).add(make_r02("TXFC6", price, 1)).build();
+    ASSERT_TRUE(writer->append(uint64_t{i} * 1000, packet));
+  }
+  ASSERT_TRUE(writer->flush());
+}
+
+// ----------------------------------------------------------------------------
+// 測試
+// ----------------------------------------------------------------------------
+
+TEST(CaptureFeedTest, RoundTripsPacketsAndTimestamps) {
+  io::test::TempFile tmp;
+  ASSERT_TRUE(tmp.is_valid());
+  {
+    auto writer = feed::CaptureWriter::create(tmp.path());
+    ASSERT_TRUE(writer);
+    std::vector<std::byte> a{std::byte{1}, std::byte{2}};
+    std::vector<std::byte> b{std::byte{3}};
+    ASSERT_TRUE(writer->append(100, a));
+    ASSERT_TRUE(writer->append(200, b, 7));
+  }
+
+  auto file = io::File::open(tmp.path(), O_RDONLY);
+  ASSERT_TRUE(file);
+  auto mapped = io::MappedFile::from_file(std::move(*file));
+  ASSERT_TRUE(mapped);
+
+  auto feed = feed::CaptureFeed::from(mapped->data());
+  ASSERT_TRUE(feed);
+
+  std::vector<std::pair<size_t, uint64_t>> seen;
+  auto n = feed->poll([&](std::span<const std::byte> p, uint64_t ts) {
+    seen.emplace_back(p.size(), ts);
+  });
+  ASSERT_TRUE(n);
+  EXPECT_EQ(*n, 2U);
+  EXPECT_TRUE(feed->exhausted());
+  EXPECT_EQ(seen, (std::vector<std::pair<size_t, uint64_t>>{{2, 100},
+                                                            {1, 200}}));
+}
+
+TEST(CaptureFeedTest, RejectsBadMagic) {
+  std::vector<std::byte> junk(32, std::byte{0});
+  EXPECT_FALSE(feed::CaptureFeed::from(junk));
+}
+
+TEST(BacktestRunnerTest, ParallelSweepMatchesSerialRun) {
+  io::test::TempFile day1;
+  io::test::TempFile day2;
+  ASSERT_TRUE(day1.is_valid() && day2.is_valid());
+  write_day(day1.path(), 3);
+  write_day(day2.path(), 17);
+
+  auto cpus = sys::CPUAffinity::get_housekeeping_cpus();
+  cpus.resize(std::min<size_t>(cpus.size(), 4));
+  auto pool = sync::ThreadPool::create(cpus);
+  ASSERT_TRUE(pool);
+
+  BacktestRunner<Params> runner(**pool);
+  ASSERT_TRUE(runner.add_capture(day1.path()));
+  ASSERT_TRUE(runner.add_capture(day2.path()));
+  for (int32_t t = 19990; t <= 20010; t += 2) {
+    runner.add_params({.threshold = t});
+  }
+  ASSERT_EQ(runner.job_count(), 22U);
+
+  auto report = runner.run(run_job);
+  ASSERT_EQ(report.jobs.size(), 22U);
+
+  // 以序列方式重跑並比對
+  BacktestStats serial_total;
+  auto file1 = io::File::open(day1.path(), O_RDONLY);
+  auto file2 = io::File::open(day2.path(), O_RDONLY);
+  ASSERT_TRUE(file1 && file2);
+  auto map1 = io::MappedFile::from_file(std::move(*file1));
+  auto map2 = io::MappedFile::from_file(std::move(*file2));
+  ASSERT_TRUE(map1 && map2);
+
+  std::vector<Params> params;
+  for (int32_t t = 19990; t <= 20010; t += 2) params.push_back({t});
+
+  size_t index = 0;
+  for (const auto* map : {&*map1, &*map2}) {
+    for (const auto& p : params) {
+      BacktestJob<Params> job{.index = index,
+                              .capture_index = 0,
+                              .capture = map->data(),
+                              .params = &p};
+      auto stats = run_job(job);
+      EXPECT_EQ(stats.pnl_ticks, report.jobs[index].pnl_ticks) << index;
+      EXPECT_EQ(stats.fills, report.jobs[index].fills) << index;
+      serial_total.merge(stats);
+      ++index;
+    }
+  }
+
+  EXPECT_EQ(report.total.packets, 22U * 500U);
+  EXPECT_EQ(report.total.fills, serial_total.fills);
+  EXPECT_EQ(report.total.pnl_ticks, serial_total.pnl_ticks);
+  EXPECT_GT(report.total.fills, 0U);
+}
+
+}  // namespace tx::backtest::test
@@ -0,0 +1,261 @@
+#include "tx/coro/task.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+#include "tx/coro/frame_pool.hpp"
+#include "tx/coro/io.hpp"
+#include "tx/io/reactor.hpp"
+#include "tx/io/socket.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/tcp_socket.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::coro::test {
+
+// =============================
+// Task 基本語意
+// =============================
+
+Task<int> add(int a, int b) { co_return a + b; }
+
+Task<int> add_three(int a, int b, int c) {
+  int ab = co_await add(a, b);
+  int abc = co_await add(ab, c);
+  co_return abc;
+}
+
+TEST(TaskTest, LazyStart) {
+  bool ran = false;
+  auto task = [](bool& flag) -> Task<> {
+    flag = true;
+    co_return;
+  }(ran);
+
+  EXPECT_FALSE(ran);
+  EXPECT_FALSE(task.done());
+  task.start();
+  EXPECT_TRUE(ran);
+  EXPECT_TRUE(task.done());
+}
+
+TEST(TaskTest, NestedAwaitReturnsValue) {
+  auto task = add_three(1, 2, 3);
+  task.start();
+  ASSERT_TRUE(task.done());
+  EXPECT_EQ(task.result(), 6);
+}
+
+TEST(TaskTest, FramesReturnToPool) {
+  const size_t baseline = FramePool::outstanding();
+  {
+    auto task = add_three(4, 5, 6);
+    EXPECT_EQ(FramePool::outstanding(), baseline + 1);
+    task.start();
+    EXPECT_EQ(task.result(), 15);
+  }
+  EXPECT_EQ(FramePool::outstanding(), baseline);
+
+  // 重複建立不會增加保留的記憶體
+  const size_t reserved = FramePool::reserved_bytes();
+  for (int i = 0; i < 1000; ++i) {
+    auto task = add_three(i, i, i);
+    task.start();
+    EXPECT_EQ(task.result(), 3 * i);
+  }
+  EXPECT_EQ(FramePool::reserved_bytes(), reserved);
+  EXPECT_EQ(FramePool::outstanding(), baseline);
+}
+
+TEST(TaskTest, SpawnDetachedFreesFrame) {
+  const size_t baseline = FramePool::outstanding();
+  int value = 0;
+  spawn([](int& out) -> Task<> {
+    out = co_await add(20, 22);
+  }(value));
+  EXPECT_EQ(value, 42);
+  EXPECT_EQ(FramePool::outstanding(), baseline);
+}
+
+// =============================
+// Reactor 上的 awaiter
+// =============================
+
+class CoroIoTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    sys::TSCTimer::calibrate(std::chrono::milliseconds(10));
+  }
+
+  io::Reactor reactor_ = io::Reactor::create().value();
+
+  /// @brief 驅動 reactor 直到 task 完成或逾時
+  template <typename T>
+  bool run_until_done(Task<T>& task, int max_rounds = 5000) {
+    for (int i = 0; i < max_rounds && !task.done(); ++i) {
+      EXPECT_TRUE(reactor_.poll(1).has_value());
+    }
+    return task.done();
+  }
+};
+
+TEST_F(CoroIoTest, SleepUntilResumesAfterDeadline) {
+  const uint64_t deadline =
+      sys::TSCTimer::now() + sys::TSCTimer::ns_to_cycles(2'000'000);
+
+  auto task = [](io::Reactor& reactor, uint64_t when) -> Task<uint64_t> {
+    auto r = co_await sleep_until(reactor, when);
+    EXPECT_TRUE(r.has_value());
+    co_return sys::TSCTimer::now();
+  }(reactor_, deadline);
+
+  task.start();
+  EXPECT_FALSE(task.done());
+  EXPECT_TRUE(reactor_.has_pending());
+
+  ASSERT_TRUE(run_until_done(task));
+  EXPECT_GE(task.result(), deadline);
+  EXPECT_FALSE(reactor_.has_pending());
+}
+
+TEST_F(CoroIoTest, PollSleepsUntilNearestTimer) {
+  const uint64_t deadline =
+      sys::TSCTimer::now() + sys::TSCTimer::ns_to_cycles(5'000'000);
+
+  auto task = [](io::Reactor& reactor, uint64_t when) -> Task<> {
+    auto r = co_await sleep_until(reactor, when);
+    EXPECT_TRUE(r.has_value());
+  }(reactor_, deadline);
+  task.start();
+
+  // 逾時依 timer 到期時間計算，不會每 1ms 醒來一次
+  int rounds = 0;
+  while (!task.done() && rounds < 100) {
+    ASSERT_TRUE(reactor_.poll(1000).has_value());
+    ++rounds;
+  }
+  EXPECT_TRUE(task.done());
+  EXPECT_GE(sys::TSCTimer::now(), deadline);
+  EXPECT_LE(rounds, 2);
+}
+
+TEST_F(CoroIoTest, SleepUntilPastDeadlineDoesNotSuspend) {
+  auto task = [](io::Reactor& reactor) -> Task<bool> {
+    auto r = co_await sleep_until(reactor, 1);
+    co_return r.has_value();
+  }(reactor_);
+
+  task.start();
+  ASSERT_TRUE(task.done());
+  EXPECT_TRUE(task.result());
+}
+
+TEST_F(CoroIoTest, TcpEchoRoundTrip) {
+  auto addr = io::SocketAddress::from_ipv4("127.0.0.1", 0).value();
+  auto server = io::TcpSocket::serve(addr).value();
+  auto server_addr = server.local_address().value();
+
+  auto client = io::Socket::create_tcp().value();
+  ASSERT_TRUE(client.set_nonblocking(true).has_value());
+
+  auto task = [](io::Reactor& reactor, io::Socket& sock,
+                 const io::SocketAddress& remote) -> Task<Result<size_t>> {
+    auto connected = co_await async_connect(reactor, sock, remote);
+    if (!connected) co_return std::unexpected(connected.error());
+
+    const char ping[] = "ping";
+    auto sent = co_await async_write_all(
+        reactor, sock.fd(), std::as_bytes(std::span(ping, 4)));
+    if (!sent) co_return std::unexpected(sent.error());
+
+    std::array<std::byte, 16> buf{};
+    auto n = co_await async_read(reactor, sock.fd(), buf);
+    if (!n) co_return std::unexpected(n.error());
+    EXPECT_EQ(std::memcmp(buf.data(), "pong", 4), 0);
+    co_return *n;
+  }(reactor_, client, server_addr);
+
+  task.start();
+
+  // server 端以阻塞 I/O 回應
+  auto peer = server.accept().value();
+  std::array<std::byte, 16> buf{};
+  size_t got = 0;
+  while (got < 4) {
+    for (int i = 0; i < 10; ++i) (void)reactor_.poll(0);
+    auto n = peer.recv(std::span(buf).subspan(got));
+    ASSERT_TRUE(n.has_value());
+    ASSERT_GT(*n, 0u);
+    got += *n;
+  }
+  EXPECT_EQ(std::memcmp(buf.data(), "ping", 4), 0);
+
+  EXPECT_FALSE(task.done());  // 等待 server 回應
+  const char pong[] = "pong";
+  ASSERT_TRUE(peer.send(std::as_bytes(std::span(pong, 4))).has_value());
+
+  ASSERT_TRUE(run_until_done(task));
+  auto result = task.result();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, 4u);
+}
+
+TEST_F(CoroIoTest, ReadReturnsZeroOnPeerClose) {
+  auto addr = io::SocketAddress::from_ipv4("127.0.0.1", 0).value();
+  auto server = io::TcpSocket::serve(addr).value();
+  auto server_addr = server.local_address().value();
+
+  auto client = io::Socket::create_tcp().value();
+  ASSERT_TRUE(client.set_nonblocking(true).has_value());
+
+  auto task = [](io::Reactor& reactor, io::Socket& sock,
+                 const io::SocketAddress& remote) -> Task<Result<size_t>> {
+    auto connected = co_await async_connect(reactor, sock, remote);
+    if (!connected) co_return std::unexpected(connected.error());
+    std::array<std::byte, 16> buf{};
+    co_return co_await async_read(reactor, sock.fd(), buf);
+  }(reactor_, client, server_addr);
+
+  task.start();
+  {
+    auto peer = server.accept().value();
+    for (int i = 0; i < 10; ++i) (void)reactor_.poll(0);
+  }  // peer 關閉
+
+  ASSERT_TRUE(run_until_done(task));
+  auto result = task.result();
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(*result, 0u);
+}
+
+TEST_F(CoroIoTest, ConnectRefusedReportsError) {
+  // 先取得一個空閒 port 再關閉 listener
+  io::SocketAddress remote = [] {
+    auto addr = io::SocketAddress::from_ipv4("127.0.0.1", 0).value();
+    auto listener = io::TcpSocket::serve(addr).value();
+    return listener.local_address().value();
+  }();
+
+  auto client = io::Socket::create_tcp().value();
+  ASSERT_TRUE(client.set_nonblocking(true).has_value());
+
+  auto task = [](io::Reactor& reactor, io::Socket& sock,
+                 const io::SocketAddress& addr) -> Task<Result<>> {
+    co_return co_await async_connect(reactor, sock, addr);
+  }(reactor_, client, remote);
+
+  task.start();
+  ASSERT_TRUE(run_until_done(task));
+  auto result = task.result();
+  ASSERT_FALSE(result.has_value());
+  EXPECT_EQ(result.error().value(), ECONNREFUSED);
+}
+
+}  // namespace tx::coro::test
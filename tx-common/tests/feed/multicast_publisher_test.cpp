@@ -0,0 +1,191 @@
+#include "tx/feed/multicast_publisher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include "tx/io/socket_address.hpp"
+#include "tx/io/udp_socket.hpp"
+#include "tx/sys/clock.hpp"
+
+namespace tx::feed::test {
+
+using Publisher = MulticastPublisher<sys::SimulatedClock>;
+
+struct Tick {
+  uint32_t instrument;
+  int64_t price;
+  uint32_t qty;
+};
+
+class MulticastPublisherTest : public ::testing::Test {
+ protected:
+  io::UdpSocket receiver_ = io::UdpSocket::bind(
+                                io::SocketAddress::from_ipv4("127.0.0.1", 0)
+                                    .value())
+                                .value();
+  io::SocketAddress dest_ = receiver_.local_address().value();
+
+  void SetUp() override {
+    sys::SimulatedClock::set(0);
+    ASSERT_TRUE(receiver_.set_nonblocking(true).has_value());
+    ASSERT_TRUE(receiver_.set_recv_buffer_size(4 << 20).has_value());
+  }
+
+  /// @brief 收取目前所有 datagram
+  std::vector<std::vector<std::byte>> drain() {
+    std::vector<std::vector<std::byte>> out;
+    std::array<std::byte, 65536> buf;
+    while (true) {
+      auto n = receiver_.recvfrom(buf);
+      if (!n) {
+        EXPECT_TRUE(n.error().value() == EAGAIN ||
+                    n.error().value() == EWOULDBLOCK);
+        break;
+      }
+      out.emplace_back(buf.begin(), buf.begin() + static_cast<long>(*n));
+    }
+    return out;
+  }
+
+  static std::vector<Tick> decode(const std::vector<std::byte>& datagram) {
+    std::vector<Tick> ticks;
+    bool ok = for_each_event(datagram, [&](std::span<const std::byte> ev) {
+      EXPECT_EQ(ev.size(), sizeof(Tick));
+      Tick t;
+      std::memcpy(&t, ev.data(), sizeof(t));
+      ticks.push_back(t);
+    });
+    EXPECT_TRUE(ok);
+    return ticks;
+  }
+};
+
+TEST_F(MulticastPublisherTest, PacksEventsIntoOneDatagram) {
+  auto pub = Publisher::create(dest_).value();
+
+  for (uint32_t i = 0; i < 10; ++i) {
+    ASSERT_TRUE(pub.publish(Tick{i, 100 + i, 1}).has_value());
+  }
+  EXPECT_EQ(pub.pending_datagrams(), 1u);
+  EXPECT_TRUE(drain().empty());  // publish() 不送出
+
+  auto sent = pub.poll();  // linger = 0
+  ASSERT_TRUE(sent.has_value());
+  EXPECT_EQ(*sent, 1u);
+
+  auto datagrams = drain();
+  ASSERT_EQ(datagrams.size(), 1u);
+  auto ticks = decode(datagrams[0]);
+  ASSERT_EQ(ticks.size(), 10u);
+  for (uint32_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(ticks[i].instrument, i);
+    EXPECT_EQ(ticks[i].price, 100 + i);
+  }
+
+  EXPECT_EQ(pub.stats().events, 10u);
+  EXPECT_EQ(pub.stats().datagrams, 1u);
+  EXPECT_EQ(pub.stats().syscalls, 1u);
+}
+
+TEST_F(MulticastPublisherTest, SplitsAtDatagramSizeAndBatchesSyscall) {
+  // 每個 datagram 剛好容納 4 個事件
+  constexpr size_t kSize = sizeof(PublishHeader) + 4 * (2 + sizeof(Tick));
+  PublisherConfig config{.max_datagram_size = kSize};
+  auto pub = Publisher::create(dest_, config).value();
+
+  for (uint32_t i = 0; i < 20; ++i) {
+    ASSERT_TRUE(pub.publish(Tick{i, 0, 0}).has_value());
+  }
+  EXPECT_EQ(pub.pending_datagrams(), 5u);
+
+  ASSERT_EQ(pub.flush().value(), 5u);
+  EXPECT_EQ(pub.stats().syscalls, 1u);
+
+  auto datagrams = drain();
+  ASSERT_EQ(datagrams.size(), 5u);
+  uint32_t expected = 0;
+  for (size_t d = 0; d < datagrams.size(); ++d) {
+    PublishHeader hdr;
+    std::memcpy(&hdr, datagrams[d].data(), sizeof(hdr));
+    EXPECT_EQ(hdr.sequence, d);
+    EXPECT_EQ(hdr.count, 4u);
+    EXPECT_EQ(datagrams[d].size(), kSize);
+    for (const auto& t : decode(datagrams[d])) {
+      EXPECT_EQ(t.instrument, expected++);
+    }
+  }
+  EXPECT_EQ(expected, 20u);
+}
+
+TEST_F(MulticastPublisherTest, FullBatchFlushesFromPublish) {
+  PublisherConfig config{.max_datagram_size =
+                             sizeof(PublishHeader) + 2 + sizeof(Tick)};
+  auto pub = Publisher::create(dest_, config).value();
+
+  // 每個事件一個 datagram，第 kMaxBatch + 1 個事件觸發送出
+  for (uint32_t i = 0; i <= Publisher::kMaxBatch; ++i) {
+    ASSERT_TRUE(pub.publish(Tick{i, 0, 0}).has_value());
+  }
+  EXPECT_EQ(pub.stats().datagrams, Publisher::kMaxBatch);
+  EXPECT_EQ(pub.stats().syscalls, 1u);
+  EXPECT_EQ(pub.pending_datagrams(), 1u);
+
+  EXPECT_EQ(drain().size(), Publisher::kMaxBatch);
+}
+
+TEST_F(MulticastPublisherTest, LingerDelaysFlush) {
+  PublisherConfig config{.linger_us = 50};
+  auto pub = Publisher::create(dest_, config).value();
+
+  sys::SimulatedClock::set(1'000);
+  ASSERT_TRUE(pub.publish(Tick{1, 0, 0}).has_value());
+
+  sys::SimulatedClock::set(30'000);
+  ASSERT_TRUE(pub.publish(Tick{2, 0, 0}).has_value());
+  EXPECT_EQ(pub.poll().value(), 0u);  // 最舊事件僅 29us
+
+  sys::SimulatedClock::set(51'000);
+  EXPECT_EQ(pub.poll().value(), 1u);  // 最舊事件已 50us
+
+  auto datagrams = drain();
+  ASSERT_EQ(datagrams.size(), 1u);
+  EXPECT_EQ(decode(datagrams[0]).size(), 2u);
+  EXPECT_EQ(pub.poll().value(), 0u);
+}
+
+TEST_F(MulticastPublisherTest, RejectsOversizedEvent) {
+  PublisherConfig config{.max_datagram_size = 32};
+  auto pub = Publisher::create(dest_, config).value();
+
+  std::array<std::byte, 64> big{};
+  auto r = pub.publish(std::span<const std::byte>(big));
+  ASSERT_FALSE(r.has_value());
+  EXPECT_EQ(r.error(), std::errc::message_size);
+  EXPECT_EQ(pub.pending_datagrams(), 0u);
+}
+
+TEST_F(MulticastPublisherTest, DestructorFlushesPending) {
+  {
+    auto pub = Publisher::create(dest_).value();
+    ASSERT_TRUE(pub.publish(Tick{7, 0, 0}).has_value());
+  }
+  auto datagrams = drain();
+  ASSERT_EQ(datagrams.size(), 1u);
+  EXPECT_EQ(decode(datagrams[0])[0].instrument, 7u);
+}
+
+TEST(MulticastPublisherConfigTest, RejectsInvalidDatagramSize) {
+  auto dest = io::SocketAddress::from_ipv4("127.0.0.1", 9).value();
+  EXPECT_FALSE(Publisher::create(dest, {.max_datagram_size = 4}).has_value());
+  EXPECT_FALSE(
+      Publisher::create(dest, {.max_datagram_size = 70000}).has_value());
+}
+
+}  // namespace tx::feed::test
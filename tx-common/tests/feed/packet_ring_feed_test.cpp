@@ -0,0 +1,197 @@
+#include "tx/feed/packet_ring_feed.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/feed/feed.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/udp_socket.hpp"
+#include "tx/net/taifex/packet_iterator.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::feed::test {
+
+using net::taifex::test::make_r06;
+using net::taifex::test::PacketBuilder;
+
+class PacketRingFeedTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    sys::TSCTimer::calibrate(std::chrono::milliseconds(10));
+  }
+
+  io::UdpSocket receiver_ = io::UdpSocket::bind(
+                                io::SocketAddress::from_ipv4("127.0.0.1", 0)
+                                    .value())
+                                .value();
+  io::SocketAddress dest_ = receiver_.local_address().value();
+  io::UdpSocket sender_ = io::UdpSocket::create().value();
+
+  /// @brief 建立 ring，沒有 CAP_NET_RAW 時略過測試
+  std::optional<PacketRingFeed> make_ring(const io::SocketAddress& group) {
+    PacketRingConfig config{.interface = "lo",
+                            .group = group,
+                            .block_size = 1U << 16,
+                            .block_count = 8};
+    auto ring = PacketRingFeed::create(config);
+    if (!ring) {
+      EXPECT_TRUE(ring.error().value() == EPERM ||
+                  ring.error().value() == EACCES);
+      return std::nullopt;
+    }
+    return std::move(*ring);
+  }
+
+  struct Received {
+    std::vector<std::byte> payload;
+    uint64_t tsc;
+    uint64_t kernel_ns;
+  };
+
+  /// @brief poll 直到收到 n 個封包或逾時
+  static std::vector<Received> collect(PacketRingFeed& ring, size_t n) {
+    std::vector<Received> out;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (out.size() < n && std::chrono::steady_clock::now() < deadline) {
+      auto r = ring.poll([&](std::span<const std::byte> payload, uint64_t tsc,
+                             uint64_t kernel_ns) {
+        out.push_back({{payload.begin(), payload.end()}, tsc, kernel_ns});
+      });
+      EXPECT_TRUE(r.has_value());
+    }
+    return out;
+  }
+};
+
+TEST_F(PacketRingFeedTest, DeliversUdpPayloadToPacketIterator) {
+  auto ring = make_ring(dest_);
+  if (!ring) GTEST_SKIP() << "AF_PACKET requires CAP_NET_RAW";
+
+  auto packet = PacketBuilder(42, 3)
+                    .add(make_r06("TXFC6", {{17000, 1, 1}}, {{17001, 2, 1}},
+                                  17000, 1, 10))
+                    .build();
+  ASSERT_TRUE(sender_.sendto(packet, dest_).has_value());
+
+  auto got = collect(*ring, 1);
+  ASSERT_EQ(got.size(), 1u);
+  EXPECT_EQ(got[0].payload, packet);
+  EXPECT_GT(got[0].kernel_ns, 0u);
+
+  auto it = net::taifex::PacketIterator::from(got[0].payload);
+  ASSERT_TRUE(it.has_value());
+  EXPECT_EQ(it->header().msg_count, 1u);
+  auto msg = it->next();
+  ASSERT_TRUE(msg.has_value());
+  EXPECT_EQ(msg->msg_type, '6');
+}
+
+TEST_F(PacketRingFeedTest, FiltersOtherPorts) {
+  auto ring = make_ring(dest_);
+  if (!ring) GTEST_SKIP() << "AF_PACKET requires CAP_NET_RAW";
+
+  auto other = io::UdpSocket::bind(
+                   io::SocketAddress::from_ipv4("127.0.0.1", 0).value())
+                   .value();
+  auto other_addr = other.local_address().value();
+
+  const std::byte noise[4]{};
+  const std::byte wanted[3]{std::byte{1}, std::byte{2}, std::byte{3}};
+  ASSERT_TRUE(sender_.sendto(noise, other_addr).has_value());
+  ASSERT_TRUE(sender_.sendto(wanted, dest_).has_value());
+
+  auto got = collect(*ring, 1);
+  ASSERT_EQ(got.size(), 1u);
+  EXPECT_EQ(got[0].payload, std::vector<std::byte>(wanted, wanted + 3));
+  EXPECT_EQ(ring->stats().packets, 1u);
+}
+
+TEST_F(PacketRingFeedTest, SatisfiesPacketFeedWithTwoArgumentSink) {
+  static_assert(PacketFeed<PacketRingFeed>);
+
+  auto ring = make_ring(dest_);
+  if (!ring) GTEST_SKIP() << "AF_PACKET requires CAP_NET_RAW";
+
+  for (int i = 0; i < 10; ++i) {
+    const std::byte payload[1]{std::byte(i)};
+    ASSERT_TRUE(sender_.sendto(payload, dest_).has_value());
+  }
+
+  std::vector<int> seen;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (seen.size() < 10 && std::chrono::steady_clock::now() < deadline) {
+    ASSERT_TRUE(ring->poll([&](std::span<const std::byte> p, uint64_t) {
+                      seen.push_back(std::to_integer<int>(p[0]));
+                    })
+                    .has_value());
+  }
+  ASSERT_EQ(seen.size(), 10u);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(seen[static_cast<size_t>(i)], i);
+}
+
+/// @brief /proc/net/igmp 中 device 是否已加入 group
+bool igmp_joined(const std::string& device, const io::SocketAddress& group) {
+  char hex[9];
+  std::snprintf(hex, sizeof(hex), "%08X", group.ipv4_addr()->s_addr);
+
+  std::ifstream igmp("/proc/net/igmp");
+  std::string line;
+  std::string current;
+  while (std::getline(igmp, line)) {
+    if (line.empty()) continue;
+    if (line[0] != '\t') {
+      // "1\tlo        :     1      V3"
+      const auto tab = line.find('\t');
+      current = line.substr(tab + 1, line.find(' ', tab) - tab - 1);
+    } else if (current == device && line.find(hex) != std::string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST_F(PacketRingFeedTest, JoinsMulticastGroupForItsLifetime) {
+  const auto group = io::SocketAddress::from_ipv4("239.7.7.7", 30007).value();
+  ASSERT_FALSE(igmp_joined("lo", group));
+  {
+    auto ring = make_ring(group);
+    if (!ring) GTEST_SKIP() << "AF_PACKET requires CAP_NET_RAW";
+    EXPECT_TRUE(igmp_joined("lo", group));
+
+    PacketRingFeed moved = std::move(*ring);
+    ring.reset();
+    EXPECT_TRUE(igmp_joined("lo", group));
+  }
+  EXPECT_FALSE(igmp_joined("lo", group));
+
+  PacketRingConfig config{.interface = "lo",
+                          .group = group,
+                          .block_size = 1U << 16,
+                          .block_count = 8,
+                          .join_group = false};
+  auto unjoined = PacketRingFeed::create(config);
+  ASSERT_TRUE(unjoined.has_value());
+  EXPECT_FALSE(igmp_joined("lo", group));
+}
+
+TEST(PacketRingConfigTest, RejectsInvalidGeometry) {
+  PacketRingConfig config{.block_size = 1000};
+  auto ring = PacketRingFeed::create(config);
+  ASSERT_FALSE(ring.has_value());
+  EXPECT_EQ(ring.error(), std::errc::invalid_argument);
+}
+
+}  // namespace tx::feed::test
@@ -0,0 +1,428 @@
+#include "tx/feed/recovery.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/feed/memory_feed.hpp"
+#include "tx/feed/sharded_feed_handler.hpp"
+#include "tx/feed/snapshot_service.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::feed::test {
+
+using net::taifex::test::make_r02;
+using net::taifex::test::PacketBuilder;
+using Action = ChannelRecovery::Action;
+using State = ChannelRecovery::State;
+
+std::vector<std::byte> trade_packet(uint32_t seq, uint16_t channel = 1,
+                                    const char* prod = "TXFC6") {
+  return PacketBuilder(seq, channel)
+      .add(make_r02(prod, static_cast<int32_t>(seq), 1, seq))
+      .build();
+}
+
+/// @brief 套用快照並記錄重播的序號
+struct Replay {
+  bool snapshot_applied{false};
+  std::vector<uint32_t> replayed;
+
+  bool run(ChannelRecovery& recovery, uint32_t snapshot_seq) {
+    return recovery.on_snapshot(
+        snapshot_seq, [&] { snapshot_applied = true; },
+        [&](std::span<const std::byte> packet, uint64_t) {
+          auto it = net::taifex::PacketIterator::from(packet);
+          replayed.push_back(it->header().pkt_seq_num);
+        });
+  }
+};
+
+// ----------------------------------------------------------------------------
+// PacketBuffer
+// ----------------------------------------------------------------------------
+
+TEST(PacketBufferTest, OverwritesOldestWhenFull) {
+  PacketBuffer buffer(2, 64);
+  std::vector<std::byte> small(16, std::byte{0x42});
+
+  EXPECT_TRUE(buffer.push(1, 10, small));
+  EXPECT_TRUE(buffer.push(2, 20, small));
+  EXPECT_TRUE(buffer.push(3, 30, small));
+  EXPECT_EQ(buffer.size(), 2u);
+  EXPECT_EQ(buffer.overwritten(), 1u);
+  EXPECT_EQ(buffer.front().seq, 2u);
+  EXPECT_EQ(buffer.front().timestamp, 20u);
+  EXPECT_EQ(buffer.front().packet.size(), small.size());
+
+  // 超過槽位大小不加入
+  std::vector<std::byte> big(65);
+  EXPECT_FALSE(buffer.push(4, 40, big));
+  EXPECT_EQ(buffer.size(), 2u);
+}
+
+// ----------------------------------------------------------------------------
+// ChannelRecovery
+// ----------------------------------------------------------------------------
+
+TEST(ChannelRecoveryTest, StartOfDayGoesLive) {
+  ChannelRecovery recovery(8);
+  auto p = trade_packet(1);
+
+  EXPECT_EQ(recovery.on_packet(1, 0, p), Action::Apply);
+  EXPECT_EQ(recovery.state(), State::Live);
+  EXPECT_EQ(recovery.on_packet(2, 0, p), Action::Apply);
+  EXPECT_EQ(recovery.on_packet(2, 0, p), Action::Drop);
+  EXPECT_FALSE(recovery.wants_snapshot());
+}
+
+TEST(ChannelRecoveryTest, LateJoinBuffersUntilSnapshot) {
+  ChannelRecovery recovery(8);
+  std::vector<std::vector<std::byte>> pkts;
+  for (uint32_t seq = 0; seq <= 12; ++seq) pkts.push_back(trade_packet(seq));
+
+  // 盤中加入: 第一個封包為 10
+  EXPECT_EQ(recovery.on_packet(10, 0, pkts[10]), Action::Buffered);
+  EXPECT_EQ(recovery.on_packet(11, 0, pkts[11]), Action::Buffered);
+  EXPECT_EQ(recovery.on_packet(11, 0, pkts[11]), Action::Drop);  // B 線
+  EXPECT_EQ(recovery.state(), State::Recovering);
+  ASSERT_TRUE(recovery.wants_snapshot());
+  recovery.mark_requested();
+  EXPECT_FALSE(recovery.wants_snapshot());
+
+  // 快照涵蓋到 10：重播 11，之後 12 直接套用
+  Replay r;
+  EXPECT_TRUE(r.run(recovery, 10));
+  EXPECT_TRUE(r.snapshot_applied);
+  EXPECT_EQ(r.replayed, (std::vector<uint32_t>{11}));
+  EXPECT_EQ(recovery.state(), State::Live);
+  EXPECT_EQ(recovery.on_packet(12, 0, pkts[12]), Action::Apply);
+  EXPECT_EQ(recovery.stats().snapshots, 1u);
+  EXPECT_EQ(recovery.stats().replayed, 1u);
+}
+
+TEST(ChannelRecoveryTest, GapTriggersRecoveryAndSnapshotCoversBuffer) {
+  ChannelRecovery recovery(8);
+  std::vector<std::vector<std::byte>> pkts;
+  for (uint32_t seq = 0; seq <= 8; ++seq) pkts.push_back(trade_packet(seq));
+
+  EXPECT_EQ(recovery.on_packet(1, 0, pkts[1]), Action::Apply);
+  EXPECT_EQ(recovery.on_packet(2, 0, pkts[2]), Action::Apply);
+  // 3、4 遺失
+  EXPECT_EQ(recovery.on_packet(5, 0, pkts[5]), Action::Buffered);
+  EXPECT_EQ(recovery.on_packet(6, 0, pkts[6]), Action::Buffered);
+  EXPECT_EQ(recovery.stats().gaps, 2u);
+  recovery.mark_requested();
+
+  // 快照比暫存還新: 暫存全部略過，下一個預期為 8
+  Replay r;
+  EXPECT_TRUE(r.run(recovery, 7));
+  EXPECT_TRUE(r.replayed.empty());
+  EXPECT_EQ(recovery.state(), State::Live);
+  EXPECT_EQ(recovery.next_seq(), 8u);
+}
+
+TEST(ChannelRecoveryTest, RejectsSnapshotOlderThanBuffer) {
+  ChannelRecovery recovery(8);
+  auto p = trade_packet(1);
+
+  EXPECT_EQ(recovery.on_packet(1, 0, p), Action::Apply);
+  EXPECT_EQ(recovery.on_packet(5, 0, p), Action::Buffered);
+  recovery.mark_requested();
+
+  // 快照只到 2: 3、4 仍缺，捨棄並重新要求
+  Replay r;
+  EXPECT_FALSE(r.run(recovery, 2));
+  EXPECT_FALSE(r.snapshot_applied);
+  EXPECT_EQ(recovery.state(), State::Recovering);
+  EXPECT_TRUE(recovery.wants_snapshot());
+  EXPECT_EQ(recovery.stats().rejected, 1u);
+}
+
+TEST(ChannelRecoveryTest, OverflowRequiresNewerSnapshot) {
+  ChannelRecovery recovery(2);
+  std::vector<std::vector<std::byte>> pkts;
+  for (uint32_t seq = 0; seq <= 6; ++seq) pkts.push_back(trade_packet(seq));
+
+  EXPECT_EQ(recovery.on_packet(3, 0, pkts[3]), Action::Buffered);
+  EXPECT_EQ(recovery.on_packet(4, 0, pkts[4]), Action::Buffered);
+  EXPECT_EQ(recovery.on_packet(5, 0, pkts[5]), Action::Buffered);
+  EXPECT_EQ(recovery.overwritten(), 1u);  // 3 被覆蓋
+
+  Replay r;
+  EXPECT_FALSE(r.run(recovery, 2));  // 需要 3，但已不在暫存中
+  EXPECT_TRUE(r.run(recovery, 3));
+  EXPECT_EQ(r.replayed, (std::vector<uint32_t>{4, 5}));
+  EXPECT_EQ(recovery.state(), State::Live);
+}
+
+TEST(ChannelRecoveryTest, HoleInsideBufferKeepsRecovering) {
+  ChannelRecovery recovery(8);
+  std::vector<std::vector<std::byte>> pkts;
+  for (uint32_t seq = 0; seq <= 9; ++seq) pkts.push_back(trade_packet(seq));
+
+  EXPECT_EQ(recovery.on_packet(5, 0, pkts[5]), Action::Buffered);
+  EXPECT_EQ(recovery.on_packet(6, 0, pkts[6]), Action::Buffered);
+  EXPECT_EQ(recovery.on_packet(8, 0, pkts[8]), Action::Buffered);  // 缺 7
+  recovery.mark_requested();
+
+  Replay r;
+  EXPECT_TRUE(r.run(recovery, 4));
+  EXPECT_EQ(r.replayed, (std::vector<uint32_t>{5, 6}));
+  EXPECT_EQ(recovery.state(), State::Recovering);
+  EXPECT_TRUE(recovery.wants_snapshot());
+
+  // 第二次快照涵蓋到 7
+  Replay r2;
+  EXPECT_TRUE(r2.run(recovery, 7));
+  EXPECT_EQ(r2.replayed, (std::vector<uint32_t>{8}));
+  EXPECT_EQ(recovery.state(), State::Live);
+  EXPECT_EQ(recovery.on_packet(9, 0, pkts[9]), Action::Apply);
+}
+
+TEST(ChannelRecoveryTest, IgnoresSnapshotWhenLive) {
+  ChannelRecovery recovery(8);
+  auto p = trade_packet(1);
+  EXPECT_EQ(recovery.on_packet(1, 0, p), Action::Apply);
+
+  Replay r;
+  EXPECT_FALSE(r.run(recovery, 100));
+  EXPECT_FALSE(r.snapshot_applied);
+  EXPECT_EQ(recovery.next_seq(), 2u);
+}
+
+TEST(RecoveryUtilTest, ForEachPacketSplitsConcatenatedPackets) {
+  auto a = trade_packet(1);
+  auto b = trade_packet(2);
+  std::vector<std::byte> bytes = a;
+  for (auto byte : b) bytes.push_back(byte);
+
+  std::vector<uint32_t> seqs;
+  EXPECT_TRUE(for_each_packet(bytes, [&](std::span<const std::byte> pkt) {
+    auto it = net::taifex::PacketIterator::from(pkt);
+    seqs.push_back(it->header().pkt_seq_num);
+  }));
+  EXPECT_EQ(seqs, (std::vector<uint32_t>{1, 2}));
+
+  bytes.pop_back();
+  EXPECT_FALSE(for_each_packet(bytes, [](std::span<const std::byte>) {}));
+}
+
+// ----------------------------------------------------------------------------
+// SnapshotClient / SnapshotServer
+// ----------------------------------------------------------------------------
+
+class SnapshotServiceTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    sys::TSCTimer::calibrate(std::chrono::milliseconds(10));
+  }
+
+  SnapshotServer server_ =
+      SnapshotServer::create(
+          io::SocketAddress::from_ipv4("127.0.0.1", 0).value())
+          .value();
+  io::SocketAddress address_ = server_.local_address().value();
+
+  /// @brief 頻道 1 有快照 (seq 41)，其餘頻道不存在
+  static std::optional<Snapshot> provide(uint16_t channel) {
+    if (channel != 1) return std::nullopt;
+    return Snapshot{.seq = 41, .packets = trade_packet(41)};
+  }
+};
+
+TEST_F(SnapshotServiceTest, RequestAndReceiveSnapshot) {
+  SnapshotClient client(address_);
+  client.request(1);
+  client.request(1);  // 重複要求只送一次
+  client.request(9);
+  EXPECT_EQ(client.outstanding(), 2u);
+
+  std::vector<std::pair<uint16_t, uint32_t>> received;
+  std::vector<uint16_t> unavailable;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (client.outstanding() > 0 &&
+         std::chrono::steady_clock::now() < deadline) {
+    ASSERT_TRUE(server_.poll(provide).has_value());
+    auto n = client.poll(
+        [&](uint16_t channel, uint32_t seq,
+            std::span<const std::byte> packets) {
+          received.emplace_back(channel, seq);
+          EXPECT_EQ(packets.size(), trade_packet(41).size());
+        },
+        [&](uint16_t channel, uint16_t status) {
+          EXPECT_NE(status, 0);
+          unavailable.push_back(channel);
+        });
+    ASSERT_TRUE(n.has_value());
+  }
+
+  // 頻道 9 不存在: 不交給 sink，改通知 unavailable
+  EXPECT_EQ(received,
+            (std::vector<std::pair<uint16_t, uint32_t>>{{1, 41}}));
+  EXPECT_EQ(unavailable, (std::vector<uint16_t>{9}));
+  EXPECT_TRUE(client.is_connected());
+}
+
+TEST_F(SnapshotServiceTest, KeepsRequestUntilServiceAvailable) {
+  // 取得一個目前沒有人監聽的地址
+  io::SocketAddress address =
+      SnapshotServer::create(
+          io::SocketAddress::from_ipv4("127.0.0.1", 0).value())
+          .value()
+          .local_address()
+          .value();
+
+  SnapshotClient client(address, SnapshotClient::kDefaultMaxSnapshot, 0);
+  client.request(1);
+
+  // 連線被拒: 回傳錯誤但要求保留
+  bool failed = false;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (!failed && std::chrono::steady_clock::now() < deadline) {
+    failed = !client
+                  .poll([](uint16_t, uint32_t, std::span<const std::byte>) {})
+                  .has_value();
+  }
+  EXPECT_TRUE(failed);
+  EXPECT_FALSE(client.is_connected());
+  EXPECT_EQ(client.outstanding(), 1u);
+
+  // 服務啟動後重連並重送
+  auto server = SnapshotServer::create(address).value();
+  int delivered = 0;
+  deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (delivered == 0 && std::chrono::steady_clock::now() < deadline) {
+    (void)client.poll([&](uint16_t, uint32_t seq, std::span<const std::byte>) {
+      EXPECT_EQ(seq, 41u);
+      ++delivered;
+    });
+    ASSERT_TRUE(server.poll(provide).has_value());
+  }
+  EXPECT_EQ(delivered, 1);
+  EXPECT_EQ(client.outstanding(), 0u);
+}
+
+// ----------------------------------------------------------------------------
+// ShardedFeedHandler 整合
+// ----------------------------------------------------------------------------
+
+TEST_F(SnapshotServiceTest, HandlerRecoversGapWithoutPausingOtherChannels) {
+  // 頻道 1: 1, 2, (3 遺失), 4, 5；頻道 2: 1..5 全部收到
+  std::vector<std::vector<std::byte>> ch1;
+  std::vector<std::vector<std::byte>> ch2;
+  for (uint32_t seq = 1; seq <= 5; ++seq) {
+    ch1.push_back(trade_packet(seq, 1, "TXFC6"));
+    ch2.push_back(trade_packet(seq, 2, "MXFC6"));
+  }
+  std::vector<std::span<const std::byte>> ch1_spans{ch1[0], ch1[1], ch1[3],
+                                                    ch1[4]};
+  std::vector<std::span<const std::byte>> ch2_spans(ch2.begin(), ch2.end());
+
+  ShardedFeedHandler<MemoryFeed, 16, 1024> handler;
+  auto txf = handler.subscribe("TXFC6").value();
+  auto mxf = handler.subscribe("MXFC6").value();
+  ASSERT_TRUE(handler.add_channel(1, MemoryFeed(ch1_spans, 1)).has_value());
+  ASSERT_TRUE(handler.add_channel(2, MemoryFeed(ch2_spans, 1)).has_value());
+  ASSERT_TRUE(handler.enable_recovery(address_, 16).has_value());
+  const size_t cpu = 0;
+  ASSERT_TRUE(handler.assign(std::span(&cpu, 1)).has_value());
+
+  std::vector<MarketEvent> events;
+  auto drain = [&] {
+    while (handler.poll([&](const MarketEvent& e) { events.push_back(e); })) {
+    }
+  };
+
+  // 不啟動服務端: 頻道 1 停在回補，頻道 2 照常
+  for (int i = 0; i < 5; ++i) handler.poll_shard(0);
+  drain();
+  size_t mxf_events = 0;
+  size_t txf_events = 0;
+  for (const auto& e : events) {
+    if (e.instrument == mxf) ++mxf_events;
+    if (e.instrument == txf) ++txf_events;
+  }
+  EXPECT_EQ(mxf_events, 5u);
+  EXPECT_EQ(txf_events, 2u);
+  EXPECT_EQ(handler.recovery(1)->state(), State::Recovering);
+  EXPECT_EQ(handler.recovery(2)->state(), State::Live);
+
+  // 服務端提供頻道 1 到 seq 3 的快照 (成交價 3)
+  events.clear();
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (handler.recovery(1)->state() != State::Live &&
+         std::chrono::steady_clock::now() < deadline) {
+    ASSERT_TRUE(server_
+                    .poll([](uint16_t channel) -> std::optional<Snapshot> {
+                      if (channel != 1) return std::nullopt;
+                      return Snapshot{.seq = 3,
+                                      .packets = trade_packet(3, 1, "TXFC6")};
+                    })
+                    .has_value());
+    handler.poll_shard(0);
+  }
+  drain();
+
+  ASSERT_EQ(handler.recovery(1)->state(), State::Live);
+  // 快照 (3) 後依序重播 4、5
+  std::vector<int64_t> prices;
+  for (const auto& e : events) {
+    if (e.instrument == txf) prices.push_back(e.last_price.to_ticks());
+  }
+  EXPECT_EQ(prices, (std::vector<int64_t>{3, 4, 5}));
+  EXPECT_EQ(handler.stats(0).recoveries, 1u);
+  EXPECT_EQ(handler.stats(0).buffered, 0u);
+}
+
+TEST_F(SnapshotServiceTest, HandlerRetriesWhenSnapshotNotYetAvailable) {
+  // 頻道 1: 1, (2 遺失), 3
+  std::vector<std::vector<std::byte>> ch1;
+  for (uint32_t seq = 1; seq <= 3; ++seq) ch1.push_back(trade_packet(seq));
+  std::vector<std::span<const std::byte>> spans{ch1[0], ch1[2]};
+
+  ShardedFeedHandler<MemoryFeed, 16, 1024> handler;
+  auto txf = handler.subscribe("TXFC6").value();
+  ASSERT_TRUE(handler.add_channel(1, MemoryFeed(spans, 1)).has_value());
+  ASSERT_TRUE(handler.enable_recovery(address_, 16, 0).has_value());
+  const size_t cpu = 0;
+  ASSERT_TRUE(handler.assign(std::span(&cpu, 1)).has_value());
+
+  // 第一次要求: 服務端尚無快照 (status = 1)；之後提供到 seq 2 的快照
+  int requests = 0;
+  auto provider = [&](uint16_t) -> std::optional<Snapshot> {
+    if (++requests == 1) return std::nullopt;
+    return Snapshot{.seq = 2, .packets = trade_packet(2)};
+  };
+
+  handler.poll_shard(0);
+  handler.poll_shard(0);  // seq 3: 跳號，進入回補
+  ASSERT_EQ(handler.recovery(1)->state(), State::Recovering);
+
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+  while (handler.recovery(1)->state() != State::Live &&
+         std::chrono::steady_clock::now() < deadline) {
+    handler.poll_shard(0);
+    ASSERT_TRUE(server_.poll(provider).has_value());
+  }
+
+  // 被拒後沒有卡在回補：重新要求並套用第二次的快照
+  ASSERT_EQ(handler.recovery(1)->state(), State::Live);
+  EXPECT_EQ(requests, 2);
+  EXPECT_EQ(handler.stats(0).snapshot_misses, 1u);
+  EXPECT_EQ(handler.stats(0).recoveries, 1u);
+
+  std::vector<int64_t> prices;
+  while (handler.poll([&](const MarketEvent& e) {
+    if (e.instrument == txf) prices.push_back(e.last_price.to_ticks());
+  })) {
+  }
+  EXPECT_EQ(prices, (std::vector<int64_t>{1, 2, 3}));
+}
+
+}  // namespace tx::feed::test
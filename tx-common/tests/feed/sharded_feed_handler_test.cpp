@@ -0,0 +1,298 @@
+#include "tx/feed/sharded_feed_handler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/feed/memory_feed.hpp"
+
+namespace tx::feed::test {
+
+using net::taifex::test::make_r02;
+using net::taifex::test::make_r06;
+using net::taifex::test::PacketBuilder;
+
+using Handler = ShardedFeedHandler<MemoryFeed, 16, 1024>;
+
+/// @brief 持有封包內容並產生 MemoryFeed
+struct Packets {
+  std::vector<std::vector<std::byte>> storage;
+
+  void add(std::vector<std::byte> packet) {
+    storage.push_back(std::move(packet));
+  }
+
+  /// @param indices 依序回放的封包 (可重複或省略，模擬不同線路)
+  [[nodiscard]] MemoryFeed feed(const std::vector<size_t>& indices) const {
+    std::vector<std::span<const std::byte>> spans;
+    for (size_t i : indices) spans.emplace_back(storage[i]);
+    return MemoryFeed(std::move(spans));
+  }
+
+  [[nodiscard]] MemoryFeed feed() const {
+    std::vector<size_t> all;
+    for (size_t i = 0; i < storage.size(); ++i) all.push_back(i);
+    return feed(all);
+  }
+};
+
+/// @brief 前 failures 次 poll() 回傳錯誤的線路
+struct FlakyFeed {
+  MemoryFeed inner;
+  int failures{0};
+
+  template <typename F>
+  Result<size_t> poll(F&& sink) {
+    if (failures > 0) {
+      --failures;
+      return tx::fail(std::errc::network_down, "Line down");
+    }
+    return inner.poll(std::forward<F>(sink));
+  }
+};
+static_assert(PacketFeed<FlakyFeed>);
+
+std::vector<MarketEvent> drain(Handler& handler) {
+  std::vector<MarketEvent> events;
+  while (handler.poll([&](const MarketEvent& e) { events.push_back(e); }) >
+         0) {
+  }
+  return events;
+}
+
+// ----------------------------------------------------------------------------
+// 仲裁與解碼
+// ----------------------------------------------------------------------------
+
+TEST(ShardedFeedHandlerTest, ArbitratesBetweenLines) {
+  Packets pkts;
+  for (uint32_t seq = 1; seq <= 4; ++seq) {
+    pkts.add(PacketBuilder(seq, 7)
+                 .add(make_r02("TXFC6", 20000 + static_cast<int32_t>(seq), 1,
+                               seq))
+                 .build());
+  }
+
+  Handler handler;
+  auto id = handler.subscribe("TXFC6").value();
+  // A 線缺 seq 3，B 線缺 seq 2：合併後四個封包各處理一次
+  ASSERT_TRUE(handler.add_channel(7, pkts.feed({0, 1, 3}), pkts.feed({0, 2}))
+                  .has_value());
+  const size_t cpu = 0;
+  ASSERT_TRUE(handler.assign(std::span(&cpu, 1)).has_value());
+
+  handler.poll_shard(0);
+  auto events = drain(handler);
+
+  // A: 1,2,4 (4 時跳過 3)；B: 1 重複、2 重複
+  ASSERT_EQ(events.size(), 3u);
+  EXPECT_EQ(events[0].sequence, 1u);
+  EXPECT_EQ(events[1].sequence, 2u);
+  EXPECT_EQ(events[2].sequence, 4u);
+  for (const auto& e : events) {
+    EXPECT_EQ(e.instrument, id);
+    EXPECT_EQ(e.channel, 7u);
+    EXPECT_EQ(e.kind, MarketEvent::Kind::Trade);
+    EXPECT_EQ(e.last_price.to_ticks(), 20000 + e.sequence);
+  }
+
+  const auto& stats = handler.stats(0);
+  EXPECT_EQ(stats.packets, 3u);
+  EXPECT_EQ(stats.duplicates, 2u);
+  EXPECT_EQ(stats.gaps, 1u);
+}
+
+TEST(ShardedFeedHandlerTest, PublishesTopOfBookAndMask) {
+  Packets pkts;
+  pkts.add(PacketBuilder(1, 1)
+               .add(make_r06("TXFC6", {{20000, 5, 1}}, {{20001, 3, 1}}, 0, 0,
+                             0))
+               .add(make_r06("UNSUB", {{1, 1, 1}}, {}, 0, 0, 0))
+               .build());
+
+  Handler handler;
+  (void)handler.subscribe("TXFC6");
+  ASSERT_TRUE(handler.add_channel(1, pkts.feed()).has_value());
+  const size_t cpu = 0;
+  ASSERT_TRUE(handler.assign(std::span(&cpu, 1)).has_value());
+
+  handler.poll_shard(0);
+  auto events = drain(handler);
+
+  ASSERT_EQ(events.size(), 1u);  // 未訂閱商品略過
+  EXPECT_EQ(events[0].kind, MarketEvent::Kind::Book);
+  EXPECT_EQ(events[0].bid.price.to_ticks(), 20000);
+  EXPECT_EQ(events[0].ask.price.to_ticks(), 20001);
+  // 首次快照: 第一檔與 last price (invalid -> 0) 皆變動
+  EXPECT_EQ(events[0].changed, market::OrderBook::bid_bit(0) |
+                                   market::OrderBook::ask_bit(0) |
+                                   market::OrderBook::kTradeBit);
+}
+
+TEST(ShardedFeedHandlerTest, RejectsMismatchedChannel) {
+  Packets pkts;
+  pkts.add(PacketBuilder(1, 2).add(make_r02("TXFC6", 1, 1, 1)).build());
+
+  Handler handler;
+  (void)handler.subscribe("TXFC6");
+  ASSERT_TRUE(handler.add_channel(1, pkts.feed()).has_value());
+  const size_t cpu = 0;
+  ASSERT_TRUE(handler.assign(std::span(&cpu, 1)).has_value());
+
+  handler.poll_shard(0);
+  EXPECT_TRUE(drain(handler).empty());
+  EXPECT_EQ(handler.stats(0).invalid, 1u);
+}
+
+TEST(ShardedFeedHandlerTest, CountsFeedErrorsWithoutStoppingOtherLines) {
+  Packets pkts;
+  pkts.add(PacketBuilder(1, 7).add(make_r02("TXFC6", 1, 1, 1)).build());
+  pkts.add(PacketBuilder(2, 7).add(make_r02("TXFC6", 2, 1, 2)).build());
+
+  ShardedFeedHandler<FlakyFeed, 16, 1024> handler;
+  (void)handler.subscribe("TXFC6");
+  // A 線持續中斷，B 線正常
+  ASSERT_TRUE(handler
+                  .add_channel(7, FlakyFeed{pkts.feed(), 100},
+                               FlakyFeed{pkts.feed(), 0})
+                  .has_value());
+  const size_t cpu = 0;
+  ASSERT_TRUE(handler.assign(std::span(&cpu, 1)).has_value());
+
+  EXPECT_EQ(handler.poll_shard(0), 2u);
+  EXPECT_EQ(handler.poll_shard(0), 0u);
+
+  const auto& stats = handler.stats(0);
+  EXPECT_EQ(stats.packets, 2u);
+  EXPECT_EQ(stats.feed_errors, 2u);
+  EXPECT_EQ(stats.last_error, std::errc::network_down);
+  EXPECT_EQ(handler.feed_errors(), 2u);
+}
+
+// ----------------------------------------------------------------------------
+// 分片
+// ----------------------------------------------------------------------------
+
+TEST(ShardedFeedHandlerTest, AssignsChannelsRoundRobin) {
+  Handler handler;
+  for (uint16_t ch = 1; ch <= 5; ++ch) {
+    ASSERT_TRUE(handler.add_channel(ch, MemoryFeed({})).has_value());
+  }
+  EXPECT_FALSE(handler.add_channel(3, MemoryFeed({})).has_value());
+
+  const std::vector<size_t> cpus{0, 0};
+  ASSERT_TRUE(handler.assign(cpus).has_value());
+  ASSERT_EQ(handler.shard_count(), 2u);
+  EXPECT_EQ(handler.shard_channels(0), (std::vector<uint16_t>{1, 3, 5}));
+  EXPECT_EQ(handler.shard_channels(1), (std::vector<uint16_t>{2, 4}));
+
+  // shard 數不超過頻道數
+  const std::vector<size_t> many(8, 0);
+  ASSERT_TRUE(handler.assign(many).has_value());
+  EXPECT_EQ(handler.shard_count(), 5u);
+}
+
+TEST(ShardedFeedHandlerTest, SelectsCpusOnInterfaceNode) {
+  // 2 插槽 × 2 核心 × 2 SMT，sibling 編號間隔 4
+  const std::vector<sys::CpuInfo> topology{
+      {.cpu = 0, .package = 0, .core = 0, .node = 0},
+      {.cpu = 1, .package = 0, .core = 1, .node = 0},
+      {.cpu = 2, .package = 1, .core = 0, .node = 1},
+      {.cpu = 3, .package = 1, .core = 1, .node = 1},
+      {.cpu = 4, .package = 0, .core = 0, .node = 0},
+      {.cpu = 5, .package = 0, .core = 1, .node = 0},
+      {.cpu = 6, .package = 1, .core = 0, .node = 1},
+      {.cpu = 7, .package = 1, .core = 1, .node = 1},
+  };
+
+  Handler handler;
+  ASSERT_TRUE(handler.add_channel(1, MemoryFeed({})).has_value());
+  ASSERT_TRUE(handler.add_channel(2, MemoryFeed({})).has_value());
+  EXPECT_EQ(handler.select_cpus(topology), (std::vector<size_t>{1, 2}));
+
+  // 網卡在 node 1: 兩個 shard 都放在 node 1 的實體核心
+  ASSERT_TRUE(handler.set_numa_node(1).has_value());
+  EXPECT_EQ(handler.select_cpus(topology), (std::vector<size_t>{2, 3}));
+
+  // 未知網卡不限 node
+  ASSERT_TRUE(handler.set_interface("no-such-nic0").has_value());
+  EXPECT_EQ(handler.select_cpus(topology), (std::vector<size_t>{1, 2}));
+}
+
+TEST(ShardedFeedHandlerTest, InstrumentOwnedBySingleShard) {
+  Packets pkts;
+  pkts.add(PacketBuilder(1, 1).add(make_r02("TXFC6", 1, 1, 1)).build());
+  pkts.add(PacketBuilder(1, 2).add(make_r02("TXFC6", 2, 1, 2)).build());
+
+  Handler handler;
+  auto id = handler.subscribe("TXFC6").value();
+  ASSERT_TRUE(handler.add_channel(1, pkts.feed({0})).has_value());
+  ASSERT_TRUE(handler.add_channel(2, pkts.feed({1})).has_value());
+  const std::vector<size_t> cpus{0, 0};
+  ASSERT_TRUE(handler.assign(cpus).has_value());
+
+  handler.poll_shard(0);
+  handler.poll_shard(1);
+  auto events = drain(handler);
+
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].channel, 1u);
+  EXPECT_EQ(handler.owner(id), 0u);
+  EXPECT_EQ(handler.stats(1).foreign, 1u);
+}
+
+TEST(ShardedFeedHandlerTest, ThreadsPreservePerInstrumentOrder) {
+  constexpr uint32_t kPackets = 2000;
+  const char* symbols[] = {"TXFC6", "MXFC6", "TEFC6", "TFFC6"};
+
+  // 四個頻道各一個商品
+  std::vector<Packets> per_channel(4);
+  for (uint32_t seq = 1; seq <= kPackets; ++seq) {
+    for (uint16_t ch = 0; ch < 4; ++ch) {
+      per_channel[ch].add(PacketBuilder(seq, static_cast<uint16_t>(ch + 1))
+                              .add(make_r02(symbols[ch],
+                                            static_cast<int32_t>(seq), 1, seq))
+                              .build());
+    }
+  }
+
+  Handler handler;
+  for (uint16_t ch = 0; ch < 4; ++ch) {
+    (void)handler.subscribe(symbols[ch]);
+    ASSERT_TRUE(handler
+                    .add_channel(static_cast<uint16_t>(ch + 1),
+                                 per_channel[ch].feed())
+                    .has_value());
+  }
+  const std::vector<size_t> cpus{0, 0};
+  ASSERT_TRUE(handler.start(cpus).has_value());
+
+  std::map<market::InstrumentId, int64_t> last;
+  size_t received = 0;
+  bool ordered = true;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (received < 4 * kPackets &&
+         std::chrono::steady_clock::now() < deadline) {
+    received += handler.poll([&](const MarketEvent& e) {
+      int64_t price = e.last_price.to_ticks();
+      if (price != last[e.instrument] + 1) ordered = false;
+      last[e.instrument] = price;
+    });
+    std::this_thread::yield();
+  }
+  handler.stop();
+
+  EXPECT_EQ(received, 4 * kPackets);
+  EXPECT_TRUE(ordered);
+  for (const auto& [id, price] : last) {
+    EXPECT_EQ(price, kPackets);
+  }
+}
+
+}  // namespace tx::feed::test
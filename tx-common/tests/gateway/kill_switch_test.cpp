@@ -0,0 +1,290 @@
+#include "tx/gateway/kill_switch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "tx/net/fix/framer.hpp"
+
+namespace tx::gateway::test {
+
+namespace {
+
+/// @brief 每次最多接受 chunk bytes，並穿插 EAGAIN
+struct FakeWriter {
+  std::string out;
+  size_t chunk{SIZE_MAX};
+  int calls{0};
+
+  Result<size_t> writev(std::span<const iovec> iov) {
+    if (++calls % 3 == 0) {
+      return tx::fail(std::errc::resource_unavailable_try_again);
+    }
+    size_t written = 0;
+    for (const auto& seg : iov) {
+      const size_t n = std::min(seg.iov_len, chunk - written);
+      out.append(static_cast<const char*>(seg.iov_base), n);
+      written += n;
+      if (written == chunk) break;
+    }
+    return written;
+  }
+};
+
+/// @brief 拆出並驗證 (BodyLength / CheckSum) 所有訊息
+std::vector<std::string> frame_all(const std::string& stream) {
+  net::fix::Framer framer(1 << 20);
+  auto space = framer.prepare();
+  std::memcpy(space.data(), stream.data(), stream.size());
+  framer.commit(stream.size());
+  std::vector<std::string> out;
+  auto n = framer.drain([&](std::string_view m) { out.emplace_back(m); });
+  EXPECT_TRUE(n) << n.error().message();
+  EXPECT_EQ(framer.buffered(), 0U);
+  return out;
+}
+
+/// @brief 取出 tag 的值
+std::string field(std::string_view msg, std::string_view tag) {
+  const std::string key =
+      std::string(1, net::fix::SOH) + std::string(tag) + "=";
+  const auto pos = msg.find(key);
+  if (pos == std::string_view::npos) return {};
+  const auto begin = pos + key.size();
+  return std::string(msg.substr(begin, msg.find(net::fix::SOH, begin) - begin));
+}
+
+CancelFields fields_for(const std::string& orig, const std::string& id,
+                        int64_t qty) {
+  return {.orig_cl_ord_id = orig,
+          .cl_ord_id = id,
+          .order_id = {},
+          .symbol = "TXFA6",
+          .side = core::Side::Sell,
+          .order_qty = core::Quantity::from_value(qty)};
+}
+
+constexpr std::string_view kTime = "20260105-09:00:00.123";
+
+}  // namespace
+
+TEST(KillSwitchTest, FiresOneCancelPerLiveOrder) {
+  KillSwitch kill(16);
+  const auto s0 = kill.add_session({.sender = "TX", .target = "EX0"});
+  const auto s1 = kill.add_session({.sender = "TX", .target = "EX1"});
+
+  std::vector<std::string> names;
+  for (int i = 0; i < 10; ++i) names.push_back("O" + std::to_string(i));
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(kill.track(core::OrderId::from_value(i + 1), i % 2 ? s1 : s0,
+                           fields_for(names[i], "K" + names[i], i + 1)));
+  }
+  EXPECT_EQ(kill.live(), 10U);
+  EXPECT_EQ(kill.live(s0), 5U);
+
+  // 成交完畢 / 已刪的委託不再送出
+  kill.untrack(core::OrderId::from_value(1));
+  kill.untrack(core::OrderId::from_value(4));
+  kill.untrack(core::OrderId::from_value(99));  // 未知：忽略
+  EXPECT_EQ(kill.live(), 8U);
+
+  FakeWriter writer;
+  uint64_t seq = 100;
+  auto sent = kill.fire(s0, seq, kTime, writer);
+  ASSERT_TRUE(sent) << sent.error().message();
+  EXPECT_EQ(*sent, 4U);
+  EXPECT_EQ(seq, 104U);
+
+  const auto msgs = frame_all(writer.out);
+  ASSERT_EQ(msgs.size(), 4U);
+  std::set<std::string> orig;
+  for (size_t i = 0; i < msgs.size(); ++i) {
+    EXPECT_EQ(field(msgs[i], "35"), "F");
+    EXPECT_EQ(field(msgs[i], "56"), "EX0");
+    EXPECT_EQ(std::stoul(field(msgs[i], "34")), 100 + i);
+    EXPECT_EQ(field(msgs[i], "60"), kTime);
+    EXPECT_EQ(field(msgs[i], "54"), "2");
+    orig.insert(field(msgs[i], "41"));
+  }
+  EXPECT_EQ(orig, (std::set<std::string>{"O2", "O4", "O6", "O8"}));
+}
+
+TEST(KillSwitchTest, ReplaceUpdatesCancelInPlace) {
+  KillSwitch kill;
+  const auto s = kill.add_session({.sender = "TX", .target = "EX"});
+  const auto id = core::OrderId::from_value(7);
+  ASSERT_TRUE(kill.track(id, s, fields_for("A", "KA", 1)));
+  ASSERT_TRUE(kill.track(id, s, fields_for("B", "KB", 5)));  // 改單確認
+  EXPECT_EQ(kill.live(s), 1U);
+
+  FakeWriter writer;
+  uint64_t seq = 1;
+  ASSERT_TRUE(kill.fire(s, seq, kTime, writer));
+  const auto msgs = frame_all(writer.out);
+  ASSERT_EQ(msgs.size(), 1U);
+  EXPECT_EQ(field(msgs[0], "41"), "B");
+  EXPECT_EQ(field(msgs[0], "38"), "5");
+}
+
+TEST(KillSwitchTest, HandlesPartialWritesAcrossBatches) {
+  KillSwitch kill(1024);
+  const auto s = kill.add_session({.sender = "TX", .target = "EX"});
+  std::vector<std::string> names;
+  for (int i = 0; i < 600; ++i) names.push_back(std::to_string(i));
+  for (int i = 0; i < 600; ++i) {
+    ASSERT_TRUE(kill.track(core::OrderId::from_value(i + 1), s,
+                           fields_for(names[i], "K" + names[i], 1)));
+  }
+
+  FakeWriter writer{.chunk = 1000};
+  uint64_t seq = 1;
+  auto sent = kill.fire(s, seq, kTime, writer);
+  ASSERT_TRUE(sent);
+  EXPECT_EQ(*sent, 600U);
+  EXPECT_GT(writer.calls, 600 / static_cast<int>(KillSwitch::kMaxBatch));
+
+  const auto msgs = frame_all(writer.out);
+  ASSERT_EQ(msgs.size(), 600U);
+  EXPECT_EQ(field(msgs.back(), "34"), "000000600");
+}
+
+TEST(KillSwitchTest, PropagatesWriteErrors) {
+  struct BrokenWriter {
+    Result<size_t> writev(std::span<const iovec>) {
+      return tx::fail(std::errc::broken_pipe);
+    }
+  } writer;
+
+  KillSwitch kill;
+  const auto s = kill.add_session({.sender = "TX", .target = "EX"});
+  ASSERT_TRUE(kill.track(core::OrderId::from_value(1), s,
+                         fields_for("A", "KA", 1)));
+  uint64_t seq = 1;
+  auto sent = kill.fire(s, seq, kTime, writer);
+  ASSERT_FALSE(sent);
+  EXPECT_EQ(sent.error(), std::errc::broken_pipe);
+  EXPECT_EQ(seq, 1U);  // 沒有送出任何訊息
+}
+
+TEST(KillSwitchTest, AdvancesSeqOnlyForWrittenMessages) {
+  /// @brief 接受第一批，之後斷線
+  struct DroppingWriter {
+    std::string out;
+    int calls{0};
+
+    Result<size_t> writev(std::span<const iovec> iov) {
+      if (++calls > 1) return tx::fail(std::errc::broken_pipe);
+      size_t written = 0;
+      for (const auto& seg : iov) {
+        out.append(static_cast<const char*>(seg.iov_base), seg.iov_len);
+        written += seg.iov_len;
+      }
+      return written;
+    }
+  } writer;
+
+  KillSwitch kill(1024);
+  const auto s = kill.add_session({.sender = "TX", .target = "EX"});
+  for (int i = 0; i < 300; ++i) {
+    ASSERT_TRUE(kill.track(core::OrderId::from_value(i + 1), s,
+                           fields_for("O", "K", 1)));
+  }
+  uint64_t seq = 10;
+  auto sent = kill.fire(s, seq, kTime, writer);
+  ASSERT_FALSE(sent);
+  EXPECT_EQ(sent.error(), std::errc::broken_pipe);
+  EXPECT_EQ(seq, 10 + KillSwitch::kMaxBatch);
+  EXPECT_EQ(frame_all(writer.out).size(), KillSwitch::kMaxBatch);
+}
+
+TEST(KillSwitchTest, TimesOutWhenNeverWritable) {
+  struct BlockedWriter {
+    Result<size_t> writev(std::span<const iovec>) {
+      return tx::fail(std::errc::resource_unavailable_try_again);
+    }
+  } writer;
+
+  KillSwitch kill;
+  const auto s = kill.add_session({.sender = "TX", .target = "EX"});
+  ASSERT_TRUE(kill.track(core::OrderId::from_value(1), s,
+                         fields_for("A", "KA", 1)));
+  uint64_t seq = 1;
+  auto sent = kill.fire(s, seq, kTime, writer, std::chrono::milliseconds(5));
+  ASSERT_FALSE(sent);
+  EXPECT_EQ(sent.error(), std::errc::timed_out);
+  EXPECT_EQ(seq, 1U);
+}
+
+TEST(KillSwitchTest, RejectsMismatchedTimePrecision) {
+  KillSwitch kill;
+  const auto s = kill.add_session(
+      {.sender = "TX",
+       .target = "EX",
+       .precision = net::fix::TimePrecision::Micros});
+  ASSERT_TRUE(kill.track(core::OrderId::from_value(1), s,
+                         fields_for("A", "KA", 1)));
+  FakeWriter writer;
+  uint64_t seq = 1;
+  auto sent = kill.fire(s, seq, kTime, writer);  // 毫秒時間
+  ASSERT_FALSE(sent);
+  EXPECT_EQ(seq, 1U);
+  EXPECT_TRUE(writer.out.empty());
+}
+
+TEST(KillSwitchTest, TrackFailsWhenFull) {
+  KillSwitch kill(4);
+  const auto s = kill.add_session({.sender = "TX", .target = "EX"});
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(kill.track(core::OrderId::from_value(i + 1), s,
+                           fields_for("O", "K", 1)));
+  }
+  auto full = kill.track(core::OrderId::from_value(5), s,
+                         fields_for("O", "K", 1));
+  ASSERT_FALSE(full);
+  EXPECT_EQ(full.error(), std::errc::no_buffer_space);
+  EXPECT_FALSE(kill.track(core::OrderId::invalid(), s,
+                          fields_for("O", "K", 1)));
+
+  // 已追蹤的委託仍可改單；untrack 後空出位置
+  EXPECT_TRUE(kill.track(core::OrderId::from_value(2), s,
+                         fields_for("P", "K", 2)));
+  kill.untrack(core::OrderId::from_value(1));
+  EXPECT_TRUE(kill.track(core::OrderId::from_value(5), s,
+                         fields_for("O", "K", 1)));
+  EXPECT_EQ(kill.live(), 4U);
+}
+
+TEST(KillSwitchTest, IndexSurvivesChurn) {
+  KillSwitch kill(64);
+  const auto s = kill.add_session({.sender = "TX", .target = "EX"});
+  std::set<uint64_t> live;
+  uint64_t next = 1;
+  for (int round = 0; round < 2000; ++round) {
+    if (live.size() < 64 && (round % 3 != 0 || live.empty())) {
+      ASSERT_TRUE(kill.track(core::OrderId::from_value(next), s,
+                             fields_for(std::to_string(next), "K", 1)));
+      live.insert(next++);
+    } else {
+      // 刪除中間的項目，走過 backward shift
+      auto it = std::next(live.begin(), static_cast<long>(live.size() / 2));
+      kill.untrack(core::OrderId::from_value(*it));
+      live.erase(it);
+    }
+    ASSERT_EQ(kill.live(), live.size());
+  }
+
+  FakeWriter writer;
+  uint64_t seq = 1;
+  ASSERT_TRUE(kill.fire(s, seq, kTime, writer));
+  std::set<uint64_t> orig;
+  for (const auto& msg : frame_all(writer.out)) {
+    orig.insert(std::stoull(field(msg, "41")));
+  }
+  EXPECT_EQ(orig, live);
+}
+
+}  // namespace tx::gateway::test
@@ -0,0 +1,96 @@
+#include "tx/gateway/risk_gate.hpp"
+
+#include <gtest/gtest.h>
+
+namespace tx::gateway::test {
+
+namespace {
+
+constexpr market::InstrumentId kTxf = 0;
+constexpr market::InstrumentId kMxf = 1;
+
+market::ReferenceTable make_reference() {
+  market::ReferenceTable table(4);
+  EXPECT_TRUE(table.set(kTxf, {.reference_price = 22000,
+                               .upper_limit = 24200,
+                               .lower_limit = 19800,
+                               .tick_size = 1,
+                               .multiplier = 200}));
+  return table;
+}
+
+RiskTable make_limits() {
+  RiskTable table(4);
+  EXPECT_TRUE(table.set(kTxf, {.max_order_qty = 10, .max_position = 20}));
+  return table;
+}
+
+core::Price px(int64_t ticks) { return core::Price::from_ticks(ticks); }
+core::Quantity qty(int64_t value) { return core::Quantity::from_value(value); }
+
+}  // namespace
+
+TEST(RiskGateTest, ChecksLimitsAndPriceBand) {
+  market::ReferenceData reference(make_reference());
+  RiskData limits(make_limits());
+  auto gate = RiskGate::create(reference, limits);
+  ASSERT_TRUE(gate);
+
+  EXPECT_EQ(gate->check(kTxf, core::Side::Buy, px(22000), qty(5), 0),
+            RiskCheck::Pass);
+  EXPECT_EQ(gate->check(kMxf, core::Side::Buy, px(22000), qty(1), 0),
+            RiskCheck::UnknownInstrument);
+  EXPECT_EQ(gate->check(kTxf, core::Side::Buy, px(22000), qty(11), 0),
+            RiskCheck::QtyLimit);
+  EXPECT_EQ(gate->check(kTxf, core::Side::Sell, px(22000), qty(5), -18),
+            RiskCheck::PositionLimit);
+  EXPECT_EQ(gate->check(kTxf, core::Side::Sell, px(22000), qty(10), 18),
+            RiskCheck::Pass);
+  EXPECT_EQ(gate->check(kTxf, core::Side::Buy, px(24201), qty(1), 0),
+            RiskCheck::PriceBand);
+}
+
+TEST(RiskGateTest, PicksUpPublishedUpdates) {
+  market::ReferenceData reference(make_reference());
+  RiskData limits(make_limits());
+  auto gate = RiskGate::create(reference, limits);
+  ASSERT_TRUE(gate);
+
+  // 盤中收到 I01：漲跌停更新，tick_size / multiplier 保留
+  net::taifex::ParsedI01ProductInfo info{};
+  info.reference_price = 23000;
+  info.upper_limit = 25300;
+  info.lower_limit = 20700;
+  reference.update([&](market::ReferenceTable& next) {
+    ASSERT_TRUE(next.apply(kTxf, info));
+  });
+  EXPECT_EQ(reference.current().find(kTxf)->multiplier, 200);
+  EXPECT_EQ(gate->check(kTxf, core::Side::Buy, px(24201), qty(1), 0),
+            RiskCheck::Pass);
+  EXPECT_EQ(gate->check(kTxf, core::Side::Buy, px(20000), qty(1), 0),
+            RiskCheck::PriceBand);
+
+  limits.update([](RiskTable& next) { next.set_halted(true); });
+  EXPECT_EQ(gate->check(kTxf, core::Side::Buy, px(23000), qty(1), 0),
+            RiskCheck::Halted);
+
+  // 舊版本在送單執行緒通過 quiescent point 後才釋放
+  EXPECT_EQ(limits.reclaim(), 1U);
+  gate->quiescent();
+  EXPECT_EQ(limits.reclaim(), 0U);
+  EXPECT_EQ(reference.reclaim(), 0U);
+}
+
+TEST(RiskGateTest, ReferenceTableRejectsInvalidSpec) {
+  market::ReferenceTable table(2);
+  EXPECT_FALSE(table.set(2, {}));
+  EXPECT_FALSE(table.set(0, {.tick_size = 0}));
+  EXPECT_EQ(table.find(0), nullptr);
+
+  EXPECT_TRUE(table.set(0, {.upper_limit = 100, .tick_size = 5}));
+  ASSERT_NE(table.find(0), nullptr);
+  EXPECT_TRUE(market::ReferenceTable::is_tradable(*table.find(0), px(95)));
+  EXPECT_FALSE(market::ReferenceTable::is_tradable(*table.find(0), px(97)));
+}
+
+}  // namespace tx::gateway::test
@@ -0,0 +1,199 @@
+#include "tx/gateway/throttle.hpp"
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "tx/ipc/shared_memory.hpp"
+
+namespace tx::gateway::test {
+
+namespace {
+
+/// @brief 每 100 tick 一個 token，容量 10，保留 2 個給刪單
+constexpr ThrottleConfig kConfig{.interval = 100, .burst = 10,
+                                 .cancel_reserve = 2};
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// Throttle
+// ----------------------------------------------------------------------------
+
+TEST(ThrottleTest, AllowsBurstThenRateLimits) {
+  ThrottleState state;
+  Throttle throttle(state, {.interval = 100, .burst = 5, .cancel_reserve = 0});
+  const uint64_t now = 1'000'000;
+
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(throttle.try_acquire(MessageClass::Order, now), 0U) << i;
+  }
+  EXPECT_EQ(throttle.try_acquire(MessageClass::Order, now), 100U);
+  EXPECT_EQ(throttle.try_acquire(MessageClass::Order, now + 40), 60U);
+
+  // 每經過 interval 補充一個
+  EXPECT_EQ(throttle.try_acquire(MessageClass::Order, now + 100), 0U);
+  EXPECT_NE(throttle.try_acquire(MessageClass::Order, now + 100), 0U);
+
+  // 閒置夠久後回到全滿 (不會超過 burst)
+  EXPECT_EQ(throttle.available(MessageClass::Order, now + 100'000), 5U);
+}
+
+TEST(ThrottleTest, ReservesTokensForCancels) {
+  ThrottleState state;
+  Throttle throttle(state, kConfig);
+  const uint64_t now = 1'000'000;
+
+  EXPECT_EQ(throttle.available(MessageClass::Order, now), 8U);
+  EXPECT_EQ(throttle.available(MessageClass::Cancel, now), 10U);
+
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_EQ(throttle.try_acquire(MessageClass::Order, now), 0U);
+  }
+  EXPECT_NE(throttle.try_acquire(MessageClass::Order, now), 0U);
+
+  EXPECT_EQ(throttle.try_acquire(MessageClass::Cancel, now), 0U);
+  EXPECT_EQ(throttle.try_acquire(MessageClass::Cancel, now), 0U);
+  EXPECT_NE(throttle.try_acquire(MessageClass::Cancel, now), 0U);
+}
+
+TEST(ThrottleTest, SharedAcrossThreadsGrantsExactlyBurst) {
+  ThrottleState state;
+  const ThrottleConfig config{
+      .interval = 1'000'000, .burst = 1000, .cancel_reserve = 0};
+  const uint64_t now = 5'000'000'000ULL;
+
+  std::atomic<int> granted{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      Throttle throttle(state, config);
+      for (int i = 0; i < 1000; ++i) {
+        if (throttle.try_acquire(MessageClass::Order, now) == 0) {
+          granted.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+  EXPECT_EQ(granted.load(), 1000);
+}
+
+TEST(ThrottleTest, SharedAcrossMappingsThroughSharedMemory) {
+  const char* name = "/test_throttle_state";
+  ::shm_unlink(name);
+  auto owner = ipc::SharedMemory::create(name, 4096);
+  ASSERT_TRUE(owner);
+  auto other = ipc::SharedMemory::open(name);
+  ASSERT_TRUE(other);
+
+  auto* state = new (owner->data()) ThrottleState{};
+  Throttle a(*state, kConfig);
+  Throttle b(*other->as<ThrottleState>(), kConfig);
+
+  const uint64_t now = 1'000'000;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(a.try_acquire(MessageClass::Order, now), 0U);
+    ASSERT_EQ(b.try_acquire(MessageClass::Order, now), 0U);
+  }
+  EXPECT_NE(a.try_acquire(MessageClass::Order, now), 0U);
+  EXPECT_NE(b.try_acquire(MessageClass::Order, now), 0U);
+}
+
+// ----------------------------------------------------------------------------
+// ThrottledSender
+// ----------------------------------------------------------------------------
+
+TEST(ThrottledSenderTest, RejectPolicyDropsExcess) {
+  ThrottleState state;
+  ThrottledSender<int> sender(Throttle(state, kConfig),
+                              OverflowPolicy::Reject);
+  std::vector<int> sent;
+  auto send = [&](int msg) { sent.push_back(msg); };
+
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(sender.submit(MessageClass::Order, i, 0, send),
+              Admission::Sent);
+  }
+  EXPECT_EQ(sender.submit(MessageClass::Order, 8, 0, send),
+            Admission::Rejected);
+  EXPECT_EQ(sender.submit(MessageClass::Cancel, 100, 0, send),
+            Admission::Sent);
+  EXPECT_EQ(sent.size(), 9U);
+  EXPECT_EQ(sender.pending(MessageClass::Order), 0U);
+}
+
+TEST(ThrottledSenderTest, QueuePolicyDrainsCancelsFirstInOrder) {
+  ThrottleState state;
+  ThrottledSender<int, 16> sender(
+      Throttle(state, {.interval = 100, .burst = 2, .cancel_reserve = 1}),
+      OverflowPolicy::Queue);
+  std::vector<int> sent;
+  auto send = [&](int msg) { sent.push_back(msg); };
+
+  uint64_t now = 1'000;
+  EXPECT_EQ(sender.submit(MessageClass::Order, 1, now, send), Admission::Sent);
+  EXPECT_EQ(sender.submit(MessageClass::Order, 2, now, send),
+            Admission::Queued);
+  EXPECT_EQ(sender.submit(MessageClass::Cancel, 101, now, send),
+            Admission::Sent);
+  EXPECT_EQ(sender.submit(MessageClass::Order, 3, now, send),
+            Admission::Queued);
+  EXPECT_EQ(sender.submit(MessageClass::Cancel, 102, now, send),
+            Admission::Queued);
+  EXPECT_EQ(sender.pending(MessageClass::Order), 2U);
+  EXPECT_EQ(sender.pending(MessageClass::Cancel), 1U);
+
+  // 一個 token：刪單先送
+  now += 100;
+  EXPECT_EQ(sender.drain(now, send), 1U);
+  EXPECT_EQ(sent.back(), 102);
+
+  // 之後依序補送新單
+  for (int i = 0; i < 4; ++i) {
+    now += 100;
+    (void)sender.drain(now, send);
+  }
+  EXPECT_EQ(sent, (std::vector<int>{1, 101, 102, 2, 3}));
+  EXPECT_EQ(sender.pending(MessageClass::Order), 0U);
+}
+
+TEST(ThrottledSenderTest, QueuedMessagesAreNotOvertaken) {
+  ThrottleState state;
+  ThrottledSender<int, 4> sender(
+      Throttle(state, {.interval = 100, .burst = 1, .cancel_reserve = 0}),
+      OverflowPolicy::Queue);
+  std::vector<int> sent;
+  auto send = [&](int msg) { sent.push_back(msg); };
+
+  EXPECT_EQ(sender.submit(MessageClass::Order, 1, 0, send), Admission::Sent);
+  EXPECT_EQ(sender.submit(MessageClass::Order, 2, 0, send),
+            Admission::Queued);
+  // token 已補充，但佇列中還有 2：3 必須排在後面
+  EXPECT_EQ(sender.submit(MessageClass::Order, 3, 100, send),
+            Admission::Queued);
+  for (int i = 4; i < 6; ++i) {
+    EXPECT_EQ(sender.submit(MessageClass::Order, i, 100, send),
+              Admission::Queued);
+  }
+  EXPECT_EQ(sender.submit(MessageClass::Order, 6, 100, send),
+            Admission::Rejected);  // 佇列已滿
+
+  for (uint64_t now = 100; now <= 1000; now += 100) {
+    (void)sender.drain(now, send);
+  }
+  EXPECT_EQ(sent, (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(ThrottleConfigTest, PerSecondUsesClockUnits) {
+  const auto config =
+      ThrottleConfig::per_second<sys::SimulatedClock>(250, 50, 5);
+  EXPECT_EQ(config.interval, 4'000'000U);
+  EXPECT_EQ(config.burst, 50U);
+  EXPECT_EQ(config.cancel_reserve, 5U);
+}
+
+}  // namespace tx::gateway::test
@@ -0,0 +1,222 @@
+#include "tx/io/reconnecting_client.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include "tx/io/reactor.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/tcp_socket.hpp"
+#include "tx/sys/tsc_timer.hpp"
+
+namespace tx::io::test {
+
+using namespace std::chrono_literals;
+
+/// @brief 取得一個目前沒有人監聽的本機地址
+SocketAddress unused_local_address() {
+  auto addr = SocketAddress::from_ipv4("127.0.0.1", 0).value();
+  auto listener = TcpSocket::serve(addr).value();
+  return listener.local_address().value();
+}
+
+// =============================
+// ExponentialBackoff
+// =============================
+
+TEST(ExponentialBackoffTest, GrowsAndCapsWithoutJitter) {
+  ReconnectPolicy policy{.initial_backoff = 100ms,
+                         .max_backoff = 1s,
+                         .multiplier = 2,
+                         .jitter = 0.0,
+                         .seed = 42};
+  ExponentialBackoff backoff(policy);
+
+  EXPECT_EQ(backoff.next(), 100ms);
+  EXPECT_EQ(backoff.next(), 200ms);
+  EXPECT_EQ(backoff.next(), 400ms);
+  EXPECT_EQ(backoff.next(), 800ms);
+  EXPECT_EQ(backoff.next(), 1s);
+  EXPECT_EQ(backoff.next(), 1s);
+  EXPECT_EQ(backoff.attempts(), 6u);
+
+  backoff.reset();
+  EXPECT_EQ(backoff.attempts(), 0u);
+  EXPECT_EQ(backoff.next(), 100ms);
+}
+
+TEST(ExponentialBackoffTest, JitterStaysWithinBounds) {
+  ReconnectPolicy policy{.initial_backoff = 1s,
+                         .max_backoff = 1s,
+                         .jitter = 0.5,
+                         .seed = 7};
+  ExponentialBackoff backoff(policy);
+
+  std::vector<std::chrono::nanoseconds> delays;
+  for (int i = 0; i < 1000; ++i) {
+    auto d = backoff.next();
+    EXPECT_GE(d, 500ms);
+    EXPECT_LE(d, 1s);
+    delays.push_back(d);
+  }
+
+  // 確實有隨機分散 (不是全部相同)
+  auto [min_it, max_it] = std::minmax_element(delays.begin(), delays.end());
+  EXPECT_GT(*max_it - *min_it, 250ms);
+}
+
+TEST(ExponentialBackoffTest, SameSeedIsDeterministic) {
+  ReconnectPolicy policy{.seed = 12345};
+  ExponentialBackoff a(policy);
+  ExponentialBackoff b(policy);
+  for (int i = 0; i < 10; ++i) {
+    EXPECT_EQ(a.next(), b.next());
+  }
+}
+
+// =============================
+// TcpSocket::connect (有期限)
+// =============================
+
+class TcpConnectTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    sys::TSCTimer::calibrate(std::chrono::milliseconds(10));
+  }
+};
+
+TEST_F(TcpConnectTest, ConnectWithTimeoutSucceeds) {
+  auto addr = SocketAddress::from_ipv4("127.0.0.1", 0).value();
+  auto server = TcpSocket::serve(addr).value();
+
+  auto client = TcpSocket::connect(server.local_address().value(), 1s);
+  ASSERT_TRUE(client.has_value());
+  auto peer = server.accept();
+  EXPECT_TRUE(peer.has_value());
+}
+
+TEST_F(TcpConnectTest, ConnectWithTimeoutRefused) {
+  auto client = TcpSocket::connect(unused_local_address(), 1s);
+  ASSERT_FALSE(client.has_value());
+  EXPECT_EQ(client.error().value(), ECONNREFUSED);
+}
+
+TEST_F(TcpConnectTest, StartConnectReturnsImmediately) {
+  auto addr = SocketAddress::from_ipv4("127.0.0.1", 0).value();
+  auto server = TcpSocket::serve(addr).value();
+
+  auto client = TcpSocket::start_connect(server.local_address().value());
+  ASSERT_TRUE(client.has_value());
+  EXPECT_TRUE(client->is_valid());
+}
+
+// =============================
+// ReconnectingClient
+// =============================
+
+struct RecordingHandler {
+  int connected{0};
+  int disconnected{0};
+  std::vector<std::error_code> failures;
+  std::vector<std::chrono::nanoseconds> delays;
+
+  void on_connected(TcpSocket& socket) {
+    EXPECT_TRUE(socket.is_valid());
+    ++connected;
+  }
+  void on_disconnected(std::error_code) { ++disconnected; }
+  void on_connect_failed(std::error_code ec, uint32_t attempt,
+                         std::chrono::nanoseconds retry_in) {
+    EXPECT_EQ(attempt, failures.size() + 1);
+    failures.push_back(ec);
+    delays.push_back(retry_in);
+  }
+};
+
+using State = ReconnectingClient<RecordingHandler>::State;
+
+class ReconnectingClientTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    sys::TSCTimer::calibrate(std::chrono::milliseconds(10));
+  }
+
+  Reactor reactor_ = Reactor::create().value();
+  RecordingHandler handler_;
+
+  template <typename Pred>
+  bool poll_until(Pred pred, std::chrono::milliseconds limit = 2s) {
+    auto deadline = std::chrono::steady_clock::now() + limit;
+    while (!pred()) {
+      if (std::chrono::steady_clock::now() > deadline) return false;
+      EXPECT_TRUE(reactor_.poll(1).has_value());
+    }
+    return true;
+  }
+};
+
+TEST_F(ReconnectingClientTest, ConnectsWithoutBlocking) {
+  auto addr = SocketAddress::from_ipv4("127.0.0.1", 0).value();
+  auto server = TcpSocket::serve(addr).value();
+
+  ReconnectingClient client(reactor_, handler_,
+                            server.local_address().value());
+  client.start();
+  EXPECT_EQ(client.state(), State::Connecting);
+  EXPECT_EQ(client.socket(), nullptr);
+
+  ASSERT_TRUE(poll_until([&] { return client.is_connected(); }));
+  EXPECT_EQ(handler_.connected, 1);
+  EXPECT_TRUE(handler_.failures.empty());
+  ASSERT_NE(client.socket(), nullptr);
+}
+
+TEST_F(ReconnectingClientTest, RetriesWithBackoffWhileRefused) {
+  ReconnectPolicy policy{.initial_backoff = 1ms,
+                         .max_backoff = 4ms,
+                         .jitter = 0.0,
+                         .seed = 1};
+  ReconnectingClient client(reactor_, handler_, unused_local_address(),
+                            policy);
+  client.start();
+
+  ASSERT_TRUE(poll_until([&] { return handler_.failures.size() >= 4; }));
+  for (const auto& ec : handler_.failures) {
+    EXPECT_EQ(ec.value(), ECONNREFUSED);
+  }
+  EXPECT_EQ(handler_.delays[0], 1ms);
+  EXPECT_EQ(handler_.delays[1], 2ms);
+  EXPECT_EQ(handler_.delays[2], 4ms);
+  EXPECT_EQ(handler_.delays[3], 4ms);
+  EXPECT_EQ(handler_.connected, 0);
+
+  client.stop();
+  EXPECT_EQ(client.state(), State::Idle);
+  EXPECT_FALSE(reactor_.has_pending());
+}
+
+TEST_F(ReconnectingClientTest, ReconnectsAfterDisconnect) {
+  auto addr = SocketAddress::from_ipv4("127.0.0.1", 0).value();
+  auto server = TcpSocket::serve(addr).value();
+
+  ReconnectPolicy policy{.initial_backoff = 1ms, .jitter = 0.0};
+  ReconnectingClient client(reactor_, handler_,
+                            server.local_address().value(), policy);
+  client.start();
+  ASSERT_TRUE(poll_until([&] { return client.is_connected(); }));
+
+  client.disconnect(std::make_error_code(std::errc::connection_reset));
+  EXPECT_EQ(handler_.disconnected, 1);
+  EXPECT_EQ(client.state(), State::Backoff);
+
+  ASSERT_TRUE(poll_until([&] { return handler_.connected == 2; }));
+  EXPECT_TRUE(client.is_connected());
+  EXPECT_EQ(client.attempts(), 0u);
+}
+
+}  // namespace tx::io::test
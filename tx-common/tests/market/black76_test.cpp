@@ -0,0 +1,240 @@
+#include "tx/market/black76.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "tx/simd/cpu_features.hpp"
+
+namespace tx::market::test {
+
+namespace {
+
+constexpr simd::Isa kVectorIsas[] = {simd::Isa::Avx2, simd::Isa::Avx512};
+
+/// @brief 價平附近的 TXO 履約價 (tick)，長度刻意不是 8 的倍數
+std::vector<int32_t> strike_ladder() {
+  std::vector<int32_t> strikes;
+  for (int32_t k = 18000; k <= 26000; k += 100) {
+    strikes.push_back(k * 100);
+  }
+  return strikes;
+}
+
+/// @brief 帶有 smile 的波動率
+std::vector<double> smile(const std::vector<int32_t>& strikes,
+                          double forward) {
+  std::vector<double> vols;
+  for (int32_t k : strikes) {
+    const double m = std::log(static_cast<double>(k) / forward);
+    vols.push_back(0.18 + 0.6 * m * m - 0.05 * m);
+  }
+  return vols;
+}
+
+struct Surface {
+  std::vector<double> price;
+  std::vector<double> delta;
+  std::vector<double> gamma;
+  std::vector<double> vega;
+
+  explicit Surface(size_t n) : price(n), delta(n), gamma(n), vega(n) {}
+
+  [[nodiscard]] GreeksOut out() noexcept {
+    return {.price = price.data(),
+            .delta = delta.data(),
+            .gamma = gamma.data(),
+            .vega = vega.data()};
+  }
+};
+
+void expect_close(double actual, double expected, double tolerance) {
+  EXPECT_NEAR(actual, expected,
+              tolerance * std::max(1.0, std::abs(expected)));
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// Scalar 參考實作
+// ----------------------------------------------------------------------------
+
+TEST(Black76Test, ScalarMatchesClosedForm) {
+  // F = K = 100, T = 1, sigma = 20%, r = 0：
+  // C = F (2 N(0.1) - 1)，delta = N(0.1)，vega = F n(0.1)
+  const int32_t strike = 100;
+  const double vol = 0.2;
+  double price = 0;
+  double delta = 0;
+  double vega = 0;
+  const auto scalar = kernels::black76_greeks.variant(simd::Isa::Scalar);
+  scalar({.forward = 100.0, .expiry = 1.0}, &strike, &vol,
+         {.price = &price, .delta = &delta, .vega = &vega}, 1);
+
+  EXPECT_NEAR(price, 7.965567455405804, 1e-12);
+  EXPECT_NEAR(delta, 0.539827837277029, 1e-12);
+  EXPECT_NEAR(vega, 39.69525474770118, 1e-10);
+}
+
+TEST(Black76Test, PutCallParity) {
+  const auto strikes = strike_ladder();
+  const double forward = 2'215'000;
+  const auto vols = smile(strikes, forward);
+  const size_t n = strikes.size();
+  Surface calls(n);
+  Surface puts(n);
+  const BlackParams params{.forward = forward, .expiry = 0.08,
+                           .discount = 0.998};
+  BlackParams put_params = params;
+  put_params.type = OptionType::Put;
+  black76_greeks(params, strikes, vols, calls.out());
+  black76_greeks(put_params, strikes, vols, puts.out());
+
+  for (size_t i = 0; i < n; ++i) {
+    // C - P = df (F - K)
+    expect_close(calls.price[i] - puts.price[i],
+                 params.discount * (forward - strikes[i]), 1e-9);
+    expect_close(calls.delta[i] - puts.delta[i], params.discount, 1e-12);
+    expect_close(calls.gamma[i], puts.gamma[i], 1e-12);
+    expect_close(calls.vega[i], puts.vega[i], 1e-12);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// 向量版本 vs. scalar
+// ----------------------------------------------------------------------------
+
+TEST(Black76Test, VectorGreeksMatchScalar) {
+  const auto strikes = strike_ladder();
+  const double forward = 2'215'000;
+  const auto vols = smile(strikes, forward);
+  const size_t n = strikes.size();
+  const auto scalar = kernels::black76_greeks.variant(simd::Isa::Scalar);
+
+  for (OptionType type : {OptionType::Call, OptionType::Put}) {
+    const BlackParams params{.forward = forward, .expiry = 0.05,
+                             .discount = 0.999, .type = type};
+    Surface expected(n);
+    scalar(params, strikes.data(), vols.data(), expected.out(), n);
+
+    for (simd::Isa isa : kVectorIsas) {
+      const auto fn = kernels::black76_greeks.variant(isa);
+      if (fn == nullptr) continue;
+      SCOPED_TRACE(simd::to_string(isa));
+      Surface actual(n);
+      fn(params, strikes.data(), vols.data(), actual.out(), n);
+      for (size_t i = 0; i < n; ++i) {
+        // 價格以 forward 為尺度比較 (深價外的價格接近 0)
+        EXPECT_NEAR(actual.price[i], expected.price[i], forward * 1e-13);
+        EXPECT_NEAR(actual.delta[i], expected.delta[i], 1e-13);
+        expect_close(actual.gamma[i], expected.gamma[i], 1e-11);
+        expect_close(actual.vega[i], expected.vega[i], 1e-11);
+      }
+    }
+  }
+}
+
+TEST(Black76Test, NullOutputsAreSkipped) {
+  const auto strikes = strike_ladder();
+  const std::vector<double> vols(strikes.size(), 0.2);
+  std::vector<double> delta(strikes.size(), -1.0);
+
+  for (simd::Isa isa : {simd::Isa::Scalar, simd::Isa::Avx2,
+                        simd::Isa::Avx512}) {
+    const auto fn = kernels::black76_greeks.variant(isa);
+    if (fn == nullptr) continue;
+    fn({.forward = 2'200'000, .expiry = 0.1}, strikes.data(), vols.data(),
+       {.delta = delta.data()}, strikes.size());
+    EXPECT_GT(delta.front(), 0.99);
+    EXPECT_LT(delta.back(), 0.01);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// 隱含波動率
+// ----------------------------------------------------------------------------
+
+TEST(Black76Test, ImpliedVolRoundTrip) {
+  const auto strikes = strike_ladder();
+  const double forward = 2'215'000;
+  const auto vols = smile(strikes, forward);
+  const size_t n = strikes.size();
+
+  for (OptionType type : {OptionType::Call, OptionType::Put}) {
+    const BlackParams params{.forward = forward, .expiry = 0.05,
+                             .discount = 0.999, .type = type};
+    std::vector<double> prices(n);
+    kernels::black76_greeks.variant(simd::Isa::Scalar)(
+        params, strikes.data(), vols.data(), {.price = prices.data()}, n);
+
+    for (simd::Isa isa : {simd::Isa::Scalar, simd::Isa::Avx2,
+                          simd::Isa::Avx512}) {
+      const auto fn = kernels::black76_implied_vol.variant(isa);
+      if (fn == nullptr) continue;
+      SCOPED_TRACE(simd::to_string(isa));
+      std::vector<double> implied(n);
+      fn(params, strikes.data(), prices.data(), implied.data(), n);
+      for (size_t i = 0; i < n; ++i) {
+        // 時間價值極小 (深價內 / 深價外) 時價格的有效位數不足，放寬誤差
+        const double sign = type == OptionType::Call ? 1.0 : -1.0;
+        const double intrinsic = std::max(
+            sign * params.discount * (forward - strikes[i]), 0.0);
+        const double time_value = (prices[i] - intrinsic) / forward;
+        const double tolerance = time_value > 1e-6 ? 1e-8 : 1e-4;
+        EXPECT_NEAR(implied[i], vols[i], tolerance) << "strike " << strikes[i];
+      }
+    }
+  }
+}
+
+TEST(Black76Test, ImpliedVolWarmStart) {
+  const auto strikes = strike_ladder();
+  const size_t n = strikes.size();
+  const auto vols = smile(strikes, 2'215'000);
+  const auto scalar = kernels::black76_greeks.variant(simd::Isa::Scalar);
+
+  // 上一個 tick 的解作為起點，標的移動後結果應與冷啟動相同
+  BlackParams params{.forward = 2'215'000, .expiry = 0.05};
+  std::vector<double> prices(n);
+  scalar(params, strikes.data(), vols.data(), {.price = prices.data()}, n);
+  std::vector<double> previous(n, 0.0);
+  black76_implied_vol(params, strikes, prices, previous);
+
+  params.forward += 1'500;
+  scalar(params, strikes.data(), vols.data(), {.price = prices.data()}, n);
+  std::vector<double> cold(n, 0.0);
+  black76_implied_vol(params, strikes, prices, cold);
+  std::vector<double> warm = previous;
+  black76_implied_vol(params, strikes, prices, warm);
+
+  for (size_t i = 0; i < n; ++i) {
+    EXPECT_NEAR(warm[i], cold[i], 1e-9) << "strike " << strikes[i];
+  }
+}
+
+TEST(Black76Test, ImpliedVolRejectsArbitrage) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const BlackParams params{.forward = 100.0, .expiry = 0.25};
+  const std::vector<int32_t> strikes = {90, 100, 110, 100, 100};
+  // 低於內含價值、等於 0、超過上限、NaN (缺報價)、正常
+  const std::vector<double> prices = {9.5, 0.0, 100.0, nan, 4.0};
+
+  for (simd::Isa isa : {simd::Isa::Scalar, simd::Isa::Avx2,
+                        simd::Isa::Avx512}) {
+    const auto fn = kernels::black76_implied_vol.variant(isa);
+    if (fn == nullptr) continue;
+    SCOPED_TRACE(simd::to_string(isa));
+    std::vector<double> vols(strikes.size());
+    fn(params, strikes.data(), prices.data(), vols.data(), strikes.size());
+    EXPECT_TRUE(std::isnan(vols[0]));
+    EXPECT_TRUE(std::isnan(vols[1]));
+    EXPECT_TRUE(std::isnan(vols[2]));
+    EXPECT_TRUE(std::isnan(vols[3]));
+    EXPECT_NEAR(vols[4], 0.2005, 1e-3);
+  }
+}
+
+}  // namespace tx::market::test
@@ -0,0 +1,215 @@
+#include "tx/market/indicators.hpp"
+
+#include <gtest/gtest.h>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/net/taifex/parser.hpp"
+
+namespace tx::market::test {
+
+using net::taifex::test::make_r06;
+
+namespace {
+
+net::taifex::ParsedR06Snapshot parse(
+    const net::taifex::R06SnapshotWire& wire) {
+  auto r = net::taifex::parse_r06_snapshot(std::as_bytes(std::span(&wire, 1)));
+  EXPECT_TRUE(r);
+  return *r;
+}
+
+net::taifex::ParsedR02Trade trade(uint32_t qty, uint64_t match_time) {
+  net::taifex::ParsedR02Trade t{};
+  t.match_price = 100;
+  t.match_qty = qty;
+  t.match_time = match_time;
+  return t;
+}
+
+}  // namespace
+
+TEST(IndicatorsTest, RingWindowOverwritesOldest) {
+  RingWindow<int, 4> window;
+  EXPECT_TRUE(window.empty());
+  for (int i = 1; i <= 6; ++i) window.push(i);
+
+  EXPECT_TRUE(window.full());
+  EXPECT_EQ(window.front(), 3);
+  EXPECT_EQ(window.back(), 6);
+  EXPECT_EQ(window[1], 4);
+
+  window.pop_front();
+  EXPECT_EQ(window.size(), 3U);
+  EXPECT_EQ(window.front(), 4);
+}
+
+TEST(IndicatorsTest, EmaConvergesWithIntegerUpdates) {
+  Ema<2> ema;  // alpha = 1/4
+  EXPECT_FALSE(ema.primed());
+  ema.update(Fixed::from_int(100));
+  EXPECT_TRUE(ema.primed());
+  EXPECT_EQ(ema.value(), Fixed::from_int(100));
+
+  ema.update(Fixed::from_int(104));
+  EXPECT_EQ(ema.value(), Fixed::from_int(101));
+  ema.update(Fixed::from_int(97));
+  EXPECT_EQ(ema.value(), Fixed::from_int(100));
+}
+
+TEST(IndicatorsTest, RollingVarianceTracksWindow) {
+  RollingVariance<4> var;
+  for (int64_t x : {1, 2, 3, 4}) var.update(x);
+  EXPECT_EQ(var.mean().to_double(), 2.5);
+  EXPECT_EQ(var.variance().to_double(), 1.25);
+
+  // 移出 1、加入 5：{2, 3, 4, 5}
+  var.update(5);
+  EXPECT_EQ(var.count(), 4);
+  EXPECT_EQ(var.mean().to_double(), 3.5);
+  EXPECT_EQ(var.variance().to_double(), 1.25);
+}
+
+TEST(IndicatorsTest, MicropriceAndImbalance) {
+  OrderBook book;
+  Microprice micro;
+  BookImbalance<1> top;
+  BookImbalance<2> two;
+
+  micro.on_book(book);
+  EXPECT_FALSE(micro.valid());
+
+  book.apply(parse(make_r06("TXFC6", {{100, 3, 1}, {99, 5, 1}},
+                            {{102, 1, 1}, {103, 1, 1}})));
+  micro.on_book(book);
+  top.on_book(book);
+  two.on_book(book);
+
+  // (100 * 1 + 102 * 3) / 4 = 101.5
+  ASSERT_TRUE(micro.valid());
+  EXPECT_EQ(micro.value().to_double(), 101.5);
+  EXPECT_EQ(top.value().to_double(), 0.5);          // (3 - 1) / 4
+  EXPECT_NEAR(two.value().to_double(), 0.6, 1e-4);  // (8 - 2) / 10
+
+  // 只有第二檔變動：top-of-book 指標不重算
+  book.apply(parse(make_r06("TXFC6", {{100, 3, 1}, {99, 1, 1}},
+                            {{102, 1, 1}, {103, 1, 1}})));
+  top.on_book(book);
+  two.on_book(book);
+  EXPECT_EQ(top.value().to_double(), 0.5);
+  EXPECT_NEAR(two.value().to_double(), 1.0 / 3.0, 1e-4);
+
+  book.apply(parse(make_r06("TXFC6", {{100, 3, 1}}, {})));
+  micro.on_book(book);
+  EXPECT_FALSE(micro.valid());
+}
+
+TEST(IndicatorsTest, MidEmaAndVarianceIgnoreDeeperLevels) {
+  OrderBook book;
+  MidEma<1> ema;
+  MidVariance<8> var;
+  auto feed = [&](int32_t bid, int32_t ask, uint32_t deep_qty) {
+    book.apply(
+        parse(make_r06("TXFC6", {{bid, 1, 1}, {bid - 1, deep_qty, 1}},
+                       {{ask, 1, 1}})));
+    ema.on_book(book);
+    var.on_book(book);
+  };
+
+  feed(100, 101, 1);
+  EXPECT_EQ(ema.value().to_double(), 100.5);
+  feed(100, 101, 2);  // 第二檔變動
+  feed(101, 102, 2);  // 中價 +1
+  EXPECT_EQ(ema.value().to_double(), 101.0);
+  feed(100, 102, 2);  // 中價 -0.5
+  EXPECT_EQ(ema.value().to_double(), 101.0);
+
+  // 變動 {+1, -0.5}：mean 0.25、variance 0.5625
+  EXPECT_EQ(var.count(), 2);
+  EXPECT_EQ(var.value().to_double(), 0.5625);
+}
+
+TEST(IndicatorsTest, TradeIntensityExpiresByClock) {
+  using Intensity = TradeIntensity<4, sys::SimulatedClock>;
+  constexpr uint64_t kMs = 1'000'000;
+  sys::SimulatedClock::set(1000 * kMs);
+
+  Intensity intensity(1000 * kMs);  // 1 秒
+  intensity.on_trade(trade(2, 90000'000000));
+  sys::SimulatedClock::advance(400 * kMs);
+  intensity.on_trade(trade(3, 90000'400000));
+  sys::SimulatedClock::advance(500 * kMs);
+  intensity.on_trade(trade(1, 90000'900000));
+  EXPECT_EQ(intensity.trades(), 3);
+  EXPECT_EQ(intensity.volume(), 6);
+  EXPECT_EQ(intensity.rate(), Fixed::from_int(3));
+
+  // +1 秒 -> 第一筆過期
+  sys::SimulatedClock::advance(100 * kMs);
+  intensity.on_trade(trade(4, 90001'000000));
+  EXPECT_EQ(intensity.trades(), 3);
+  EXPECT_EQ(intensity.volume(), 8);
+
+  // 超過容量：最舊的提早移出
+  sys::SimulatedClock::advance(100 * kMs);
+  intensity.on_trade(trade(1, 90001'100000));
+  sys::SimulatedClock::advance(100 * kMs);
+  intensity.on_trade(trade(1, 90001'200000));
+  EXPECT_EQ(intensity.trades(), 4);
+  EXPECT_EQ(intensity.volume(), 7);
+}
+
+TEST(IndicatorsTest, TradeIntensityCrossesMidnight) {
+  using Intensity = TradeIntensity<8, sys::SimulatedClock>;
+  constexpr uint64_t kMs = 1'000'000;
+  sys::SimulatedClock::set(5000 * kMs);
+
+  // 夜盤：match_time 於午夜歸零，視窗仍依時鐘移出
+  Intensity intensity(1000 * kMs);
+  intensity.on_trade(trade(2, 235959'500000));
+  sys::SimulatedClock::advance(600 * kMs);
+  intensity.on_trade(trade(3, 100000));
+  EXPECT_EQ(intensity.trades(), 2);
+
+  sys::SimulatedClock::advance(600 * kMs);
+  intensity.on_trade(trade(1, 700000));
+  EXPECT_EQ(intensity.trades(), 2);
+  EXPECT_EQ(intensity.volume(), 4);
+}
+
+TEST(IndicatorsTest, TradeIntensityDecaysWhenQuiet) {
+  using Intensity = TradeIntensity<8, sys::SimulatedClock>;
+  constexpr uint64_t kMs = 1'000'000;
+  sys::SimulatedClock::set(0);
+
+  Intensity intensity(1000 * kMs);
+  intensity.on_trade(trade(5, 90000'000000));
+  sys::SimulatedClock::advance(500 * kMs);
+  intensity.on_trade(trade(5, 90000'500000));
+
+  intensity.expire(sys::SimulatedClock::now() + 600 * kMs);
+  EXPECT_EQ(intensity.trades(), 1);
+  EXPECT_EQ(intensity.volume(), 5);
+
+  // 之後沒有成交：視窗清空，rate 歸零
+  intensity.expire(sys::SimulatedClock::now() + 5000 * kMs);
+  EXPECT_EQ(intensity.trades(), 0);
+  EXPECT_EQ(intensity.volume(), 0);
+  EXPECT_EQ(intensity.rate(), Fixed{});
+}
+
+TEST(IndicatorsTest, StackDispatchesToEachIndicator) {
+  using Intensity = TradeIntensity<8, sys::SimulatedClock>;
+  IndicatorStack<Microprice, BookImbalance<>, Intensity> stack(
+      Microprice{}, BookImbalance<>{}, Intensity(1'000'000'000));
+
+  OrderBook book;
+  book.apply(parse(make_r06("TXFC6", {{100, 1, 1}}, {{101, 1, 1}})));
+  stack.on_book(book);
+  stack.on_trade(trade(5, 90000'000000));
+
+  EXPECT_EQ(stack.get<Microprice>().value().to_double(), 100.5);
+  EXPECT_EQ(stack.get<1>().value(), Fixed{});
+  EXPECT_EQ(stack.get<Intensity>().volume(), 5);
+}
+
+}  // namespace tx::market::test
@@ -0,0 +1,131 @@
+#include "tx/market/options_chain.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/net/taifex/parser.hpp"
+
+namespace tx::market::test {
+
+using net::taifex::test::make_r06;
+
+namespace {
+
+net::taifex::ParsedR06Snapshot parse(
+    const net::taifex::R06SnapshotWire& wire) {
+  auto r = net::taifex::parse_r06_snapshot(std::as_bytes(std::span(&wire, 1)));
+  EXPECT_TRUE(r);
+  return *r;
+}
+
+std::array<core::Price, 3> strikes(int64_t first) {
+  return {core::Price::from_points(static_cast<double>(first)),
+          core::Price::from_points(static_cast<double>(first + 100)),
+          core::Price::from_points(static_cast<double>(first + 200))};
+}
+
+}  // namespace
+
+TEST(OptionsChainTest, ExpiriesAreLaidOutContiguously) {
+  OptionsChain chain(8);
+  auto near = chain.add_expiry(202603, strikes(22000));
+  auto far = chain.add_expiry(202604, strikes(21900));
+  ASSERT_TRUE(near && far);
+
+  EXPECT_EQ(chain.expiry_count(), 2U);
+  EXPECT_EQ(chain.slot_count(), 6U);
+  EXPECT_EQ(chain.expiry_begin(*far), 3U);
+  EXPECT_EQ(chain.contract_month(*far), 202604U);
+  ASSERT_EQ(chain.strikes(*far).size(), 3U);
+  EXPECT_EQ(chain.strikes(*far)[1], 2'200'000);
+  EXPECT_EQ(chain.quotes(OptionType::Call).bid_px.size(), 6U);
+  EXPECT_EQ(chain.quotes(OptionType::Put).ask_qty.size(), 6U);
+}
+
+TEST(OptionsChainTest, RejectsInvalidSetup) {
+  OptionsChain chain(2);
+  EXPECT_FALSE(chain.add_expiry(202603, {}));
+
+  std::array unsorted{core::Price::from_points(22100),
+                      core::Price::from_points(22000)};
+  EXPECT_FALSE(chain.add_expiry(202603, unsorted));
+
+  auto expiry = chain.add_expiry(202603, strikes(22000));
+  ASSERT_TRUE(expiry);
+  EXPECT_FALSE(chain.bind(0, {.expiry = *expiry,
+                              .strike = 3,
+                              .type = OptionType::Call}));
+  EXPECT_FALSE(chain.bind(0, {.expiry = 1, .strike = 0,
+                              .type = OptionType::Call}));
+  EXPECT_FALSE(chain.bind(2, {.expiry = *expiry,
+                              .strike = 0,
+                              .type = OptionType::Call}));
+}
+
+TEST(OptionsChainTest, ApplyUpdatesBoundSlot) {
+  OptionsChain chain(4);
+  auto expiry = chain.add_expiry(202603, strikes(22000));
+  ASSERT_TRUE(expiry);
+  const OptionKey put{.expiry = *expiry, .strike = 1, .type = OptionType::Put};
+  ASSERT_TRUE(chain.bind(2, put));
+
+  auto key = chain.key_of(2);
+  ASSERT_TRUE(key);
+  EXPECT_EQ(key->strike, 1U);
+  EXPECT_EQ(key->type, OptionType::Put);
+  EXPECT_FALSE(chain.key_of(0));
+
+  auto snap = parse(make_r06("TXO22100O6", {{15000, 3, 1}, {14900, 4, 1}},
+                             {{15200, 5, 2}}, 15100, 1, 42));
+  EXPECT_TRUE(chain.apply(2, snap));
+  EXPECT_FALSE(chain.apply(2, snap));  // 最佳一檔未變
+  EXPECT_FALSE(chain.apply(0, snap));  // 未 bind
+
+  const auto top = chain.top(put);
+  EXPECT_EQ(top.bid, core::Price::from_ticks(15000));
+  EXPECT_EQ(top.ask, core::Price::from_ticks(15200));
+  EXPECT_EQ(top.bid_qty, core::Quantity::from_value(3));
+  EXPECT_EQ(top.ask_qty, core::Quantity::from_value(5));
+  EXPECT_EQ(chain.cold(put).last_price, core::Price::from_ticks(15100));
+  EXPECT_EQ(chain.cold(put).total_volume, 42U);
+
+  // 買權同一履約價不受影響
+  const auto call = chain.top({.expiry = *expiry,
+                               .strike = 1,
+                               .type = OptionType::Call});
+  EXPECT_EQ(call.bid, core::Price::invalid());
+  EXPECT_EQ(call.bid_qty, core::Quantity::zero());
+
+  // 賣方撤光：ask 側變為無報價
+  EXPECT_TRUE(chain.apply(2, parse(make_r06("TXO22100O6", {{15000, 3, 1}},
+                                            {}))));
+  EXPECT_EQ(chain.top(put).ask, core::Price::invalid());
+}
+
+TEST(OptionsChainTest, MidPricesSweep) {
+  OptionsChain chain(3);
+  auto expiry = chain.add_expiry(202603, strikes(22000));
+  ASSERT_TRUE(expiry);
+  for (uint32_t i = 0; i < 3; ++i) {
+    ASSERT_TRUE(chain.bind(i, {.expiry = *expiry,
+                               .strike = i,
+                               .type = OptionType::Call}));
+  }
+  chain.apply(0, parse(make_r06("A", {{300, 1, 1}}, {{310, 1, 1}})));
+  chain.apply(1, parse(make_r06("B", {{200, 1, 1}}, {})));
+  chain.apply(2, parse(make_r06("C", {{101, 1, 1}}, {{104, 2, 1}})));
+
+  std::array<double, 3> mids{};
+  chain.mid_prices(OptionType::Call, *expiry, mids);
+  EXPECT_DOUBLE_EQ(mids[0], 305.0);
+  EXPECT_TRUE(std::isnan(mids[1]));
+  EXPECT_DOUBLE_EQ(mids[2], 102.5);
+
+  chain.mid_prices(OptionType::Put, *expiry, mids);
+  EXPECT_TRUE(std::isnan(mids[0]));
+}
+
+}  // namespace tx::market::test
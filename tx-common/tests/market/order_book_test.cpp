@@ -0,0 +1,146 @@
+#include "tx/market/order_book.hpp"
+
+#include <gtest/gtest.h>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/market/instrument_registry.hpp"
+#include "tx/net/taifex/packet_iterator.hpp"
+
+namespace tx::market::test {
+
+using net::taifex::test::make_r02;
+using net::taifex::test::make_r06;
+using net::taifex::test::PacketBuilder;
+
+// ----------------------------------------------------------------------------
+// InstrumentRegistry
+// ----------------------------------------------------------------------------
+
+TEST(InstrumentRegistryTest, AddAndFindByWireId) {
+  InstrumentRegistry<4> reg;
+  auto tx = reg.add("TXFC6");
+  auto mx = reg.add("MXFC6");
+  ASSERT_TRUE(tx && mx);
+  EXPECT_EQ(*tx, 0U);
+  EXPECT_EQ(*mx, 1U);
+
+  auto again = reg.add("TXFC6");
+  ASSERT_TRUE(again);
+  EXPECT_EQ(*again, *tx);
+  EXPECT_EQ(reg.size(), 2U);
+
+  char wire[kProdIdSize];
+  std::memset(wire, ' ', sizeof(wire));
+  std::memcpy(wire, "MXFC6", 5);
+  EXPECT_EQ(reg.find_wire(wire), *mx);
+  EXPECT_EQ(reg.find("TXFC6"), *tx);
+  EXPECT_FALSE(reg.find("TEFC6").has_value());
+  EXPECT_EQ(reg.symbol(*mx), "MXFC6");
+}
+
+TEST(InstrumentRegistryTest, RejectsInvalidAndOverflow) {
+  InstrumentRegistry<2> reg;
+  EXPECT_FALSE(reg.add(""));
+  EXPECT_FALSE(reg.add("012345678901234567890"));
+  ASSERT_TRUE(reg.add("A"));
+  ASSERT_TRUE(reg.add("B"));
+
+  auto full = reg.add("C");
+  ASSERT_FALSE(full);
+  EXPECT_EQ(full.error(), std::errc::no_buffer_space);
+}
+
+// ----------------------------------------------------------------------------
+// PacketIterator
+// ----------------------------------------------------------------------------
+
+TEST(PacketIteratorTest, WalksAllMessages) {
+  auto packet = PacketBuilder(7)
+                    .add(make_r06("TXFC6", {{100, 1, 1}}, {{101, 2, 1}}))
+                    .add(make_r02("TXFC6", 100, 3))
+                    .build();
+
+  auto it = net::taifex::PacketIterator::from(packet);
+  ASSERT_TRUE(it) << it.error().message();
+  EXPECT_EQ(it->header().pkt_seq_num, 7U);
+  EXPECT_EQ(it->remaining(), 2);
+
+  auto first = it->next();
+  ASSERT_TRUE(first);
+  EXPECT_EQ(first->msg_type, '6');
+  EXPECT_EQ(first->bytes.size(), sizeof(net::taifex::R06SnapshotWire));
+
+  auto second = it->next();
+  ASSERT_TRUE(second);
+  EXPECT_EQ(second->msg_type, '2');
+
+  EXPECT_FALSE(it->next());
+}
+
+TEST(PacketIteratorTest, StopsOnBadMessageLength) {
+  auto r02 = make_r02("TXFC6", 100, 3);
+  r02.header.msg_length = htons(1000);
+  auto packet = PacketBuilder().add(r02).build();
+
+  auto it = net::taifex::PacketIterator::from(packet);
+  ASSERT_TRUE(it);
+  EXPECT_FALSE(it->next());
+  EXPECT_EQ(it->remaining(), 0);
+}
+
+// ----------------------------------------------------------------------------
+// OrderBook
+// ----------------------------------------------------------------------------
+
+net::taifex::ParsedR06Snapshot parse(
+    const net::taifex::R06SnapshotWire& wire) {
+  auto r = net::taifex::parse_r06_snapshot(std::as_bytes(std::span(&wire, 1)));
+  EXPECT_TRUE(r);
+  return *r;
+}
+
+TEST(OrderBookTest, FirstSnapshotMarksAllPresentLevels) {
+  OrderBook book;
+  auto mask = book.apply(parse(make_r06(
+      "TXFC6", {{100, 1, 1}, {99, 2, 1}}, {{101, 3, 2}}, 100, 1, 10)));
+
+  EXPECT_EQ(mask, OrderBook::bid_bit(0) | OrderBook::bid_bit(1) |
+                      OrderBook::ask_bit(0) | OrderBook::kTradeBit);
+  EXPECT_EQ(book.bid_depth(), 2U);
+  EXPECT_EQ(book.ask_depth(), 1U);
+  EXPECT_EQ(book.best_bid().price, core::Price::from_ticks(100));
+  EXPECT_EQ(book.best_ask().qty, core::Quantity::from_value(3));
+  EXPECT_EQ(book.total_volume(), 10U);
+}
+
+TEST(OrderBookTest, OnlyChangedLevelsAreMarked) {
+  OrderBook book;
+  book.apply(parse(make_r06("TXFC6", {{100, 1, 1}, {99, 2, 1}},
+                            {{101, 3, 2}}, 100, 1)));
+
+  auto mask = book.apply(parse(make_r06("TXFC6", {{100, 1, 1}, {99, 5, 2}},
+                                        {{101, 3, 2}}, 100, 1)));
+  EXPECT_EQ(mask, OrderBook::bid_bit(1));
+  EXPECT_EQ(book.changed_mask(), mask);
+
+  // 賣方第一檔消失
+  mask = book.apply(
+      parse(make_r06("TXFC6", {{100, 1, 1}, {99, 5, 2}}, {}, 100, 1)));
+  EXPECT_EQ(mask, OrderBook::ask_bit(0));
+  EXPECT_FALSE(book.best_ask().price.is_valid());
+}
+
+TEST(OrderBookTest, TradeUpdatesLastPrice) {
+  OrderBook book;
+  auto wire = make_r02("TXFC6", 123, 4, 50);
+  auto trade =
+      net::taifex::parse_r02_trade(std::as_bytes(std::span(&wire, 1)));
+  ASSERT_TRUE(trade);
+
+  EXPECT_EQ(book.apply(*trade), OrderBook::kTradeBit);
+  EXPECT_EQ(book.last_price(), core::Price::from_ticks(123));
+  EXPECT_EQ(book.last_qty(), core::Quantity::from_value(4));
+  EXPECT_EQ(book.total_volume(), 50U);
+}
+
+}  // namespace tx::market::test
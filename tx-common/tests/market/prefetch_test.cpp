@@ -0,0 +1,147 @@
+#include "tx/market/prefetch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/market/order_book.hpp"
+
+namespace tx::market::test {
+
+using net::taifex::test::make_r02;
+using net::taifex::test::make_r06;
+using net::taifex::test::PacketBuilder;
+
+namespace {
+
+struct Visit {
+  InstrumentId id;
+  char msg_type;
+};
+
+/// @brief 以指定的 Distance 走訪封包，記錄預取與處理的順序
+template <size_t Distance>
+std::vector<Visit> walk(const InstrumentRegistry<8>& reg,
+                        std::span<const std::byte> packet,
+                        std::vector<InstrumentId>* prefetched = nullptr) {
+  std::vector<Visit> visits;
+  auto it = net::taifex::PacketIterator::from(packet);
+  if (!it) {
+    ADD_FAILURE() << "invalid packet";
+    return visits;
+  }
+
+  for_each_prefetched<Distance>(
+      *it,
+      [&](const net::taifex::MessageView& msg) {
+        return resolve_instrument(reg, msg);
+      },
+      [&](InstrumentId id) {
+        if (prefetched) prefetched->push_back(id);
+      },
+      [&](const net::taifex::MessageView& msg, InstrumentId id) {
+        visits.push_back({id, msg.msg_type});
+      });
+  return visits;
+}
+
+}  // namespace
+
+class PrefetchTest : public ::testing::Test {
+ protected:
+  InstrumentRegistry<8> reg_;
+  std::vector<std::byte> packet_;
+
+  void SetUp() override {
+    ASSERT_TRUE(reg_.add("TXFC6"));
+    ASSERT_TRUE(reg_.add("MXFC6"));
+    ASSERT_TRUE(reg_.add("TEFC6"));
+
+    PacketBuilder builder(1);
+    builder.add(make_r06("TXFC6", {{100, 1, 1}}, {{101, 1, 1}}))
+        .add(make_r02("UNKNOWN", 100, 1))
+        .add(make_r06("MXFC6", {{200, 1, 1}}, {{201, 1, 1}}))
+        .add(make_r02("TXFC6", 100, 2))
+        .add(make_r06("TEFC6", {{300, 1, 1}}, {{301, 1, 1}}))
+        .add(make_r06("UNKNOWN", {{1, 1, 1}}, {}))
+        .add(make_r02("MXFC6", 200, 3));
+    packet_ = builder.build();
+  }
+
+  static void expect_in_order(const std::vector<Visit>& visits) {
+    ASSERT_EQ(visits.size(), 5U);
+    const InstrumentId ids[] = {0, 1, 0, 2, 1};
+    const char types[] = {'6', '6', '2', '6', '2'};
+    for (size_t i = 0; i < visits.size(); ++i) {
+      EXPECT_EQ(visits[i].id, ids[i]) << "index " << i;
+      EXPECT_EQ(visits[i].msg_type, types[i]) << "index " << i;
+    }
+  }
+};
+
+TEST_F(PrefetchTest, ProcessesInPacketOrderForAnyDistance) {
+  expect_in_order(walk<0>(reg_, packet_));
+  expect_in_order(walk<1>(reg_, packet_));
+  expect_in_order(walk<4>(reg_, packet_));
+  expect_in_order(walk<8>(reg_, packet_));
+}
+
+TEST_F(PrefetchTest, PrefetchesEachRegisteredMessageOnce) {
+  std::vector<InstrumentId> prefetched;
+  auto visits = walk<2>(reg_, packet_, &prefetched);
+  ASSERT_EQ(prefetched.size(), visits.size());
+  for (size_t i = 0; i < visits.size(); ++i) {
+    EXPECT_EQ(prefetched[i], visits[i].id);
+  }
+
+  prefetched.clear();
+  walk<0>(reg_, packet_, &prefetched);
+  EXPECT_TRUE(prefetched.empty());
+}
+
+TEST_F(PrefetchTest, SkipsUnregisteredOnlyPacket) {
+  auto unknown = PacketBuilder(1)
+                     .add(make_r02("UNKNOWN", 1, 1))
+                     .add(make_r02("OTHER", 1, 1))
+                     .build();
+  EXPECT_TRUE(walk<4>(reg_, unknown).empty());
+}
+
+TEST_F(PrefetchTest, BooksMatchInOrderLoop) {
+  std::array<OrderBook, 8> plain{};
+  std::array<OrderBook, 8> prefetched{};
+
+  auto apply = [&](auto& books, auto tag) {
+    auto it = net::taifex::PacketIterator::from(packet_);
+    ASSERT_TRUE(it);
+    for_each_prefetched<decltype(tag)::value>(
+        *it,
+        [&](const net::taifex::MessageView& msg) {
+          return resolve_instrument(reg_, msg);
+        },
+        [&](InstrumentId id) { prefetch_for_write(books[id]); },
+        [&](const net::taifex::MessageView& msg, InstrumentId id) {
+          if (msg.msg_type == '6') {
+            books[id].apply(*net::taifex::parse_r06_snapshot(msg.bytes));
+          } else {
+            books[id].apply(*net::taifex::parse_r02_trade(msg.bytes));
+          }
+        });
+  };
+  apply(plain, std::integral_constant<size_t, 0>{});
+  apply(prefetched, std::integral_constant<size_t, 4>{});
+
+  for (InstrumentId id = 0; id < 3; ++id) {
+    EXPECT_EQ(plain[id].best_bid(), prefetched[id].best_bid());
+    EXPECT_EQ(plain[id].best_ask(), prefetched[id].best_ask());
+    EXPECT_EQ(plain[id].last_price(), prefetched[id].last_price());
+    EXPECT_EQ(plain[id].last_qty(), prefetched[id].last_qty());
+  }
+  EXPECT_EQ(prefetched[1].last_price(), core::Price::from_ticks(200));
+  EXPECT_EQ(prefetched[0].best_bid().price, core::Price::from_ticks(100));
+}
+
+}  // namespace tx::market::test
@@ -0,0 +1,113 @@
+#include "tx/market/spread_book.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/net/taifex/parser.hpp"
+
+namespace tx::market::test {
+
+using net::taifex::test::make_r06;
+
+namespace {
+
+net::taifex::ParsedR06Snapshot parse(
+    const net::taifex::R06SnapshotWire& wire) {
+  auto r = net::taifex::parse_r06_snapshot(std::as_bytes(std::span(&wire, 1)));
+  EXPECT_TRUE(r);
+  return *r;
+}
+
+constexpr InstrumentId kTxf = 0;
+constexpr InstrumentId kMxf = 1;
+constexpr InstrumentId kTxfFar = 2;
+
+}  // namespace
+
+TEST(SpreadBookTest, RejectsInvalidSpreads) {
+  SpreadBook spreads(3);
+  std::array<SpreadLeg, 1> single{{{kTxf, 1, 1}}};
+  EXPECT_FALSE(spreads.add_spread(single));
+
+  std::array<SpreadLeg, 2> zero_ratio{{{kTxf, 1, 1}, {kMxf, 0, 4}}};
+  EXPECT_FALSE(spreads.add_spread(zero_ratio));
+
+  std::array<SpreadLeg, 2> out_of_range{{{kTxf, 1, 1}, {3, -1, 1}}};
+  EXPECT_FALSE(spreads.add_spread(out_of_range));
+  EXPECT_EQ(spreads.size(), 0U);
+}
+
+TEST(SpreadBookTest, ImpliedQuoteWithQtyRatio) {
+  SpreadBook spreads(3);
+  std::array<SpreadLeg, 2> legs{{{kTxf, 1, 1}, {kMxf, -1, 4}}};
+  auto basis = spreads.add_spread(legs);
+  ASSERT_TRUE(basis);
+  ASSERT_EQ(spreads.legs(*basis).size(), 2U);
+
+  OrderBook txf;
+  OrderBook mxf;
+  txf.apply(parse(make_r06("TXFC6", {{22000, 3, 1}}, {{22002, 2, 1}})));
+  EXPECT_EQ(spreads.on_book(kTxf, txf), 0U);  // MXF 尚無報價
+  EXPECT_FALSE(spreads.implied(*basis).bid.is_valid());
+
+  mxf.apply(parse(make_r06("MXFC6", {{21995, 9, 1}}, {{21999, 4, 1}})));
+  std::vector<SpreadId> changed;
+  EXPECT_EQ(spreads.on_book(kMxf, mxf,
+                            [&](SpreadId id, const ImpliedQuote&) {
+                              changed.push_back(id);
+                            }),
+            1U);
+  ASSERT_EQ(changed.size(), 1U);
+  EXPECT_EQ(changed[0], *basis);
+
+  // bid: 賣 TXF @22000、買 MXF @21999；ask: 買 TXF @22002、賣 MXF @21995
+  const auto& q = spreads.implied(*basis);
+  EXPECT_EQ(q.bid, core::Price::from_ticks(1));
+  EXPECT_EQ(q.ask, core::Price::from_ticks(7));
+  EXPECT_EQ(q.bid_qty, core::Quantity::from_value(1));  // min(3, 4 / 4)
+  EXPECT_EQ(q.ask_qty, core::Quantity::from_value(2));  // min(2, 9 / 4)
+
+  // MXF 賣方量不足 4 口：價差 bid 側消失
+  mxf.apply(parse(make_r06("MXFC6", {{21995, 9, 1}}, {{21999, 3, 1}})));
+  EXPECT_EQ(spreads.on_book(kMxf, mxf), 1U);
+  EXPECT_FALSE(spreads.implied(*basis).bid.is_valid());
+  EXPECT_EQ(spreads.implied(*basis).ask, core::Price::from_ticks(7));
+}
+
+TEST(SpreadBookTest, RecomputesOnlyOnTopOfBookChanges) {
+  SpreadBook spreads(3);
+  std::array<SpreadLeg, 2> calendar{{{kTxf, 1, 1}, {kTxfFar, -1, 1}}};
+  std::array<SpreadLeg, 2> basis{{{kTxf, 1, 1}, {kMxf, -1, 4}}};
+  ASSERT_TRUE(spreads.add_spread(calendar));
+  ASSERT_TRUE(spreads.add_spread(basis));
+
+  OrderBook txf;
+  OrderBook far;
+  txf.apply(parse(make_r06("TXFC6", {{22000, 1, 1}, {21999, 1, 1}},
+                           {{22001, 1, 1}})));
+  far.apply(parse(make_r06("TXFD6", {{22050, 1, 1}}, {{22052, 1, 1}})));
+  spreads.on_book(kTxf, txf);
+  EXPECT_EQ(spreads.on_book(kTxfFar, far), 1U);
+  EXPECT_EQ(spreads.implied(0).bid, core::Price::from_ticks(-52));
+  EXPECT_EQ(spreads.implied(0).ask, core::Price::from_ticks(-49));
+
+  // 只有第二檔變動：不重算
+  size_t calls = 0;
+  txf.apply(parse(make_r06("TXFC6", {{22000, 1, 1}, {21999, 5, 1}},
+                           {{22001, 1, 1}})));
+  EXPECT_EQ(spreads.on_book(kTxf, txf,
+                            [&](SpreadId, const ImpliedQuote&) { ++calls; }),
+            0U);
+  EXPECT_EQ(calls, 0U);
+
+  // 第一檔變動：兩個價差都重算，但 basis 缺 MXF 報價而未變動
+  txf.apply(parse(make_r06("TXFC6", {{22001, 1, 1}, {21999, 5, 1}},
+                           {{22002, 1, 1}})));
+  EXPECT_EQ(spreads.on_book(kTxf, txf), 1U);
+  EXPECT_EQ(spreads.implied(0).ask, core::Price::from_ticks(-48));
+}
+
+}  // namespace tx::market::test
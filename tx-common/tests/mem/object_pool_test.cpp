@@ -0,0 +1,75 @@
+#include "tx/mem/object_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace tx::mem::test {
+
+struct Counted {
+  static inline int alive = 0;
+  int value;
+
+  explicit Counted(int v) : value(v) { ++alive; }
+  ~Counted() { --alive; }
+};
+
+// =============================
+// 基本功能測試
+// =============================
+
+TEST(ObjectPoolTest, InitialState) {
+  ObjectPool<int, 4> pool;
+  EXPECT_EQ(pool.capacity(), 4);
+  EXPECT_EQ(pool.size(), 0);
+  EXPECT_EQ(pool.available(), 4);
+  EXPECT_TRUE(pool.empty());
+  EXPECT_FALSE(pool.full());
+}
+
+TEST(ObjectPoolTest, AcquireConstructsAndReleaseDestroys) {
+  Counted::alive = 0;
+  ObjectPool<Counted, 4> pool;
+
+  Counted* obj = pool.acquire(42);
+  ASSERT_NE(obj, nullptr);
+  EXPECT_EQ(obj->value, 42);
+  EXPECT_EQ(Counted::alive, 1);
+  EXPECT_EQ(pool.size(), 1);
+
+  pool.release(obj);
+  EXPECT_EQ(Counted::alive, 0);
+  EXPECT_TRUE(pool.empty());
+}
+
+// =============================
+// 邊界條件測試
+// =============================
+
+TEST(ObjectPoolTest, ExhaustedReturnsNull) {
+  ObjectPool<int, 3> pool;
+  std::vector<int*> objs;
+  for (int i = 0; i < 3; ++i) {
+    objs.push_back(pool.acquire(i));
+    ASSERT_NE(objs.back(), nullptr);
+  }
+  EXPECT_TRUE(pool.full());
+  EXPECT_EQ(pool.acquire(99), nullptr);
+
+  pool.release(objs[1]);
+  int* again = pool.acquire(7);
+  ASSERT_NE(again, nullptr);
+  EXPECT_EQ(again, objs[1]);  // LIFO 重用剛歸還的 slot (cache 較熱)
+}
+
+TEST(ObjectPoolTest, IndexRoundTrip) {
+  ObjectPool<int, 8> pool;
+  int* a = pool.acquire(1);
+  int* b = pool.acquire(2);
+
+  EXPECT_NE(pool.index_of(a), pool.index_of(b));
+  EXPECT_EQ(pool.at(pool.index_of(a)), a);
+  EXPECT_EQ(*pool.at(pool.index_of(b)), 2);
+}
+
+}  // namespace tx::mem::test
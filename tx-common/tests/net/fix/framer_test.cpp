@@ -0,0 +1,181 @@
+#include "tx/net/fix/framer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "tx/net/fix/constains.hpp"
+
+namespace tx::net::fix::test {
+
+namespace {
+
+/// @brief 以 body 組出完整訊息 (自動計算 BodyLength 與 CheckSum)
+std::string make_fix(std::string_view body,
+                     std::string_view begin = "FIX.4.4") {
+  std::string msg = "8=" + std::string(begin) + SOH + "9=" +
+                    std::to_string(body.size()) + SOH + std::string(body);
+  unsigned sum = 0;
+  for (char c : msg) sum += static_cast<unsigned char>(c);
+  char trailer[8];
+  std::snprintf(trailer, sizeof(trailer), "10=%03u%c", sum % 256, SOH);
+  return msg + trailer;
+}
+
+std::string body(int seq) {
+  return "35=8" + std::string(1, SOH) + "34=" + std::to_string(seq) + SOH +
+         "55=TXFC6" + SOH;
+}
+
+/// @brief 將 data 寫入 framer 的接收區
+void feed(Framer& framer, std::string_view data) {
+  while (!data.empty()) {
+    auto space = framer.prepare();
+    ASSERT_FALSE(space.empty());
+    const size_t n = std::min(space.size(), data.size());
+    std::memcpy(space.data(), data.data(), n);
+    framer.commit(n);
+    data.remove_prefix(n);
+  }
+}
+
+/// @brief 模擬 socket：每次 recv 最多交出 chunk bytes
+struct ChunkedReader {
+  std::string data;
+  size_t chunk;
+  size_t pos{0};
+
+  Result<size_t> recv(std::span<std::byte> buf) {
+    const size_t n = std::min({chunk, buf.size(), data.size() - pos});
+    std::memcpy(buf.data(), data.data() + pos, n);
+    pos += n;
+    return n;
+  }
+};
+
+}  // namespace
+
+TEST(FixFramerTest, SplitsConcatenatedMessages) {
+  const std::string a = make_fix(body(1));
+  const std::string b = make_fix(body(2));
+  Framer framer;
+  feed(framer, a + b);
+
+  std::vector<std::string> out;
+  auto n = framer.drain([&](std::string_view m) { out.emplace_back(m); });
+  ASSERT_TRUE(n) << n.error().message();
+  EXPECT_EQ(*n, 2U);
+  ASSERT_EQ(out.size(), 2U);
+  EXPECT_EQ(out[0], a);
+  EXPECT_EQ(out[1], b);
+  EXPECT_EQ(framer.buffered(), 0U);
+}
+
+TEST(FixFramerTest, WaitsForPartialMessageByteByByte) {
+  const std::string msg = make_fix(body(7));
+  Framer framer;
+  for (size_t i = 0; i + 1 < msg.size(); ++i) {
+    feed(framer, msg.substr(i, 1));
+    auto r = framer.next();
+    ASSERT_TRUE(r) << "at byte " << i << ": " << r.error().message();
+    EXPECT_FALSE(r->has_value()) << "at byte " << i;
+  }
+  feed(framer, msg.substr(msg.size() - 1));
+  auto r = framer.next();
+  ASSERT_TRUE(r && r->has_value());
+  EXPECT_EQ(**r, msg);
+}
+
+TEST(FixFramerTest, ReturnsViewsIntoReceiveBuffer) {
+  const std::string msg = make_fix(body(1));
+  Framer framer;
+  auto space = framer.prepare();
+  std::memcpy(space.data(), msg.data(), msg.size());
+  framer.commit(msg.size());
+
+  auto r = framer.next();
+  ASSERT_TRUE(r && r->has_value());
+  EXPECT_EQ(static_cast<const void*>((*r)->data()),
+            static_cast<const void*>(space.data()));
+}
+
+TEST(FixFramerTest, CompactsOnlyPartialTailInSmallBuffer) {
+  // 緩衝區只容納幾則訊息：必須反覆搬移不完整的尾端
+  std::string stream;
+  std::vector<std::string> expected;
+  for (int i = 0; i < 500; ++i) {
+    expected.push_back(make_fix(body(i)));
+    stream += expected.back();
+  }
+
+  for (size_t chunk : {1U, 3U, 17U, 64U, 100U}) {
+    Framer framer(256);
+    ChunkedReader reader{.data = stream, .chunk = chunk};
+    std::vector<std::string> out;
+    while (reader.pos < reader.data.size()) {
+      auto n = framer.fill(reader);
+      ASSERT_TRUE(n) << n.error().message();
+      auto r = framer.drain([&](std::string_view m) { out.emplace_back(m); });
+      ASSERT_TRUE(r) << r.error().message();
+    }
+    EXPECT_EQ(out, expected) << "chunk " << chunk;
+    EXPECT_EQ(framer.buffered(), 0U);
+  }
+}
+
+TEST(FixFramerTest, RejectsCorruptStream) {
+  Framer framer;
+  feed(framer, "garbage");
+  auto r = framer.next();
+  ASSERT_FALSE(r);
+  EXPECT_EQ(r.error(), FixErrc::MissingBeginString);
+
+  // BodyLength 與實際長度不符
+  std::string msg = make_fix(body(1));
+  msg.replace(msg.find("9=") + 2, 2, "20");
+  framer.reset();
+  feed(framer, msg + make_fix(body(2)));
+  r = framer.next();
+  ASSERT_FALSE(r);
+  EXPECT_EQ(r.error(), FixErrc::BodyLengthMismatch);
+
+  // CheckSum 錯誤
+  msg = make_fix(body(1));
+  msg[msg.size() - 2] = msg[msg.size() - 2] == '0' ? '1' : '0';
+  framer.reset();
+  feed(framer, msg);
+  r = framer.next();
+  ASSERT_FALSE(r);
+  EXPECT_EQ(r.error(), FixErrc::InvalidCheckSum);
+
+  // 不驗證 CheckSum 時照常交出
+  Framer lenient(Framer::kDefaultCapacity, false);
+  feed(lenient, msg);
+  r = lenient.next();
+  ASSERT_TRUE(r && r->has_value());
+}
+
+TEST(FixFramerTest, RejectsOversizedMessages) {
+  Framer framer(128);
+  feed(framer, make_fix(std::string(200, 'x')).substr(0, 30));
+  auto r = framer.next();
+  ASSERT_FALSE(r);
+  EXPECT_EQ(r.error(), FixErrc::BodyLengthExceeded);
+
+  framer.reset();
+  feed(framer, "8=FIX.4.4\x01" "9=123456\x01");
+  r = framer.next();
+  ASSERT_FALSE(r);
+  EXPECT_EQ(r.error(), FixErrc::BodyLengthExceeded);
+
+  framer.reset();
+  feed(framer, "8=FIX.4.4\x01" "9=\x01");
+  r = framer.next();
+  ASSERT_FALSE(r);
+  EXPECT_EQ(r.error(), FixErrc::InvalidFormat);
+}
+
+}  // namespace tx::net::fix::test
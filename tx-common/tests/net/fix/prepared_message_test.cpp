@@ -0,0 +1,107 @@
+#include "tx/net/fix/prepared_message.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <string>
+
+#include "tx/net/fix/framer.hpp"
+
+namespace tx::net::fix::test {
+
+namespace {
+
+const SessionHeader kHeader{.sender = "TX", .target = "TAIFEX"};
+
+/// @brief 以 Framer 驗證 BodyLength 與 CheckSum
+std::string reframe(std::string_view msg) {
+  Framer framer;
+  auto space = framer.prepare();
+  std::memcpy(space.data(), msg.data(), msg.size());
+  framer.commit(msg.size());
+  auto next = framer.next();
+  if (!next || !next->has_value()) return {};
+  return std::string(**next);
+}
+
+std::string readable(std::string_view msg) {
+  std::string out(msg);
+  for (char& c : out) {
+    if (c == SOH) c = '|';
+  }
+  return out;
+}
+
+PreparedMessage make_cancel() {
+  PreparedMessage cancel(kHeader, "F");
+  cancel.add(tags::OrigClOrdID, "A1")
+      .add(tags::ClOrdID, "C1")
+      .add(tags::Symbol, "TXFA6")
+      .add(tags::Side, '1')
+      .add_time(tags::TransactTime)
+      .add(tags::OrderQty, int64_t{3});
+  return cancel;
+}
+
+}  // namespace
+
+TEST(PreparedMessageTest, StampsSequenceAndTime) {
+  auto cancel = make_cancel();
+  ASSERT_TRUE(cancel.finish());
+
+  const auto stamped = cancel.stamp(42, "20260105-09:00:00.123");
+  ASSERT_TRUE(stamped);
+  const auto msg = *stamped;
+  EXPECT_EQ(readable(msg),
+            "8=FIX.4.4|9=115|35=F|49=TX|56=TAIFEX|34=000000042|"
+            "52=20260105-09:00:00.123|41=A1|11=C1|55=TXFA6|54=1|"
+            "60=20260105-09:00:00.123|38=3|10=" +
+                readable(msg.substr(msg.size() - 4)));
+  EXPECT_EQ(reframe(msg), msg);
+}
+
+TEST(PreparedMessageTest, ChecksumStaysValidAcrossStamps) {
+  auto cancel = make_cancel();
+  ASSERT_TRUE(cancel.finish());
+
+  TimestampCache cache;
+  uint64_t ns = 1'767'603'600ULL * 1'000'000'000ULL;
+  for (uint64_t seq = 1; seq < 2000; seq += 7) {
+    ns += 123'456'789;
+    const auto msg = cancel.stamp(seq, cache.format(ns)).value();
+    ASSERT_EQ(reframe(msg), msg) << readable(msg);
+  }
+}
+
+TEST(PreparedMessageTest, SupportsMicrosecondTimestamps) {
+  PreparedMessage msg({.sender = "A", .target = "B",
+                       .precision = TimePrecision::Micros},
+                      "0");
+  ASSERT_TRUE(msg.finish());
+  const auto out = msg.stamp(1, "20260105-09:00:00.123456").value();
+  EXPECT_NE(out.find("52=20260105-09:00:00.123456"), std::string_view::npos);
+  EXPECT_EQ(reframe(out), out);
+}
+
+TEST(PreparedMessageTest, RejectsMismatchedTimePrecision) {
+  auto cancel = make_cancel();
+  ASSERT_TRUE(cancel.finish());
+  const std::string before(cancel.view());
+
+  // 毫秒樣板填入微秒時間
+  auto result = cancel.stamp(1, "20260105-09:00:00.123456");
+  ASSERT_FALSE(result);
+  EXPECT_EQ(result.error(), FixErrc::InvalidFieldValue);
+  EXPECT_EQ(cancel.view(), before);
+}
+
+TEST(PreparedMessageTest, RejectsOversizedMessage) {
+  PreparedMessage msg(kHeader, "F");
+  msg.add(tags::Text, std::string(PreparedMessage::kCapacity, 'x'));
+  auto result = msg.finish();
+  ASSERT_FALSE(result);
+  EXPECT_EQ(result.error(), FixErrc::BodyLengthExceeded);
+  EXPECT_FALSE(msg.is_finished());
+}
+
+}  // namespace tx::net::fix::test
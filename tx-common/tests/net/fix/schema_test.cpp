@@ -0,0 +1,183 @@
+#include "tx/net/fix/schema.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "tx/net/fix/execution_report.hpp"
+
+namespace tx::net::fix::test {
+
+namespace {
+
+/// @brief 以 '|' 代替 SOH 撰寫訊息
+std::string fix(std::string text) {
+  for (char& c : text) {
+    if (c == '|') c = SOH;
+  }
+  return text;
+}
+
+const std::string kFill = fix(
+    "8=FIX.4.4|9=200|35=8|49=EXCH|56=TX|34=12|52=20260105-09:00:00.123|"
+    "37=ORD-1|11=CL-7|17=EX-3|150=F|39=1|55=TXFA6|54=2|38=5|44=17250.5|"
+    "32=2|31=17251|151=3|14=2|6=17251.00|60=20260105-09:00:00.120|10=000|");
+
+}  // namespace
+
+// ----------------------------------------------------------------------------
+// 值轉換
+// ----------------------------------------------------------------------------
+
+TEST(FixSchemaTest, ParsesPriceIntoTicks) {
+  auto price = core::Price::invalid();
+  ASSERT_TRUE(schema::parse_value("17250", price));
+  EXPECT_EQ(price.to_ticks(), 1725000);
+  ASSERT_TRUE(schema::parse_value("17250.5", price));
+  EXPECT_EQ(price.to_ticks(), 1725050);
+  ASSERT_TRUE(schema::parse_value("-0.25", price));
+  EXPECT_EQ(price.to_ticks(), -25);
+  ASSERT_TRUE(schema::parse_value("1.2500", price));
+  EXPECT_EQ(price.to_ticks(), 125);
+
+  EXPECT_FALSE(schema::parse_value("1.255", price));  // 低於 1 tick
+  EXPECT_FALSE(schema::parse_value("", price));
+  EXPECT_FALSE(schema::parse_value(".5", price));
+  EXPECT_FALSE(schema::parse_value("12a", price));
+}
+
+TEST(FixSchemaTest, ParsesCoreTypes) {
+  auto qty = core::Quantity::zero();
+  ASSERT_TRUE(schema::parse_value("42", qty));
+  EXPECT_EQ(qty.value(), 42);
+  EXPECT_FALSE(schema::parse_value("-1", qty));
+  EXPECT_FALSE(schema::parse_value("1.5", qty));
+
+  core::Side side{};
+  ASSERT_TRUE(schema::parse_value("2", side));
+  EXPECT_EQ(side, core::Side::Sell);
+  ASSERT_TRUE(schema::parse_value("1", side));
+  EXPECT_EQ(side, core::Side::Buy);
+  EXPECT_FALSE(schema::parse_value("3", side));
+
+  bool flag = false;
+  ASSERT_TRUE(schema::parse_value("Y", flag));
+  EXPECT_TRUE(flag);
+  EXPECT_FALSE(schema::parse_value("yes", flag));
+}
+
+// ----------------------------------------------------------------------------
+// Perfect Hash
+// ----------------------------------------------------------------------------
+
+TEST(FixSchemaTest, PerfectHashMapsEverySchemaTag) {
+  using Schema = ExecutionReportSchema;
+  for (size_t i = 0; i < Schema::kFieldCount; ++i) {
+    EXPECT_EQ(Schema::index_of(Schema::kTags[i]), i);
+  }
+
+  size_t hits = 0;
+  for (int tag = -10; tag < 20000; ++tag) {
+    if (Schema::index_of(tag)) ++hits;
+  }
+  EXPECT_EQ(hits, Schema::kFieldCount);
+}
+
+TEST(FixSchemaTest, PerfectHashIsBuiltAtCompileTime) {
+  constexpr auto hash = schema::make_perfect_hash(
+      std::array<int, 4>{tags::Price, tags::OrderQty, tags::Side, 9999});
+  static_assert(hash.multiplier != 0);
+  static_assert(hash.find(tags::Side) == 2);
+  static_assert(!hash.find(tags::Symbol));
+
+  constexpr auto duplicate =
+      schema::make_perfect_hash(std::array<int, 2>{tags::Price, tags::Price});
+  static_assert(duplicate.multiplier == 0);
+}
+
+// ----------------------------------------------------------------------------
+// decode
+// ----------------------------------------------------------------------------
+
+TEST(FixSchemaTest, DecodesExecutionReportInOnePass) {
+  auto report = ExecutionReportSchema::decode(kFill);
+  ASSERT_TRUE(report) << report.error().message();
+
+  EXPECT_EQ(report->order_id, "ORD-1");
+  EXPECT_EQ(report->cl_ord_id, "CL-7");
+  EXPECT_TRUE(report->orig_cl_ord_id.empty());
+  EXPECT_EQ(report->exec_id, "EX-3");
+  EXPECT_EQ(report->exec_type, 'F');
+  EXPECT_EQ(report->ord_status, '1');
+  EXPECT_EQ(report->symbol, "TXFA6");
+  EXPECT_EQ(report->side, core::Side::Sell);
+  EXPECT_EQ(report->order_qty.value(), 5);
+  ASSERT_TRUE(report->price);
+  EXPECT_EQ(report->price->to_ticks(), 1725050);
+  ASSERT_TRUE(report->last_qty && report->last_px);
+  EXPECT_EQ(report->last_qty->value(), 2);
+  EXPECT_EQ(report->last_px->to_ticks(), 1725100);
+  EXPECT_EQ(report->leaves_qty.value(), 3);
+  EXPECT_EQ(report->cum_qty.value(), 2);
+  EXPECT_EQ(report->transact_time, "20260105-09:00:00.120");
+  EXPECT_TRUE(report->text.empty());
+
+  // string_view 指向原始訊息
+  EXPECT_GE(report->symbol.data(), kFill.data());
+  EXPECT_LT(report->symbol.data(), kFill.data() + kFill.size());
+}
+
+TEST(FixSchemaTest, LeavesAbsentOptionalFieldsUnset) {
+  auto report = ExecutionReportSchema::decode(
+      fix("37=O|17=E|150=0|39=0|55=TXFA6|54=1|151=1|14=0|"));
+  ASSERT_TRUE(report) << report.error().message();
+  EXPECT_FALSE(report->price);
+  EXPECT_FALSE(report->last_qty);
+  EXPECT_FALSE(report->avg_px);
+  EXPECT_EQ(report->side, core::Side::Buy);
+}
+
+TEST(FixSchemaTest, RejectsMissingRequiredField) {
+  // 缺少 LeavesQty (151)
+  auto report = ExecutionReportSchema::decode(
+      fix("37=O|17=E|150=0|39=0|55=TXFA6|54=1|14=0|"));
+  ASSERT_FALSE(report);
+  EXPECT_EQ(report.error(), FixErrc::MissingRequiredField);
+}
+
+TEST(FixSchemaTest, RejectsValueOfWrongType) {
+  auto report = ExecutionReportSchema::decode(
+      fix("37=O|17=E|150=0|39=0|55=TXFA6|54=B|151=1|14=0|"));
+  ASSERT_FALSE(report);
+  EXPECT_EQ(report.error(), FixErrc::InvalidFieldValue);
+}
+
+TEST(FixSchemaTest, RejectsMalformedFields) {
+  for (const char* text : {"37=O|17", "x=1|", "=1|", "37O|", "37=O"}) {
+    auto report = ExecutionReportSchema::decode(fix(text));
+    ASSERT_FALSE(report) << text;
+    EXPECT_EQ(report.error(), FixErrc::InvalidFormat) << text;
+  }
+}
+
+TEST(FixSchemaTest, RejectsOverlongTag) {
+  // 9 位數仍可接受 (未知 tag 略過)，再多一位即拒絕而不溢位
+  EXPECT_TRUE(ExecutionReportSchema::decode(
+      fix("999999999=x|37=O|17=E|150=0|39=0|55=TXFA6|54=1|151=1|14=0|")));
+  for (const char* text : {"1234567890=1|", "99999999999999999999999=1|",
+                           "123456789012345678901234567890"}) {
+    auto report = ExecutionReportSchema::decode(fix(text));
+    ASSERT_FALSE(report) << text;
+    EXPECT_EQ(report.error(), FixErrc::InvalidFormat) << text;
+  }
+}
+
+TEST(FixSchemaTest, DecodeIntoKeepsFieldsNotInMessage) {
+  ExecutionReport report;
+  report.text = "previous";
+  ASSERT_TRUE(ExecutionReportSchema::decode_into(kFill, report));
+  EXPECT_EQ(report.text, "previous");
+  EXPECT_EQ(report.order_id, "ORD-1");
+}
+
+}  // namespace tx::net::fix::test
@@ -0,0 +1,109 @@
+#include "tx/net/fix/timestamp.hpp"
+
+#include <gtest/gtest.h>
+
+#include <time.h>
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+#include "tx/sys/clock.hpp"
+
+namespace tx::net::fix::test {
+
+namespace {
+
+constexpr uint64_t kNsPerSecond = 1'000'000'000;
+
+/// @brief 以 gmtime_r + snprintf 產生的參考字串
+std::string reference(uint64_t utc_ns, TimePrecision precision) {
+  const auto second = static_cast<time_t>(utc_ns / kNsPerSecond);
+  tm t{};
+  gmtime_r(&second, &t);
+  char buf[64];
+  const uint64_t sub = utc_ns % kNsPerSecond;
+  if (precision == TimePrecision::Millis) {
+    std::snprintf(buf, sizeof(buf), "%04d%02d%02d-%02d:%02d:%02d.%03u",
+                  t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour,
+                  t.tm_min, t.tm_sec, static_cast<unsigned>(sub / 1'000'000));
+  } else {
+    std::snprintf(buf, sizeof(buf), "%04d%02d%02d-%02d:%02d:%02d.%06u",
+                  t.tm_year + 1900, t.tm_mon + 1, t.tm_mday, t.tm_hour,
+                  t.tm_min, t.tm_sec, static_cast<unsigned>(sub / 1'000));
+  }
+  return buf;
+}
+
+}  // namespace
+
+TEST(TimestampCacheTest, FormatsKnownInstant) {
+  // 2026-01-05 09:00:00.123456789 UTC
+  const uint64_t ns = 1767603600ULL * kNsPerSecond + 123'456'789;
+
+  TimestampCache millis;
+  EXPECT_EQ(millis.format(ns), "20260105-09:00:00.123");
+
+  TimestampCache micros(TimePrecision::Micros);
+  EXPECT_EQ(micros.format(ns), "20260105-09:00:00.123456");
+  EXPECT_EQ(micros.size(), TimestampCache::kMaxLength);
+}
+
+TEST(TimestampCacheTest, PatchesFractionWithinSameSecond) {
+  const uint64_t base = 1767603600ULL * kNsPerSecond;
+  TimestampCache cache;
+  EXPECT_EQ(cache.format(base), "20260105-09:00:00.000");
+  EXPECT_EQ(cache.format(base + 7'000'000), "20260105-09:00:00.007");
+  EXPECT_EQ(cache.format(base + 999'999'999), "20260105-09:00:00.999");
+  EXPECT_EQ(cache.format(base + kNsPerSecond), "20260105-09:00:01.000");
+  // 時間倒退 (e.g. 重新 sync) 也必須重新產生
+  EXPECT_EQ(cache.format(base - 1), "20260105-08:59:59.999");
+}
+
+TEST(TimestampCacheTest, MatchesGmtimeAcrossCalendarBoundaries) {
+  constexpr uint64_t kDay = 86'400 * kNsPerSecond;
+  const uint64_t instants[] = {
+      0,                                     // 1970-01-01
+      951'782'400ULL * kNsPerSecond,         // 2000-02-29
+      1'709'164'800ULL * kNsPerSecond - 1,   // 2024-02-28 23:59:59.999...
+      1'735'689'599ULL * kNsPerSecond + 1,   // 2024-12-31 23:59:59
+      4'102'444'800ULL * kNsPerSecond,       // 2100-01-01
+  };
+  for (auto precision : {TimePrecision::Millis, TimePrecision::Micros}) {
+    TimestampCache cache(precision);
+    for (uint64_t ns : instants) {
+      for (uint64_t step : {uint64_t{0}, kNsPerSecond, kDay}) {
+        EXPECT_EQ(cache.format(ns + step), reference(ns + step, precision));
+      }
+    }
+  }
+}
+
+TEST(TimestampCacheTest, MatchesGmtimeForRandomMonotonicTimes) {
+  std::mt19937_64 rng(42);
+  uint64_t ns = 1'767'000'000ULL * kNsPerSecond;
+  TimestampCache millis;
+  TimestampCache micros(TimePrecision::Micros);
+  for (int i = 0; i < 20'000; ++i) {
+    ns += rng() % (3 * kNsPerSecond / 2);
+    ASSERT_EQ(millis.format(ns), reference(ns, TimePrecision::Millis));
+    ASSERT_EQ(micros.format(ns), reference(ns, TimePrecision::Micros));
+  }
+}
+
+TEST(TimestampCacheTest, FormatsTscWallClock) {
+  sys::TSCTimer::calibrate(std::chrono::milliseconds(10));
+  sys::TscWallClock::sync();
+
+  timespec ts{};
+  clock_gettime(CLOCK_REALTIME, &ts);
+  const uint64_t real = static_cast<uint64_t>(ts.tv_sec) * kNsPerSecond +
+                        static_cast<uint64_t>(ts.tv_nsec);
+  const uint64_t tsc = sys::TscWallClock::now_ns();
+  EXPECT_NEAR(static_cast<double>(tsc), static_cast<double>(real), 5e6);
+
+  TimestampCache cache;
+  EXPECT_EQ(cache.format(tsc), reference(tsc, TimePrecision::Millis));
+}
+
+}  // namespace tx::net::fix::test
@@ -0,0 +1,151 @@
+#include "tx/net/taifex/feed_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <vector>
+
+#include "test_util.hpp"
+#include "tx/io/socket_address.hpp"
+#include "tx/io/udp_socket.hpp"
+#include "tx/net/taifex/packet_iterator.hpp"
+
+namespace tx::net::taifex::test {
+
+class FeedFilterTest : public ::testing::Test {
+ protected:
+  io::UdpSocket receiver_ = io::UdpSocket::bind(
+                                io::SocketAddress::from_ipv4("127.0.0.1", 0)
+                                    .value())
+                                .value();
+  io::SocketAddress dest_ = receiver_.local_address().value();
+  io::UdpSocket sender_ = io::UdpSocket::create().value();
+
+  void SetUp() override {
+    ASSERT_TRUE(receiver_.set_nonblocking(true).has_value());
+  }
+
+  void send(const std::vector<std::byte>& packet) {
+    ASSERT_TRUE(sender_.sendto(packet, dest_).has_value());
+  }
+
+  static std::vector<std::byte> r06_packet(uint32_t seq, uint16_t channel) {
+    return PacketBuilder(seq, channel)
+        .add(make_r06("TXFC6", {{17000, 1, 1}}, {{17001, 1, 1}}, 17000, 1, 1))
+        .build();
+  }
+
+  static std::vector<std::byte> r02_packet(uint32_t seq, uint16_t channel) {
+    return PacketBuilder(seq, channel)
+        .add(make_r02("TXFC6", 17000, 1, 1))
+        .build();
+  }
+
+  /// @brief 收取目前所有封包的序號
+  std::vector<uint32_t> received_seqs() {
+    std::vector<uint32_t> seqs;
+    std::array<std::byte, 2048> buf;
+    while (true) {
+      auto n = receiver_.recvfrom(buf);
+      if (!n) {
+        EXPECT_EQ(n.error().value(), EAGAIN);
+        break;
+      }
+      auto it = PacketIterator::from(std::span(buf).first(*n));
+      EXPECT_TRUE(it.has_value());
+      if (it) seqs.push_back(it->header().pkt_seq_num);
+    }
+    return seqs;
+  }
+};
+
+TEST_F(FeedFilterTest, ChannelSetDropsOtherChannelsInKernel) {
+  auto prog = FeedFilter().channels({2, 5}).build();
+  ASSERT_TRUE(prog.has_value());
+  ASSERT_TRUE(receiver_.attach_filter(*prog).has_value());
+
+  send(r06_packet(1, 1));
+  send(r06_packet(2, 2));
+  send(r06_packet(3, 3));
+  send(r06_packet(4, 5));
+  send(r06_packet(5, 0x0500));  // byte order 錯誤時會誤判為 5
+
+  EXPECT_EQ(received_seqs(), (std::vector<uint32_t>{2, 4}));
+}
+
+TEST_F(FeedFilterTest, MsgTypeFilter) {
+  auto prog = FeedFilter().msg_kind('R').msg_type('6').build();
+  ASSERT_TRUE(prog.has_value());
+  ASSERT_TRUE(receiver_.attach_filter(*prog).has_value());
+
+  send(r06_packet(1, 1));
+  send(r02_packet(2, 1));
+  send(r06_packet(3, 7));
+
+  EXPECT_EQ(received_seqs(), (std::vector<uint32_t>{1, 3}));
+}
+
+TEST_F(FeedFilterTest, CombinedPredicatesAreAnded) {
+  auto prog = FeedFilter().channel(1).msg_type('2').build();
+  ASSERT_TRUE(prog.has_value());
+  ASSERT_TRUE(receiver_.attach_filter(*prog).has_value());
+
+  send(r06_packet(1, 1));
+  send(r02_packet(2, 1));
+  send(r02_packet(3, 2));
+
+  EXPECT_EQ(received_seqs(), (std::vector<uint32_t>{2}));
+}
+
+TEST_F(FeedFilterTest, RejectsNonTaifexAndTruncatedDatagrams) {
+  auto prog = FeedFilter().build();
+  ASSERT_TRUE(prog.has_value());
+  ASSERT_TRUE(receiver_.attach_filter(*prog).has_value());
+
+  const std::vector<std::byte> garbage(32, std::byte{0x42});
+  const std::vector<std::byte> empty;
+  send(garbage);
+  send(empty);
+  send(r06_packet(9, 1));
+
+  EXPECT_EQ(received_seqs(), (std::vector<uint32_t>{9}));
+}
+
+TEST_F(FeedFilterTest, DetachRestoresDelivery) {
+  auto prog = FeedFilter().channel(99).build();
+  ASSERT_TRUE(prog.has_value());
+  ASSERT_TRUE(receiver_.attach_filter(*prog).has_value());
+  send(r06_packet(1, 1));
+  EXPECT_TRUE(received_seqs().empty());
+
+  ASSERT_TRUE(receiver_.detach_filter().has_value());
+  send(r06_packet(2, 1));
+  EXPECT_EQ(received_seqs(), (std::vector<uint32_t>{2}));
+}
+
+TEST(FeedFilterBuildTest, TooManyChannelsFails) {
+  FeedFilter filter;
+  for (uint16_t c = 0; c <= FeedFilter::kMaxChannels; ++c) {
+    filter.channel(c);
+  }
+  auto prog = filter.build();
+  ASSERT_FALSE(prog.has_value());
+  EXPECT_EQ(prog.error(), std::errc::value_too_large);
+}
+
+TEST(FeedFilterBuildTest, MaxChannelsFitsJumpRange) {
+  FeedFilter filter;
+  for (uint16_t c = 0; c < FeedFilter::kMaxChannels; ++c) {
+    filter.channel(c);
+  }
+  auto prog = filter.msg_kind('R').msg_type('6').build();
+  ASSERT_TRUE(prog.has_value());
+  EXPECT_LE(prog->size(), size_t{BPF_MAXINSNS});
+}
+
+}  // namespace tx::net::taifex::test
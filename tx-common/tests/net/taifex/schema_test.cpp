@@ -0,0 +1,183 @@
+#include "tx/net/taifex/schema.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+#include "tx/net/taifex/error.hpp"
+#include "tx/net/taifex/parser.hpp"
+#include "tx/net/taifex/wire_format.hpp"
+#include "test_util.hpp"
+
+namespace tx::net::taifex::test {
+
+// ----------------------------------------------------------------------------
+// 由 schema 產生的測試向量 (對所有訊息執行)
+// ----------------------------------------------------------------------------
+
+namespace {
+
+/// @brief 以 big-endian 讀取 wire bytes 的整數
+template <typename T>
+T read_big_endian(const std::byte* p) {
+  std::make_unsigned_t<T> v = 0;
+  for (size_t i = 0; i < sizeof(T); ++i) {
+    v = static_cast<std::make_unsigned_t<T>>(
+        (v << 8) | std::to_integer<uint8_t>(p[i]));
+  }
+  return static_cast<T>(v);
+}
+
+/// @brief 依欄位表檢查每個解碼後的欄位都等於 wire bytes 的網路序值
+template <typename Codec>
+void expect_decoded(const std::byte* wire, const typename Codec::Parsed& p) {
+  Codec::visit(p, [&](const schema::FieldInfo& field, const auto& value) {
+    using V = std::remove_cvref_t<decltype(value)>;
+    using E = std::remove_all_extents_t<V>;
+    const size_t elem_size = field.size / field.count;
+
+    auto check = [&](const std::byte* bytes, const E& elem) {
+      if constexpr (std::is_integral_v<E>) {
+        EXPECT_EQ(elem, read_big_endian<E>(bytes)) << field.name;
+      } else {
+        expect_decoded<typename E::Schema>(bytes, elem);
+      }
+    };
+
+    if constexpr (std::is_array_v<V>) {
+      ASSERT_EQ(std::extent_v<V>, field.count) << field.name;
+      for (size_t i = 0; i < field.count; ++i) {
+        check(wire + field.offset + i * elem_size, value[i]);
+      }
+    } else {
+      ASSERT_EQ(field.count, 1U) << field.name;
+      check(wire + field.offset, value);
+    }
+  });
+}
+
+}  // namespace
+
+template <typename M>
+class SchemaMessageTest : public ::testing::Test {};
+
+using AllMessages = ::testing::Types<R06Snapshot, R02Trade, I01ProductInfo>;
+TYPED_TEST_SUITE(SchemaMessageTest, AllMessages);
+
+TYPED_TEST(SchemaMessageTest, FieldTableCoversWireStruct) {
+  using M = TypeParam;
+  // 欄位緊接在 MessageHeader 之後且無空隙
+  size_t expected = sizeof(MessageHeader);
+  for (const auto& field : M::kFields) {
+    EXPECT_EQ(field.offset, expected) << field.name;
+    expected += field.size;
+  }
+  EXPECT_EQ(expected, sizeof(typename M::Wire));
+}
+
+TYPED_TEST(SchemaMessageTest, DecodesTestVector) {
+  using M = TypeParam;
+  for (uint8_t seed : {1, 2, 0x80}) {
+    const auto wire = schema::test_vector<M>(seed);
+    auto parsed = schema::parse<M>(std::as_bytes(std::span(&wire, 1)));
+    ASSERT_TRUE(parsed) << parsed.error().message();
+    expect_decoded<M>(reinterpret_cast<const std::byte*>(&wire), *parsed);
+  }
+}
+
+TYPED_TEST(SchemaMessageTest, EncodeRoundTrip) {
+  using M = TypeParam;
+  const auto wire = schema::test_vector<M>();
+  const auto encoded = M::encode(M::decode(wire));
+  EXPECT_EQ(std::memcmp(&wire, &encoded, sizeof(wire)), 0);
+}
+
+TYPED_TEST(SchemaMessageTest, RejectsInvalidHeader) {
+  using M = TypeParam;
+  auto wire = schema::test_vector<M>();
+  auto bytes = std::as_bytes(std::span(&wire, 1));
+
+  auto short_buf = M::View::from(bytes.first(bytes.size() - 1));
+  ASSERT_FALSE(short_buf);
+  EXPECT_EQ(short_buf.error(), parse_errc::buffer_too_small);
+
+  wire.header.msg_kind = 'X';
+  auto bad_kind = M::View::from(bytes);
+  ASSERT_FALSE(bad_kind);
+  EXPECT_EQ(bad_kind.error(), parse_errc::invalid_msg_kind);
+
+  wire.header = M::kHeader;
+  wire.header.msg_type = 'X';
+  auto bad_type = M::View::from(bytes);
+  ASSERT_FALSE(bad_type);
+  EXPECT_EQ(bad_type.error(), parse_errc::invalid_msg_type);
+
+  wire.header = M::kHeader;
+  wire.header.msg_length = schema::encode_value(uint16_t{1});
+  auto bad_length = M::View::from(bytes);
+  ASSERT_FALSE(bad_length);
+  EXPECT_EQ(bad_length.error(), parse_errc::invalid_msg_length);
+}
+
+// ----------------------------------------------------------------------------
+// View 與手寫的測試資料
+// ----------------------------------------------------------------------------
+
+TEST(SchemaViewTest, ReadsFieldsWithoutCopy) {
+  const auto wire = make_r06("TXFC6", {{20000, 3, 2}, {19999, 5, 1}},
+                             {{20001, 4, 1}}, 20000, 7, 1234);
+  auto view = R06SnapshotView::from(std::as_bytes(std::span(&wire, 1)));
+  ASSERT_TRUE(view);
+
+  EXPECT_EQ(&view->wire(), &wire);
+  EXPECT_EQ(view->prod_id(0), 'T');
+  EXPECT_EQ(view->bid_level_cnt(), 2U);
+  EXPECT_EQ(view->bid_levels(1).price, 19999);
+  EXPECT_EQ(view->bid_levels(1).quantity, 5U);
+  EXPECT_EQ(view->ask_levels(0).price, 20001);
+  EXPECT_EQ(view->last_price(), 20000);
+  EXPECT_EQ(view->total_volume(), 1234U);
+  EXPECT_EQ(view->update_time(), 9000000U);
+}
+
+TEST(SchemaViewTest, MatchesParser) {
+  const auto wire = make_r02("MXFC6", 19876, 9, 555);
+  auto bytes = std::as_bytes(std::span(&wire, 1));
+  auto parsed = parse_r02_trade(bytes);
+  auto view = R02TradeView::from(bytes);
+  ASSERT_TRUE(parsed && view);
+
+  EXPECT_EQ(view->match_price(), parsed->match_price);
+  EXPECT_EQ(view->match_qty(), parsed->match_qty);
+  EXPECT_EQ(view->total_volume(), parsed->total_volume);
+  EXPECT_EQ(view->match_time(), parsed->match_time);
+  EXPECT_EQ(view->side(), parsed->side);
+  EXPECT_TRUE(std::equal(parsed->prod_id, parsed->prod_id + 5, "MXFC6"));
+}
+
+TEST(SchemaViewTest, EncodeBuildsValidMessage) {
+  ParsedI01ProductInfo info{};
+  std::memcpy(info.prod_id, "TXFC6               ", sizeof(info.prod_id));
+  info.reference_price = 20000;
+  info.upper_limit = 22000;
+  info.lower_limit = 18000;
+  info.decimal_locator = 0;
+  info.trade_date = 20260320;
+
+  const auto wire = I01ProductInfo::encode(info);
+  auto parsed =
+      schema::parse<I01ProductInfo>(std::as_bytes(std::span(&wire, 1)));
+  ASSERT_TRUE(parsed);
+  EXPECT_EQ(parsed->reference_price, 20000);
+  EXPECT_EQ(parsed->upper_limit, 22000);
+  EXPECT_EQ(parsed->lower_limit, 18000);
+  EXPECT_EQ(parsed->trade_date, 20260320U);
+  EXPECT_EQ(read_big_endian<int32_t>(reinterpret_cast<const std::byte*>(
+                &wire.reference_price)),
+            20000);
+}
+
+}  // namespace tx::net::taifex::test
@@ -0,0 +1,125 @@
+#ifndef TX_COMMON_TESTS_NET_TAIFEX_TEST_UTIL_HPP
+#define TX_COMMON_TESTS_NET_TAIFEX_TEST_UTIL_HPP
+
+#include <arpa/inet.h>
+#include <endian.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+#include "tx/net/taifex/wire_format.hpp"
+
+namespace tx::net::taifex::test {
+
+// ----------------------------------------------------------------------------
+// Packet Builder
+// ----------------------------------------------------------------------------
+
+/// @brief 測試用單一價位 (host order)
+struct Level {
+  int32_t price;
+  uint32_t qty;
+  uint32_t orders;
+};
+
+inline void copy_prod_id(char (&dst)[20], std::string_view prod_id) {
+  std::memset(dst, ' ', sizeof(dst));
+  std::memcpy(dst, prod_id.data(), std::min(prod_id.size(), sizeof(dst)));
+}
+
+inline R06LevelWire to_wire(const Level& lv) {
+  return R06LevelWire{.price = static_cast<int32_t>(
+                      htonl(static_cast<uint32_t>(lv.price))),
+                  .quantity = htonl(lv.qty),
+                  .order_count = htonl(lv.orders)};
+}
+
+/// @brief 建立 R06 快照訊息
+inline R06SnapshotWire make_r06(std::string_view prod_id,
+                                std::initializer_list<Level> bids,
+                                std::initializer_list<Level> asks,
+                                int32_t last_price = 0, uint32_t last_qty = 0,
+                                uint32_t total_volume = 0) {
+  R06SnapshotWire w{};
+  w.header.msg_length = htons(sizeof(R06SnapshotWire));
+  w.header.msg_kind = 'R';
+  w.header.msg_type = '6';
+  copy_prod_id(w.prod_id, prod_id);
+  w.update_time = htonl(9000000);
+
+  w.bid_level_cnt = static_cast<uint8_t>(bids.size());
+  size_t i = 0;
+  for (const auto& lv : bids) w.bid_levels[i++] = to_wire(lv);
+
+  w.ask_level_cnt = static_cast<uint8_t>(asks.size());
+  i = 0;
+  for (const auto& lv : asks) w.ask_levels[i++] = to_wire(lv);
+
+  w.last_price = static_cast<int32_t>(htonl(static_cast<uint32_t>(last_price)));
+  w.last_qty = htonl(last_qty);
+  w.total_volume = htonl(total_volume);
+  return w;
+}
+
+/// @brief 建立 R02 成交訊息
+inline R02TradeWire make_r02(std::string_view prod_id, int32_t price,
+                             uint32_t qty, uint32_t total_volume = 0) {
+  R02TradeWire w{};
+  w.header.msg_length = htons(sizeof(R02TradeWire));
+  w.header.msg_kind = 'R';
+  w.header.msg_type = '2';
+  copy_prod_id(w.prod_id, prod_id);
+  w.match_price = static_cast<int32_t>(htonl(static_cast<uint32_t>(price)));
+  w.match_qty = htonl(qty);
+  w.total_volume = htonl(total_volume);
+  w.match_time = htobe64(90000000000);
+  w.side = 1;
+  return w;
+}
+
+/// @brief 將多個訊息組成一個 UDP 封包
+class PacketBuilder {
+ private:
+  static constexpr size_t kReserveBytes = 1500;
+
+  std::vector<std::byte> buf_;
+  uint16_t count_{0};
+
+ public:
+  explicit PacketBuilder(uint32_t seq = 1, uint16_t channel = 1)
+      : buf_(sizeof(PacketHeader)) {
+    // 預留一個 MTU：add() 內聯到呼叫端時，GCC 12 會對 vector 的成長路徑
+    // 誤報 -Wstringop-overflow
+    buf_.reserve(kReserveBytes);
+    auto* hdr = reinterpret_cast<PacketHeader*>(buf_.data());
+    hdr->esc_code = 0x1B;
+    hdr->packet_version = 0x01;
+    hdr->pkt_seq_num = htonl(seq);
+    hdr->channel_id = htons(channel);
+    hdr->send_time = htonl(9000000);
+  }
+
+  template <typename Wire>
+  PacketBuilder& add(const Wire& msg) {
+    const auto* p = reinterpret_cast<const std::byte*>(&msg);
+    buf_.insert(buf_.end(), p, p + sizeof(Wire));
+    ++count_;
+    return *this;
+  }
+
+  [[nodiscard]] std::vector<std::byte> build() const {
+    std::vector<std::byte> out = buf_;
+    auto* hdr = reinterpret_cast<PacketHeader*>(out.data());
+    hdr->packet_length = htons(static_cast<uint16_t>(out.size()));
+    hdr->msg_count = htons(count_);
+    return out;
+  }
+};
+
+}  // namespace tx::net::taifex::test
+
+#endif
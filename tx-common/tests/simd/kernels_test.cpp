@@ -0,0 +1,225 @@
+#include "tx/simd/kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "tx/simd/cpu_features.hpp"
+#include "tx/simd/dispatch.hpp"
+
+namespace tx::simd::test {
+
+constexpr Isa kAllIsas[] = {Isa::Scalar, Isa::Sse42, Isa::Avx2, Isa::Avx512};
+
+// ----------------------------------------------------------------------------
+// CpuFeatures
+// ----------------------------------------------------------------------------
+
+TEST(CpuFeaturesTest, MatchesCompilerBuiltins) {
+  const auto& f = cpu_features();
+  EXPECT_EQ(f.sse42, __builtin_cpu_supports("sse4.2") != 0);
+  EXPECT_EQ(f.popcnt, __builtin_cpu_supports("popcnt") != 0);
+  EXPECT_EQ(f.avx2, __builtin_cpu_supports("avx2") != 0);
+  EXPECT_EQ(f.bmi2, __builtin_cpu_supports("bmi2") != 0);
+  EXPECT_EQ(f.avx512f, __builtin_cpu_supports("avx512f") != 0);
+  EXPECT_EQ(f.avx512bw, __builtin_cpu_supports("avx512bw") != 0);
+  EXPECT_LE(active_isa(), f.max_isa());
+}
+
+TEST(CpuFeaturesTest, LevelsRequireAllFeatures) {
+  CpuFeatures f;
+  EXPECT_EQ(f.max_isa(), Isa::Scalar);
+
+  f.ssse3 = f.sse41 = f.sse42 = f.popcnt = true;
+  EXPECT_EQ(f.max_isa(), Isa::Sse42);
+
+  f.avx = f.avx2 = f.bmi1 = f.bmi2 = f.fma = f.lzcnt = f.movbe = true;
+  EXPECT_EQ(f.max_isa(), Isa::Avx2);
+
+  // AVX-512 需要 F/BW/CD/DQ/VL 全部
+  f.avx512f = f.avx512bw = f.avx512cd = f.avx512dq = true;
+  EXPECT_EQ(f.max_isa(), Isa::Avx2);
+  f.avx512vl = true;
+  EXPECT_EQ(f.max_isa(), Isa::Avx512);
+
+  f.sse42 = false;
+  EXPECT_EQ(f.max_isa(), Isa::Scalar);
+}
+
+TEST(CpuFeaturesTest, IsaNames) {
+  for (Isa isa : kAllIsas) {
+    EXPECT_EQ(parse_isa(to_string(isa)), isa);
+  }
+  EXPECT_FALSE(parse_isa("avx9").has_value());
+}
+
+// ----------------------------------------------------------------------------
+// Dispatch
+// ----------------------------------------------------------------------------
+
+int impl_scalar() noexcept { return 0; }
+int impl_sse42() noexcept { return 1; }
+int impl_avx512() noexcept { return 3; }
+
+TEST(DispatchTest, FallsBackToLowerProvidedLevel) {
+  Dispatch<int()> d{{.scalar = impl_scalar,
+                     .sse42 = impl_sse42,
+                     .avx512 = impl_avx512}};
+  EXPECT_EQ(d(), 0);  // 建構後為 scalar
+
+  EXPECT_EQ(d.resolve(Isa::Scalar), Isa::Scalar);
+  EXPECT_EQ(d(), 0);
+
+  // 未提供 Avx2 版本 -> 往下使用 Sse42
+  if (is_supported(Isa::Avx2)) {
+    EXPECT_EQ(d.resolve(Isa::Avx2), Isa::Sse42);
+    EXPECT_EQ(d(), 1);
+    EXPECT_EQ(d.variant(Isa::Avx2), nullptr);
+  }
+  if (is_supported(Isa::Avx512)) {
+    EXPECT_EQ(d.resolve(Isa::Avx512), Isa::Avx512);
+    EXPECT_EQ(d(), 3);
+  } else {
+    EXPECT_EQ(d.variant(Isa::Avx512), nullptr);
+  }
+}
+
+TEST(DispatchTest, KernelsResolvedAtStartup) {
+  const Isa isa = active_isa();
+  EXPECT_EQ(kernels::find_byte.active(), kernels::find_byte.variant(isa));
+  EXPECT_EQ(kernels::byte_sum.active(), kernels::byte_sum.variant(isa));
+  EXPECT_EQ(kernels::byteswap32.active(), kernels::byteswap32.variant(isa));
+}
+
+TEST(DispatchTest, ResolveAllCapsLevel) {
+  resolve_all(Isa::Scalar);
+  EXPECT_EQ(kernels::find_byte.active(),
+            kernels::find_byte.variant(Isa::Scalar));
+  std::vector<std::byte> data(100, std::byte{1});
+  EXPECT_EQ(byte_sum(data), 100U);
+
+  resolve_all(active_isa());
+  EXPECT_EQ(kernels::find_byte.active(),
+            kernels::find_byte.variant(active_isa()));
+}
+
+// ----------------------------------------------------------------------------
+// Kernels (對每個硬體支援的實作比對 scalar 結果)
+// ----------------------------------------------------------------------------
+
+class KernelTest : public ::testing::TestWithParam<Isa> {
+ protected:
+  void SetUp() override {
+    if (!is_supported(GetParam())) {
+      GTEST_SKIP() << to_string(GetParam()) << " not supported";
+    }
+  }
+
+  /// @brief 0..n 的長度涵蓋向量寬度的每種尾端
+  static std::vector<size_t> sizes() {
+    std::vector<size_t> out;
+    for (size_t n = 0; n <= 200; ++n) out.push_back(n);
+    out.push_back(1000);
+    out.push_back(4099);
+    return out;
+  }
+};
+
+TEST_P(KernelTest, FindByte) {
+  auto* fn = kernels::find_byte.variant(GetParam());
+  ASSERT_NE(fn, nullptr);
+
+  std::vector<std::byte> buf(4200 + 1, std::byte{'a'});
+  for (size_t n : sizes()) {
+    // 從非對齊位置開始
+    const std::byte* data = buf.data() + 1;
+    EXPECT_EQ(fn(data, n, std::byte{0x01}), n) << "size " << n;
+
+    for (size_t pos : {size_t{0}, n / 2, n - 1}) {
+      if (n == 0) break;
+      buf[1 + pos] = std::byte{0x01};
+      EXPECT_EQ(fn(data, n, std::byte{0x01}), pos) << "size " << n;
+      buf[1 + pos] = std::byte{'a'};
+    }
+  }
+
+  // 第一個符合者 (多個相同位元組)
+  std::vector<std::byte> many(300, std::byte{'='});
+  EXPECT_EQ(fn(many.data(), many.size(), std::byte{'='}), 0U);
+  // 範圍外的符合者不算
+  buf[1 + 40] = std::byte{0x01};
+  EXPECT_EQ(fn(buf.data() + 1, 40, std::byte{0x01}), 40U);
+}
+
+TEST_P(KernelTest, ByteSum) {
+  auto* fn = kernels::byte_sum.variant(GetParam());
+  ASSERT_NE(fn, nullptr);
+
+  std::vector<std::byte> buf(4200 + 1);
+  for (size_t i = 0; i < buf.size(); ++i) {
+    buf[i] = static_cast<std::byte>((i * 131 + 7) & 0xFF);
+  }
+  for (size_t n : sizes()) {
+    const std::byte* data = buf.data() + 1;
+    uint64_t expected = 0;
+    for (size_t i = 0; i < n; ++i) {
+      expected += std::to_integer<uint8_t>(data[i]);
+    }
+    EXPECT_EQ(fn(data, n), expected) << "size " << n;
+  }
+
+  // 全部 0xFF (無號相加，不會溢位成負數)
+  std::vector<std::byte> ones(1000, std::byte{0xFF});
+  EXPECT_EQ(fn(ones.data(), ones.size()), 255000U);
+}
+
+TEST_P(KernelTest, ByteSwap32) {
+  auto* fn = kernels::byteswap32.variant(GetParam());
+  ASSERT_NE(fn, nullptr);
+
+  for (size_t n : sizes()) {
+    std::vector<uint32_t> in(n + 1);
+    std::iota(in.begin(), in.end(), 0x01020304U);
+    std::vector<uint32_t> out(n + 1, 0xDEADBEEF);
+
+    fn(in.data(), out.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(out[i], std::byteswap(in[i])) << "size " << n << " i " << i;
+    }
+    EXPECT_EQ(out[n], 0xDEADBEEF) << "wrote past end, size " << n;
+
+    // in-place
+    fn(out.data(), out.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+      ASSERT_EQ(out[i], in[i]);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllIsas, KernelTest, ::testing::ValuesIn(kAllIsas),
+                         [](const auto& info) {
+                           return std::string(to_string(info.param));
+                         });
+
+// ----------------------------------------------------------------------------
+// 包裝函式
+// ----------------------------------------------------------------------------
+
+TEST(SimdKernelsTest, FindsFixDelimiters) {
+  const char msg[] = "8=FIX.4.4\x01" "9=65\x01" "35=A\x01";
+  auto bytes = std::as_bytes(std::span(msg, sizeof(msg) - 1));
+  EXPECT_EQ(find_byte(bytes, std::byte{0x01}), 9U);
+  EXPECT_EQ(find_byte(bytes, std::byte{'='}), 1U);
+  EXPECT_EQ(find_byte(bytes, std::byte{'|'}), bytes.size());
+
+  uint64_t sum = 0;
+  for (char c : std::string_view(msg, sizeof(msg) - 1)) {
+    sum += static_cast<unsigned char>(c);
+  }
+  EXPECT_EQ(byte_sum(bytes), sum);
+}
+
+}  // namespace tx::simd::test
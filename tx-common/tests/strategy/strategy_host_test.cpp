@@ -0,0 +1,191 @@
+#include "tx/strategy/strategy_host.hpp"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../net/taifex/test_util.hpp"
+#include "tx/feed/memory_feed.hpp"
+#include "tx/sys/clock.hpp"
+
+namespace tx::strategy::test {
+
+using net::taifex::test::make_r02;
+using net::taifex::test::make_r06;
+using net::taifex::test::PacketBuilder;
+
+// ----------------------------------------------------------------------------
+// Test Doubles
+// ----------------------------------------------------------------------------
+
+/// @brief 以佇列模擬成交回報的 gateway
+struct MockGateway {
+  std::deque<Fill> pending;
+
+  template <typename Sink>
+  size_t poll_fills(Sink&& sink) {
+    size_t n = pending.size();
+    while (!pending.empty()) {
+      sink(pending.front());
+      pending.pop_front();
+    }
+    return n;
+  }
+};
+
+/// @brief 沒有任何回報能力的 gateway
+struct NullGateway {};
+
+class RecordingStrategy
+    : public StrategyHost<RecordingStrategy, feed::MemoryFeed, MockGateway,
+                          sys::SimulatedClock, 16, 64> {
+ public:
+  RecordingStrategy(feed::MemoryFeed feed, MockGateway gateway)
+      : StrategyHost(std::move(feed), std::move(gateway)) {}
+
+  std::vector<std::pair<market::InstrumentId, uint16_t>> books;
+  std::vector<int32_t> trades;
+  std::vector<std::string> events;  ///< 依序記錄 trade/timer
+  std::vector<uint64_t> fills;
+  std::vector<uint64_t> timers;
+
+  void on_book(market::InstrumentId id, const market::OrderBook& book) {
+    books.emplace_back(id, book.changed_mask());
+  }
+  void on_trade(market::InstrumentId,
+                const net::taifex::ParsedR02Trade& trade) {
+    trades.push_back(trade.match_price);
+    events.push_back("trade@" + std::to_string(now()));
+  }
+  void on_fill(const Fill& fill) { fills.push_back(fill.order_id.value()); }
+  void on_timer(sys::TimerHandle, uint64_t user_data) {
+    timers.push_back(user_data);
+    events.push_back("timer" + std::to_string(user_data));
+  }
+};
+
+/// @brief 只關心 book 的策略，其他 callback 應在編譯期被移除
+class BookOnlyStrategy
+    : public StrategyHost<BookOnlyStrategy, feed::MemoryFeed, NullGateway,
+                          sys::TscClock, 4, 16> {
+ public:
+  BookOnlyStrategy(feed::MemoryFeed feed, NullGateway gateway)
+      : StrategyHost(std::move(feed), gateway) {}
+
+  size_t updates{0};
+  void on_book(market::InstrumentId, const market::OrderBook&) { ++updates; }
+};
+
+class StrategyHostTest : public ::testing::Test {
+ protected:
+  std::vector<std::vector<std::byte>> packets_;
+  std::vector<uint64_t> timestamps_;
+
+  void SetUp() override { sys::SimulatedClock::set(0); }
+
+  feed::MemoryFeed make_feed() {
+    std::vector<std::span<const std::byte>> views;
+    for (const auto& p : packets_) views.emplace_back(p);
+    return feed::MemoryFeed(std::move(views), timestamps_);
+  }
+};
+
+// ----------------------------------------------------------------------------
+// 測試
+// ----------------------------------------------------------------------------
+
+TEST_F(StrategyHostTest, DispatchesOnlySubscribedInstruments) {
+  packets_.push_back(
+      PacketBuilder(1)
+          .add(make_r06("TXFC6", {{100, 1, 1}}, {{101, 1, 1}}))
+          .add(make_r06("MXFC6", {{200, 1, 1}}, {{201, 1, 1}}))
+          .build());
+  packets_.push_back(PacketBuilder(2)
+                         .add(make_r02("MXFC6", 201, 1))
+                         .add(make_r02("TXFC6", 101, 2))
+                         .build());
+
+  auto strategy = std::make_unique<RecordingStrategy>(make_feed(),
+                                                      MockGateway{});
+  auto id = strategy->subscribe("TXFC6");
+  ASSERT_TRUE(id);
+
+  ASSERT_TRUE(strategy->run());
+
+  ASSERT_EQ(strategy->books.size(), 1U);
+  EXPECT_EQ(strategy->books[0].first, *id);
+  EXPECT_NE(strategy->books[0].second, 0);
+  ASSERT_EQ(strategy->trades.size(), 1U);
+  EXPECT_EQ(strategy->trades[0], 101);
+
+  const auto& book = strategy->book(*id);
+  EXPECT_EQ(book.best_bid().price, core::Price::from_ticks(100));
+  EXPECT_EQ(book.last_price(), core::Price::from_ticks(101));
+}
+
+TEST_F(StrategyHostTest, DeliversFillsAndTimers) {
+  auto strategy = std::make_unique<RecordingStrategy>(make_feed(),
+                                                      MockGateway{});
+  strategy->gateway().pending.push_back(
+      Fill{.order_id = core::OrderId::from_value(42)});
+
+  sys::SimulatedClock::set(5000);
+  auto timer = strategy->schedule_timer(0, 7);
+  ASSERT_TRUE(timer);
+  auto cancelled = strategy->schedule_timer(0, 8);
+  ASSERT_TRUE(cancelled);
+  EXPECT_TRUE(strategy->cancel_timer(*cancelled));
+
+  auto events = strategy->poll_once();
+  ASSERT_TRUE(events);
+  EXPECT_EQ(*events, 2U);
+  EXPECT_EQ(strategy->fills, std::vector<uint64_t>{42});
+  EXPECT_EQ(strategy->timers, std::vector<uint64_t>{7});
+}
+
+TEST_F(StrategyHostTest, SimulatedClockInterleavesTimersWithReplay) {
+  // 封包時間戳 (ns): 10us, 30us；timer 於 20us 與 40us 到期
+  packets_.push_back(
+      PacketBuilder(1).add(make_r02("TXFC6", 100, 1)).build());
+  packets_.push_back(
+      PacketBuilder(2).add(make_r02("TXFC6", 101, 1)).build());
+  timestamps_ = {10'000, 30'000};
+
+  auto strategy = std::make_unique<RecordingStrategy>(make_feed(),
+                                                      MockGateway{});
+  ASSERT_TRUE(strategy->subscribe("TXFC6"));
+  ASSERT_TRUE(strategy->schedule_after(20'000, 1));
+  ASSERT_TRUE(strategy->schedule_after(40'000, 2));
+
+  ASSERT_TRUE(strategy->run());
+
+  // 40us 的 timer 尚未到期: 回放時間只到最後一個封包
+  EXPECT_EQ(strategy->events,
+            (std::vector<std::string>{"trade@10000", "timer1",
+                                      "trade@30000"}));
+
+  sys::SimulatedClock::advance(10'000);
+  ASSERT_TRUE(strategy->poll_once());
+  EXPECT_EQ(strategy->timers, (std::vector<uint64_t>{1, 2}));
+}
+
+TEST_F(StrategyHostTest, UnimplementedCallbacksAreSkipped) {
+  packets_.push_back(PacketBuilder()
+                         .add(make_r06("TXFC6", {{100, 1, 1}}, {}))
+                         .add(make_r02("TXFC6", 100, 1))
+                         .build());
+
+  auto strategy =
+      std::make_unique<BookOnlyStrategy>(make_feed(), NullGateway{});
+  ASSERT_TRUE(strategy->subscribe("TXFC6"));
+  ASSERT_TRUE(strategy->schedule_timer(0));
+
+  ASSERT_TRUE(strategy->run());
+  EXPECT_EQ(strategy->updates, 1U);
+  EXPECT_EQ(strategy->book(0).last_price(), core::Price::from_ticks(100));
+}
+
+}  // namespace tx::strategy::test
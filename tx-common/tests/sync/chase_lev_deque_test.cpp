@@ -0,0 +1,73 @@
+#include "tx/sync/chase_lev_deque.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace tx::sync::test {
+
+TEST(ChaseLevDequeTest, OwnerIsLifoThiefIsFifo) {
+  ChaseLevDeque<int, 8> dq;
+  EXPECT_TRUE(dq.empty());
+  for (int i = 1; i <= 4; ++i) ASSERT_TRUE(dq.push(i));
+  EXPECT_EQ(dq.size(), 4U);
+
+  EXPECT_EQ(dq.pop(), 4);
+  EXPECT_EQ(dq.steal(), 1);
+  EXPECT_EQ(dq.pop(), 3);
+  EXPECT_EQ(dq.steal(), 2);
+  EXPECT_FALSE(dq.pop().has_value());
+  EXPECT_FALSE(dq.steal().has_value());
+}
+
+TEST(ChaseLevDequeTest, PushFailsWhenFull) {
+  ChaseLevDeque<int, 4> dq;
+  for (int i = 0; i < 4; ++i) ASSERT_TRUE(dq.push(i));
+  EXPECT_FALSE(dq.push(99));
+
+  // 被偷走後可繼續放入，index 環繞
+  EXPECT_EQ(dq.steal(), 0);
+  EXPECT_TRUE(dq.push(4));
+  EXPECT_EQ(dq.pop(), 4);
+}
+
+TEST(ChaseLevDequeTest, ConcurrentStealsSeeEveryItemOnce) {
+  constexpr int kItems = 200000;
+  constexpr int kThieves = 3;
+  auto dq = std::make_unique<ChaseLevDeque<int, 1024>>();
+
+  std::vector<std::atomic<int>> seen(kItems);
+  std::atomic<bool> done{false};
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire) || !dq->empty()) {
+        if (auto v = dq->steal()) seen[static_cast<size_t>(*v)].fetch_add(1);
+      }
+    });
+  }
+
+  int next = 0;
+  while (next < kItems) {
+    if (dq->push(next)) {
+      ++next;
+    }
+    // 偶爾自己取，製造最後一個元素的競爭
+    if (next % 7 == 0) {
+      if (auto v = dq->pop()) seen[static_cast<size_t>(*v)].fetch_add(1);
+    }
+  }
+  while (auto v = dq->pop()) seen[static_cast<size_t>(*v)].fetch_add(1);
+  done.store(true, std::memory_order_release);
+  for (auto& t : thieves) t.join();
+
+  for (int i = 0; i < kItems; ++i) {
+    ASSERT_EQ(seen[static_cast<size_t>(i)].load(), 1) << "item " << i;
+  }
+}
+
+}  // namespace tx::sync::test
@@ -0,0 +1,134 @@
+#include "tx/sync/rcu.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tx::sync::test {
+
+namespace {
+
+/// @brief 記錄存活版本數，驗證回收時機
+struct Versioned {
+  static inline std::atomic<int> alive{0};
+
+  int value;
+  int checksum;  ///< 永遠為 -value，讀到被釋放的版本時會不一致
+
+  explicit Versioned(int v) : value(v), checksum(-v) { ++alive; }
+  Versioned(const Versioned& other)
+      : value(other.value), checksum(other.checksum) {
+    ++alive;
+  }
+  Versioned& operator=(const Versioned&) = default;
+  ~Versioned() {
+    value = 0;
+    checksum = 1;
+    --alive;
+  }
+};
+
+}  // namespace
+
+TEST(RcuTest, ReaderSeesPublishedVersion) {
+  Rcu<Versioned> rcu(Versioned(1));
+  auto reader = rcu.register_reader();
+  ASSERT_TRUE(reader);
+  EXPECT_EQ(reader->read().value, 1);
+
+  rcu.update([](Versioned& next) {
+    next.value = 2;
+    next.checksum = -2;
+  });
+  EXPECT_EQ(reader->read().value, 2);
+  EXPECT_EQ(rcu.epoch(), 2U);
+}
+
+TEST(RcuTest, OldVersionSurvivesUntilQuiescent) {
+  Versioned::alive = 0;
+  {
+    Rcu<Versioned> rcu(Versioned(1));
+    auto reader = rcu.register_reader();
+    ASSERT_TRUE(reader);
+
+    const Versioned& held = reader->read();
+    rcu.publish(std::make_unique<const Versioned>(2));
+    EXPECT_EQ(held.value, 1);  // 尚未通過 quiescent point
+    EXPECT_EQ(Versioned::alive, 2);
+    EXPECT_EQ(rcu.reclaim(), 1U);
+
+    reader->quiescent();
+    EXPECT_EQ(rcu.reclaim(), 0U);
+    EXPECT_EQ(Versioned::alive, 1);
+  }
+  EXPECT_EQ(Versioned::alive, 0);
+}
+
+TEST(RcuTest, OfflineReaderDoesNotBlockReclaim) {
+  Rcu<Versioned> rcu(Versioned(1));
+  auto active = rcu.register_reader();
+  auto idle = rcu.register_reader();
+  ASSERT_TRUE(active && idle);
+
+  idle->offline();
+  rcu.publish(std::make_unique<const Versioned>(2));
+  EXPECT_EQ(rcu.reclaim(), 1U);  // 只等待 active
+  active->quiescent();
+  EXPECT_EQ(rcu.reclaim(), 0U);
+
+  idle->online();
+  EXPECT_EQ(idle->read().value, 2);
+}
+
+TEST(RcuTest, ReaderSlotsAreLimitedAndReleased) {
+  Rcu<int, 2> rcu(0);
+  auto a = rcu.register_reader();
+  auto b = rcu.register_reader();
+  ASSERT_TRUE(a && b);
+  EXPECT_FALSE(rcu.register_reader());
+
+  { auto released = std::move(*a); }
+  EXPECT_TRUE(rcu.register_reader());
+}
+
+TEST(RcuTest, ConcurrentReadersNeverSeeFreedVersion) {
+  Rcu<Versioned, 4> rcu(Versioned(1));
+  std::atomic<bool> stop{false};
+  std::atomic<int> errors{0};
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 3; ++i) {
+    readers.emplace_back([&] {
+      auto reader = rcu.register_reader();
+      if (!reader) {
+        ++errors;
+        return;
+      }
+      int last = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        const Versioned& v = reader->read();
+        if (v.checksum != -v.value || v.value < last) ++errors;
+        last = v.value;
+        reader->quiescent();
+      }
+    });
+  }
+
+  for (int i = 2; i <= 2000; ++i) {
+    rcu.update([i](Versioned& next) {
+      next.value = i;
+      next.checksum = -i;
+    });
+  }
+  stop = true;
+  for (auto& t : readers) t.join();
+
+  EXPECT_EQ(errors, 0);
+  EXPECT_EQ(rcu.reclaim(), 0U);
+  EXPECT_EQ(rcu.current().value, 2000);
+}
+
+}  // namespace tx::sync::test
@@ -0,0 +1,165 @@
+#include "tx/sync/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "tx/sys/cpu_affinity.hpp"
+
+namespace tx::sync::test {
+
+std::vector<size_t> test_cpus(size_t n) {
+  auto cpus = sys::CPUAffinity::get_housekeeping_cpus();
+  std::vector<size_t> out;
+  for (size_t i = 0; i < n; ++i) out.push_back(cpus[i % cpus.size()]);
+  return out;
+}
+
+TEST(ThreadPoolTest, RejectsInvalidCpuList) {
+  EXPECT_FALSE(ThreadPool::create(std::vector<size_t>{}));
+  EXPECT_FALSE(ThreadPool::create(std::vector<size_t>{1U << 20}));
+}
+
+TEST(ThreadPoolTest, RunsEveryTaskExactlyOnce) {
+  auto pool = ThreadPool::create(test_cpus(4));
+  ASSERT_TRUE(pool);
+  EXPECT_EQ((*pool)->size(), 4U);
+
+  constexpr size_t kTasks = 10000;
+  std::vector<std::atomic<int>> hits(kTasks);
+  for (size_t i = 0; i < kTasks; ++i) {
+    (*pool)->submit([&hits, i] { hits[i].fetch_add(1); });
+  }
+  (*pool)->wait_idle();
+
+  for (size_t i = 0; i < kTasks; ++i) {
+    ASSERT_EQ(hits[i].load(), 1) << "task " << i;
+  }
+}
+
+TEST(ThreadPoolTest, NestedSubmitIsStolenByIdleWorkers) {
+  auto pool = ThreadPool::create(test_cpus(4));
+  ASSERT_TRUE(pool);
+  ThreadPool& p = **pool;
+
+  // 單一工作在自己的 deque 產生大量子工作，其他 worker 只能靠偷取參與
+  std::atomic<size_t> done{0};
+  p.submit([&] {
+    for (int i = 0; i < 2000; ++i) {
+      p.submit([&] {
+        volatile uint64_t x = 0;
+        for (int k = 0; k < 2000; ++k) x = x + static_cast<uint64_t>(k);
+        done.fetch_add(1);
+      });
+    }
+  });
+  p.wait_idle();
+
+  EXPECT_EQ(done.load(), 2000U);
+  EXPECT_GT(p.steal_count(), 0U);
+}
+
+TEST(ThreadPoolTest, CurrentWorkerIsVisibleInsideTasks) {
+  auto pool = ThreadPool::create(test_cpus(2));
+  ASSERT_TRUE(pool);
+
+  EXPECT_EQ(ThreadPool::current_worker(), -1);
+  std::atomic<int> seen{-1};
+  (*pool)->submit([&] { seen = ThreadPool::current_worker(); });
+  (*pool)->wait_idle();
+  EXPECT_GE(seen.load(), 0);
+  EXPECT_LT(seen.load(), 2);
+}
+
+TEST(ThreadPoolTest, ParallelForCoversRangeOnce) {
+  auto pool = ThreadPool::create(test_cpus(4));
+  ASSERT_TRUE(pool);
+
+  constexpr size_t kN = 100000;
+  std::vector<uint8_t> hits(kN, 0);
+  (*pool)->parallel_for(0, kN, 1000, [&](size_t i) { ++hits[i]; });
+
+  EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), static_cast<long>(kN));
+}
+
+TEST(ThreadPoolTest, ParallelForRangeFormAndEmptyRange) {
+  auto pool = ThreadPool::create(test_cpus(3));
+  ASSERT_TRUE(pool);
+
+  std::atomic<size_t> total{0};
+  (*pool)->parallel_for(10, 1010, 64, [&](size_t b, size_t e) {
+    EXPECT_LE(e - b, 64U);
+    total.fetch_add(e - b);
+  });
+  EXPECT_EQ(total.load(), 1000U);
+
+  bool called = false;
+  (*pool)->parallel_for(5, 5, 1, [&](size_t) { called = true; });
+  EXPECT_FALSE(called);
+}
+
+TEST(ThreadPoolTest, NestedParallelForInsideTasks) {
+  auto pool = ThreadPool::create(test_cpus(4));
+  ASSERT_TRUE(pool);
+  ThreadPool& p = *pool.value();
+
+  std::atomic<size_t> total{0};
+  p.parallel_for(0, 16, 1, [&](size_t) {
+    p.parallel_for(0, 1000, 50,
+                   [&](size_t b, size_t e) { total.fetch_add(e - b); });
+  });
+  EXPECT_EQ(total.load(), 16000U);
+}
+
+TEST(ThreadPoolTest, ParallelReduceMatchesSerial) {
+  auto pool = ThreadPool::create(test_cpus(4));
+  ASSERT_TRUE(pool);
+
+  std::vector<uint64_t> data(123457);
+  std::iota(data.begin(), data.end(), uint64_t{1});
+
+  auto sum = (*pool)->parallel_reduce(
+      size_t{0}, data.size(), 4096, uint64_t{0},
+      [&](size_t b, size_t e) {
+        uint64_t s = 0;
+        for (size_t i = b; i < e; ++i) s += data[i];
+        return s;
+      },
+      [](uint64_t a, uint64_t b) { return a + b; });
+  EXPECT_EQ(sum, uint64_t{123457} * 123458 / 2);
+
+  // 合併順序固定: 以字串串接驗證
+  auto order = (*pool)->parallel_reduce(
+      size_t{0}, size_t{10}, 3, std::string{},
+      [](size_t b, size_t) { return std::to_string(b); },
+      [](std::string a, std::string b) { return a + "," + b; });
+  EXPECT_EQ(order, ",0,3,6,9");
+
+  auto empty = (*pool)->parallel_reduce(
+      size_t{0}, size_t{0}, 1, 42, [](size_t, size_t) { return 0; },
+      [](int a, int b) { return a + b; });
+  EXPECT_EQ(empty, 42);
+}
+
+TEST(ThreadPoolTest, IdleWorkersWakeForLaterSubmits) {
+  auto pool = ThreadPool::create(test_cpus(2));
+  ASSERT_TRUE(pool);
+
+  // 讓 worker 進入睡眠後再提交
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  std::atomic<int> done{0};
+  for (int round = 0; round < 50; ++round) {
+    (*pool)->submit([&] { done.fetch_add(1); });
+    (*pool)->wait_idle();
+  }
+  EXPECT_EQ(done.load(), 50);
+}
+
+}  // namespace tx::sync::test
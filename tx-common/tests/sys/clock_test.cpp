@@ -0,0 +1,86 @@
+#include "tx/sys/clock.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace tx::sys::test {
+
+TEST(SimulatedClockTest, ObserveNeverMovesBackwards) {
+  SimulatedClock::set(1000);
+  SimulatedClock::observe(2000);
+  EXPECT_EQ(SimulatedClock::now(), 2000U);
+
+  SimulatedClock::observe(1500);
+  EXPECT_EQ(SimulatedClock::now(), 2000U);
+
+  SimulatedClock::advance(500);
+  EXPECT_EQ(SimulatedClock::now(), 2500U);
+
+  SimulatedClock::set(0);
+  EXPECT_EQ(SimulatedClock::now(), 0U);
+}
+
+TEST(SimulatedClockTest, UnitsAreNanoseconds) {
+  EXPECT_EQ(SimulatedClock::from_ns(12345), 12345U);
+  EXPECT_EQ(SimulatedClock::to_ns(12345), 12345U);
+}
+
+TEST(SimulatedClockTest, EachThreadHasItsOwnTimeline) {
+  SimulatedClock::set(100);
+
+  uint64_t other = 0;
+  std::thread t([&] {
+    SimulatedClock::observe(999);
+    other = SimulatedClock::now();
+  });
+  t.join();
+
+  EXPECT_EQ(other, 999U);
+  EXPECT_EQ(SimulatedClock::now(), 100U);
+}
+
+TEST(TscClockTest, ConvertsThroughCalibration) {
+  TSCTimer::calibrate(std::chrono::milliseconds(10));
+
+  uint64_t a = TscClock::now();
+  uint64_t b = TscClock::now();
+  EXPECT_LE(a, b);
+
+  uint64_t cycles = TscClock::from_ns(1'000'000);
+  EXPECT_GT(cycles, 0U);
+  uint64_t ns = TscClock::to_ns(cycles);
+  EXPECT_NEAR(static_cast<double>(ns), 1'000'000.0, 1'000.0);
+
+  TscClock::observe(0);  // no-op
+}
+
+TEST(TscWallClockTest, ReadersSeeConsistentAnchorDuringSync) {
+  TSCTimer::calibrate(std::chrono::milliseconds(10));
+  TscWallClock::sync();
+  const uint64_t tsc = TSCTimer::now();
+  const uint64_t expected = TscWallClock::from_tsc(tsc);
+
+  // 與 sync() 並行讀取：錨點前後一致，換算結果只差量測誤差
+  std::atomic<bool> done{false};
+  std::thread writer([&] {
+    for (int i = 0; i < 200; ++i) {
+      TscWallClock::sync();
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+    done.store(true, std::memory_order_release);
+  });
+  double worst = 0;
+  while (!done.load(std::memory_order_acquire)) {
+    const auto diff = static_cast<double>(TscWallClock::from_tsc(tsc)) -
+                      static_cast<double>(expected);
+    worst = std::max(worst, std::abs(diff));
+  }
+  writer.join();
+  EXPECT_LT(worst, 1e6);  // < 1 ms
+}
+
+}  // namespace tx::sys::test
@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace tx::sys::test {
 
 class CPUAffinityTest : public ::testing::Test {
@@ -37,4 +40,32 @@ TEST_F(CPUAffinityTest, GetCPUCount_ReturnsPositive) {
   }
 }
 
+TEST_F(CPUAffinityTest, ExcludeCpus_RemovesIsolatedCpus) {
+  // e.g. isolcpus=2,5：背景工作不可落在 2 與 5
+  const std::vector<size_t> isolated{2, 5};
+  EXPECT_EQ(CPUAffinity::exclude_cpus({0, 1, 2, 3, 4, 5, 6}, isolated),
+            (std::vector<size_t>{0, 1, 3, 4, 6}));
+  EXPECT_EQ(CPUAffinity::exclude_cpus({3, 1}, isolated),
+            (std::vector<size_t>{3, 1}));
+  EXPECT_TRUE(CPUAffinity::exclude_cpus({2, 5}, isolated).empty());
+}
+
+TEST_F(CPUAffinityTest, GetHousekeepingCpus_SkipsIsolatedCpus) {
+  const auto online = CPUAffinity::get_available_cpus();
+  const auto isolated = CPUAffinity::get_isolated_cpus();
+  const auto housekeeping = CPUAffinity::get_housekeeping_cpus();
+
+  // 全部被隔離時退回 online 列表
+  if (CPUAffinity::exclude_cpus(online, isolated).empty()) {
+    EXPECT_EQ(housekeeping, online);
+    return;
+  }
+  ASSERT_FALSE(housekeeping.empty());
+  for (size_t cpu : housekeeping) {
+    EXPECT_NE(std::find(online.begin(), online.end(), cpu), online.end());
+    EXPECT_EQ(std::find(isolated.begin(), isolated.end(), cpu),
+              isolated.end());
+  }
+}
+
 }  // namespace tx::sys::test
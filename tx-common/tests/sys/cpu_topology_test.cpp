@@ -0,0 +1,65 @@
+#include "tx/sys/cpu_topology.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "tx/sys/cpu_affinity.hpp"
+
+namespace tx::sys::test {
+
+/// @brief 2 插槽 × 2 核心 × 2 SMT，sibling 編號間隔 4 (常見的 Linux 編號)
+std::vector<CpuInfo> two_socket_topology() {
+  return {
+      {.cpu = 0, .package = 0, .core = 0, .node = 0},
+      {.cpu = 1, .package = 0, .core = 1, .node = 0},
+      {.cpu = 2, .package = 1, .core = 0, .node = 1},
+      {.cpu = 3, .package = 1, .core = 1, .node = 1},
+      {.cpu = 4, .package = 0, .core = 0, .node = 0},
+      {.cpu = 5, .package = 0, .core = 1, .node = 0},
+      {.cpu = 6, .package = 1, .core = 0, .node = 1},
+      {.cpu = 7, .package = 1, .core = 1, .node = 1},
+  };
+}
+
+TEST(CpuTopologyTest, DetectCoversAvailableCpus) {
+  auto cpus = CpuTopology::detect();
+  auto available = CPUAffinity::get_available_cpus();
+
+  ASSERT_EQ(cpus.size(), available.size());
+  for (size_t i = 0; i < cpus.size(); ++i) {
+    EXPECT_EQ(cpus[i].cpu, available[i]);
+    EXPECT_GE(cpus[i].package, 0);
+    EXPECT_GE(cpus[i].node, 0);
+  }
+}
+
+TEST(CpuTopologyTest, UnknownInterfaceHasNoNode) {
+  EXPECT_EQ(CpuTopology::interface_node("no-such-nic0"), -1);
+}
+
+TEST(CpuTopologyTest, SelectPrefersPhysicalCoresAndSkipsCpuZero) {
+  auto topo = two_socket_topology();
+
+  // 4 顆實體核心: 1, 2, 3 優先，CPU 0 排最後，之後才是 sibling
+  EXPECT_EQ(CpuTopology::select(topo, 4), (std::vector<size_t>{1, 2, 3, 0}));
+  EXPECT_EQ(CpuTopology::select(topo, 5),
+            (std::vector<size_t>{1, 2, 3, 0, 4}));
+}
+
+TEST(CpuTopologyTest, SelectPrefersRequestedNode) {
+  auto topo = two_socket_topology();
+
+  EXPECT_EQ(CpuTopology::select(topo, 2, 1), (std::vector<size_t>{2, 3}));
+  // node 1 的實體核心用完後先用 node 1 的 sibling，再跨 node
+  EXPECT_EQ(CpuTopology::select(topo, 5, 1),
+            (std::vector<size_t>{2, 3, 6, 7, 1}));
+}
+
+TEST(CpuTopologyTest, SelectReturnsAtMostAvailable) {
+  auto topo = two_socket_topology();
+  EXPECT_EQ(CpuTopology::select(topo, 100).size(), topo.size());
+  EXPECT_TRUE(CpuTopology::select({}, 3).empty());
+}
+
+}  // namespace tx::sys::test
@@ -0,0 +1,292 @@
+#include "tx/sys/timer_wheel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace tx::sys::test {
+
+// ResolutionShift = 0: 1 tick = 1 cycle，方便驗證
+using Wheel = TimerWheel<1024, 0>;
+
+struct Fired {
+  uint64_t at;
+  uint64_t user_data;
+};
+
+/// @brief 逐 tick 推進並記錄觸發時間
+std::vector<Fired> run_until(Wheel& wheel, uint64_t from, uint64_t to,
+                             uint64_t step = 1) {
+  std::vector<Fired> fired;
+  for (uint64_t t = from; t <= to; t += step) {
+    wheel.advance(t, [&](TimerHandle, uint64_t data) {
+      fired.push_back({t, data});
+    });
+  }
+  return fired;
+}
+
+// =============================
+// 基本功能測試
+// =============================
+
+TEST(TimerWheelTest, InitialState) {
+  auto wheel = std::make_unique<Wheel>(1000);
+  EXPECT_EQ(wheel->capacity(), 1024);
+  EXPECT_TRUE(wheel->empty());
+  EXPECT_EQ(wheel->now(), 1000);
+}
+
+TEST(TimerWheelTest, FiresAtDeadline) {
+  auto wheel = std::make_unique<Wheel>(0);
+  auto handle = wheel->schedule(10, 7);
+  ASSERT_TRUE(handle);
+  EXPECT_TRUE(wheel->is_pending(*handle));
+
+  auto fired = run_until(*wheel, 0, 20);
+  ASSERT_EQ(fired.size(), 1);
+  EXPECT_EQ(fired[0].at, 10);
+  EXPECT_EQ(fired[0].user_data, 7);
+  EXPECT_FALSE(wheel->is_pending(*handle));
+  EXPECT_TRUE(wheel->empty());
+}
+
+TEST(TimerWheelTest, PastDeadlineFiresOnNextAdvance) {
+  auto wheel = std::make_unique<Wheel>(500);
+  ASSERT_TRUE(wheel->schedule(100, 1));
+
+  size_t n = wheel->advance(500, [](TimerHandle, uint64_t) {});
+  EXPECT_EQ(n, 1);
+}
+
+TEST(TimerWheelTest, Cancel) {
+  auto wheel = std::make_unique<Wheel>(0);
+  auto a = wheel->schedule(50, 1);
+  auto b = wheel->schedule(50, 2);
+  ASSERT_TRUE(a && b);
+
+  EXPECT_TRUE(wheel->cancel(*a));
+  EXPECT_FALSE(wheel->cancel(*a));  // 重複取消
+  EXPECT_EQ(wheel->size(), 1);
+
+  auto fired = run_until(*wheel, 0, 100);
+  ASSERT_EQ(fired.size(), 1);
+  EXPECT_EQ(fired[0].user_data, 2);
+}
+
+TEST(TimerWheelTest, StaleHandleDoesNotCancelReusedNode) {
+  auto wheel = std::make_unique<Wheel>(0);
+  auto old_handle = wheel->schedule(5, 1);
+  ASSERT_TRUE(old_handle);
+  run_until(*wheel, 0, 5);
+
+  // node 被回收後重用，舊 handle 不應影響新 timer
+  auto new_handle = wheel->schedule(10, 2);
+  ASSERT_TRUE(new_handle);
+  EXPECT_EQ(new_handle->index, old_handle->index);
+  EXPECT_FALSE(wheel->cancel(*old_handle));
+  EXPECT_TRUE(wheel->is_pending(*new_handle));
+}
+
+TEST(TimerWheelTest, InvalidHandle) {
+  auto wheel = std::make_unique<Wheel>(0);
+  EXPECT_FALSE(TimerHandle{}.is_valid());
+  EXPECT_FALSE(wheel->cancel(TimerHandle{}));
+}
+
+// =============================
+// 階層與 cascade 測試
+// =============================
+
+TEST(TimerWheelTest, HigherLevelsCascadeExactly) {
+  auto wheel = std::make_unique<Wheel>(3);
+  const std::vector<uint64_t> deadlines = {255, 256, 257, 1000, 65535,
+                                           65536, 70000, 1u << 20};
+  for (size_t i = 0; i < deadlines.size(); ++i) {
+    ASSERT_TRUE(wheel->schedule(deadlines[i], i));
+  }
+
+  auto fired = run_until(*wheel, 3, (1u << 20) + 10);
+  ASSERT_EQ(fired.size(), deadlines.size());
+  for (size_t i = 0; i < deadlines.size(); ++i) {
+    EXPECT_EQ(fired[i].user_data, i);
+    EXPECT_EQ(fired[i].at, deadlines[i]);
+  }
+}
+
+TEST(TimerWheelTest, BatchAdvanceFiresInDeadlineOrder) {
+  auto wheel = std::make_unique<Wheel>(0);
+  ASSERT_TRUE(wheel->schedule(300, 3));
+  ASSERT_TRUE(wheel->schedule(10, 1));
+  ASSERT_TRUE(wheel->schedule(100, 2));
+
+  std::vector<uint64_t> order;
+  size_t n = wheel->advance(
+      1000, [&](TimerHandle, uint64_t data) { order.push_back(data); });
+
+  EXPECT_EQ(n, 3);
+  EXPECT_EQ(order, (std::vector<uint64_t>{1, 2, 3}));
+}
+
+TEST(TimerWheelTest, BeyondRangeIsClampedAndRescheduled) {
+  auto wheel = std::make_unique<Wheel>(0);
+  const uint64_t far = (uint64_t{1} << 32) + 12345;
+  ASSERT_TRUE(wheel->schedule(far, 9));
+
+  size_t n = 0;
+  uint64_t fired_at = 0;
+  for (uint64_t t = 0; t < far + 4096; t += 4096) {
+    n += wheel->advance(t, [&](TimerHandle, uint64_t) { fired_at = t; });
+  }
+
+  EXPECT_EQ(n, 1);
+  EXPECT_GE(fired_at, far);
+  EXPECT_LT(fired_at, far + 4096);
+}
+
+// =============================
+// Callback 重入測試
+// =============================
+
+TEST(TimerWheelTest, RescheduleFromCallback) {
+  auto wheel = std::make_unique<Wheel>(0);
+  ASSERT_TRUE(wheel->schedule(10, 0));
+
+  // 模擬 heartbeat: 每次觸發後排下一次
+  std::vector<uint64_t> beats;
+  for (uint64_t t = 0; t <= 55; ++t) {
+    wheel->advance(t, [&](TimerHandle, uint64_t) {
+      beats.push_back(t);
+      ASSERT_TRUE(wheel->schedule(t + 10, 0));
+    });
+  }
+  EXPECT_EQ(beats, (std::vector<uint64_t>{10, 20, 30, 40, 50}));
+}
+
+TEST(TimerWheelTest, CancelOtherFromCallback) {
+  auto wheel = std::make_unique<Wheel>(0);
+  auto a = wheel->schedule(10, 1);
+  auto b = wheel->schedule(10, 2);
+  ASSERT_TRUE(a && b);
+
+  size_t n = wheel->advance(10, [&](TimerHandle h, uint64_t) {
+    wheel->cancel(h == *a ? *b : *a);
+  });
+  EXPECT_EQ(n, 1);
+  EXPECT_TRUE(wheel->empty());
+}
+
+TEST(TimerWheelTest, FullWheelReturnsError) {
+  auto wheel = std::make_unique<TimerWheel<2, 0>>(0);
+  ASSERT_TRUE(wheel->schedule(1));
+  ASSERT_TRUE(wheel->schedule(2));
+  auto result = wheel->schedule(3);
+  ASSERT_FALSE(result);
+  EXPECT_EQ(result.error(), std::errc::no_buffer_space);
+}
+
+// =============================
+// next_expiry 測試
+// =============================
+
+TEST(TimerWheelTest, NextExpiryIsExactOnLevelZero) {
+  auto wheel = std::make_unique<Wheel>(0);
+  EXPECT_EQ(wheel->next_expiry(), UINT64_MAX);
+
+  ASSERT_TRUE(wheel->schedule(200, 2));
+  ASSERT_TRUE(wheel->schedule(10, 1));
+  EXPECT_EQ(wheel->next_expiry(), 10);
+
+  wheel->advance(10, [](TimerHandle, uint64_t) {});
+  EXPECT_EQ(wheel->next_expiry(), 200);
+}
+
+TEST(TimerWheelTest, NextExpiryIsCascadeBoundaryOnUpperLevels) {
+  auto wheel = std::make_unique<Wheel>(3);
+  ASSERT_TRUE(wheel->schedule(70000, 1));
+  EXPECT_EQ(wheel->next_expiry(), 65536);  // level 2 slot 1 的起點
+
+  // 跳到下界後 cascade，逐步收斂到實際到期時間
+  std::vector<uint64_t> wakeups;
+  while (!wheel->empty() && wakeups.size() < 8) {
+    uint64_t t = wheel->next_expiry();
+    wakeups.push_back(t);
+    wheel->advance(t, [](TimerHandle, uint64_t) {});
+  }
+  EXPECT_TRUE(wheel->empty());
+  EXPECT_EQ(wakeups, (std::vector<uint64_t>{65536, 69888, 70000}));
+}
+
+TEST(TimerWheelTest, JumpingToNextExpiryFiresEveryTimerOnTime) {
+  // 起點不在 slot 邊界上，涵蓋上層 slot 繞回下一輪的情況
+  auto wheel = std::make_unique<Wheel>(261);
+  std::mt19937_64 gen(7);
+  std::uniform_int_distribution<uint64_t> dist(0, 300'000);
+
+  std::vector<uint64_t> deadline_of;
+  for (uint64_t i = 0; i < 500; ++i) {
+    deadline_of.push_back(261 + dist(gen));
+    ASSERT_TRUE(wheel->schedule(deadline_of.back(), i));
+  }
+  ASSERT_TRUE(wheel->schedule(261 + 65535, deadline_of.size()));
+  deadline_of.push_back(261 + 65535);
+
+  size_t fired = 0;
+  while (!wheel->empty()) {
+    uint64_t t = wheel->next_expiry();
+    ASSERT_GE(t, wheel->now());
+    wheel->advance(t, [&](TimerHandle, uint64_t data) {
+      EXPECT_EQ(deadline_of[data], t);
+      ++fired;
+    });
+  }
+  EXPECT_EQ(fired, deadline_of.size());
+}
+
+// =============================
+// 隨機測試 (對照暴力解)
+// =============================
+
+TEST(TimerWheelTest, RandomMatchesReference) {
+  auto wheel = std::make_unique<Wheel>(0);
+  std::mt19937_64 gen(42);
+  std::uniform_int_distribution<uint64_t> dist(0, 200'000);
+
+  std::vector<std::pair<uint64_t, TimerHandle>> timers;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    auto h = wheel->schedule(dist(gen), i);
+    ASSERT_TRUE(h);
+    timers.emplace_back(0, *h);
+  }
+  // 隨機取消一部分
+  std::vector<bool> cancelled(timers.size(), false);
+  for (size_t i = 0; i < timers.size(); i += 3) {
+    cancelled[i] = wheel->cancel(timers[i].second);
+  }
+
+  std::vector<uint64_t> deadline_of(timers.size());
+  std::mt19937_64 replay(42);
+  for (auto& d : deadline_of) d = dist(replay);
+
+  size_t expected = 0;
+  for (bool c : cancelled) expected += c ? 0 : 1;
+
+  size_t fired = 0;
+  for (uint64_t t = 0; t <= 200'000; t += 97) {
+    wheel->advance(t, [&](TimerHandle, uint64_t data) {
+      EXPECT_FALSE(cancelled[data]);
+      EXPECT_LE(deadline_of[data], t);
+      EXPECT_GT(deadline_of[data] + 97, t);
+      ++fired;
+    });
+  }
+  wheel->advance(200'100, [&](TimerHandle, uint64_t) { ++fired; });
+  EXPECT_EQ(fired, expected);
+  EXPECT_TRUE(wheel->empty());
+}
+
+}  // namespace tx::sys::test